@@ -0,0 +1,18 @@
+QT -= gui
+QT += core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = ClassicSimCLI
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../ClassicSimCore.pri)
+
+SOURCES += main.cpp \
+    HeadlessSimControl.cpp
+
+HEADERS += HeadlessSimControl.h
+
+INCLUDEPATH += $$PWD
@@ -0,0 +1,502 @@
+#include "HeadlessSimControl.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMetaEnum>
+#include <QTextStream>
+#include <stdexcept>
+
+#include "CharacterDecoder.h"
+#include "EquipmentDb.h"
+#include "EvaluatorPool.h"
+#include "GearOptimizer.h"
+#include "NumberCruncher.h"
+#include "SimSettings.h"
+#include "SimulationThreadPool.h"
+#include "TalentOptimizer.h"
+
+namespace {
+// Setup string keys of the slots searched by the gear optimizer, indexed by equipment slot.
+const QStringList GEAR_SLOT_KEYS = {"MAINHAND", "OFFHAND", "RANGED", "HEAD", "NECK", "SHOULDERS", "BACK", "CHEST", "WRIST",
+                                    "GLOVES", "BELT", "LEGS", "BOOTS", "RING1", "RING2", "TRINKET1", "TRINKET2"};
+} // namespace
+
+HeadlessSimControl::HeadlessSimControl(QObject* parent) :
+    QObject(parent),
+    equipment_db(new EquipmentDb()),
+    random_affixes(equipment_db->get_random_affixes()),
+    sim_settings(new SimSettings()),
+    number_cruncher(new NumberCruncher()) {}
+
+HeadlessSimControl::~HeadlessSimControl() {
+    delete thread_pool;
+    delete number_cruncher;
+    delete sim_settings;
+    delete equipment_db;
+}
+
+bool HeadlessSimControl::parse_arguments(const QCoreApplication& app) {
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs ClassicSim without the GUI. Character setups are given as the JSON setup strings "
+                                     "exported by ClassicSim, either as arguments or on stdin as a single setup, an array of setups "
+                                     "or an object {\"raid\": [...], \"settings\": {...}}. Results are written to stdout as JSON.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("setup", "Character setup string(s). Read from stdin when omitted.", "[setup...]");
+
+    QCommandLineOption iterations_option("iterations", "Number of combat iterations.", "n");
+    QCommandLineOption combat_length_option("combat-length", "Combat length in seconds.", "seconds");
+    QCommandLineOption threads_option("threads", "Number of simulation threads.", "n");
+    QCommandLineOption full_sim_option("full-sim", "Simulate stat weights for the given --option values.");
+    QCommandLineOption sim_option_option("option", "Stat weight to simulate in a full sim, e.g. ScaleAgility. Repeatable.", "name");
+    QCommandLineOption target_ci_option("target-ci", "Stop an option early once its 95% DPS confidence interval is below this value.", "dps");
+    QCommandLineOption crn_option("common-random-numbers", "Use common random numbers across stat weight options.");
+    QCommandLineOption fast_forward_option("fast-forward-pet-swings", "Perform pet swings that are due before any other event without queueing them.");
+    QCommandLineOption optimize_gear_option("optimize-gear",
+                                            "Search for the gear with the highest DPS, simulating --iterations per candidate and four times as many to "
+                                            "confirm each swap. With --full-sim, the simulated stat weights narrow down the candidate items.");
+    QCommandLineOption candidates_per_slot_option("candidates-per-slot", "Candidate items kept per slot by stat weights when optimizing gear.", "n");
+    QCommandLineOption max_rounds_option("max-rounds", "Maximum number of gear swaps or talent point moves made when optimizing.", "n");
+    QCommandLineOption optimize_talents_option("optimize-talents",
+                                               "Search for the talents with the highest DPS, moving one talent point at a time. Builds are "
+                                               "narrowed down by successive halving, doubling the iterations up to --iterations.");
+    QCommandLineOption initial_iterations_option("initial-iterations", "Iterations every talent build is first simulated with when optimizing talents.",
+                                                 "n");
+    parser.addOptions({iterations_option, combat_length_option, threads_option, full_sim_option, sim_option_option, target_ci_option, crn_option,
+                       fast_forward_option, optimize_gear_option, candidates_per_slot_option, max_rounds_option, optimize_talents_option,
+                       initial_iterations_option});
+
+    parser.process(app);
+
+    if (parser.positionalArguments().empty()) {
+        QTextStream stdin_stream(stdin);
+        QJsonParseError parse_error;
+        QJsonDocument document = QJsonDocument::fromJson(stdin_stream.readAll().toUtf8(), &parse_error);
+        if (parse_error.error != QJsonParseError::NoError) {
+            print_error(QString("Failed to parse stdin: %1").arg(parse_error.errorString()));
+            return false;
+        }
+
+        QJsonValue input = document.isArray() ? QJsonValue(document.array()) : QJsonValue(document.object());
+        if (document.isObject() && document.object().contains("raid")) {
+            input = document.object()["raid"];
+            if (!read_settings(document.object()["settings"].toObject()))
+                return false;
+        }
+
+        if (!read_setups(input))
+            return false;
+    } else {
+        for (const auto& argument : parser.positionalArguments()) {
+            QJsonParseError parse_error;
+            QJsonDocument document = QJsonDocument::fromJson(argument.toUtf8(), &parse_error);
+            if (parse_error.error != QJsonParseError::NoError) {
+                print_error(QString("Failed to parse setup string: %1").arg(parse_error.errorString()));
+                return false;
+            }
+
+            if (!add_setup(QJsonValue(document.object())))
+                return false;
+        }
+    }
+
+    if (setup_strings.empty()) {
+        print_error("No character setups given");
+        return false;
+    }
+
+    if (parser.isSet(iterations_option)) {
+        sim_settings->set_combat_iterations_quick_sim(parser.value(iterations_option).toInt());
+        sim_settings->set_combat_iterations_full_sim(parser.value(iterations_option).toInt());
+    }
+    if (parser.isSet(combat_length_option))
+        sim_settings->set_combat_length(parser.value(combat_length_option).toInt());
+    if (parser.isSet(threads_option))
+        sim_settings->set_num_threads(parser.value(threads_option).toInt());
+    if (parser.isSet(full_sim_option))
+        full_sim = true;
+    if (parser.isSet(sim_option_option) && !set_sim_options(parser.values(sim_option_option)))
+        return false;
+    if (parser.isSet(target_ci_option))
+        sim_settings->set_target_confidence_interval(parser.value(target_ci_option).toDouble());
+    if (parser.isSet(crn_option))
+        sim_settings->set_common_random_numbers(true);
+    if (parser.isSet(fast_forward_option))
+        sim_settings->set_fast_forward_pet_swings(true);
+    if (parser.isSet(optimize_gear_option))
+        optimize_gear = true;
+    if (parser.isSet(candidates_per_slot_option))
+        candidates_per_slot = parser.value(candidates_per_slot_option).toInt();
+    if (parser.isSet(max_rounds_option))
+        max_rounds = parser.value(max_rounds_option).toInt();
+    if (parser.isSet(optimize_talents_option))
+        optimize_talents = true;
+    if (parser.isSet(initial_iterations_option))
+        initial_iterations = parser.value(initial_iterations_option).toInt();
+
+    if (sim_settings->get_combat_iterations_full_sim() <= 0 || sim_settings->get_combat_length() <= 0) {
+        print_error("Iterations and combat length must be positive");
+        return false;
+    }
+
+    if (optimize_gear && setup_strings.size() != 1) {
+        print_error("Gear optimization takes a single character setup");
+        return false;
+    }
+
+    if (optimize_talents && setup_strings.size() != 1) {
+        print_error("Talent optimization takes a single character setup");
+        return false;
+    }
+
+    return true;
+}
+
+bool HeadlessSimControl::read_setups(const QJsonValue& value) {
+    if (!value.isArray())
+        return add_setup(value);
+
+    for (const auto& setup : value.toArray()) {
+        if (!add_setup(setup))
+            return false;
+    }
+
+    return true;
+}
+
+bool HeadlessSimControl::add_setup(const QJsonValue& value) {
+    if (!value.isObject() || value.toObject().isEmpty()) {
+        print_error("Expected each character setup to be a JSON object");
+        return false;
+    }
+
+    // SimulationRunner verifies the loaded character by re-encoding it, which compares against the indented format.
+    setup_strings.append(QString(QJsonDocument(value.toObject()).toJson(QJsonDocument::Indented)));
+    return true;
+}
+
+bool HeadlessSimControl::read_settings(const QJsonObject& settings) {
+    if (settings.contains("iterations")) {
+        sim_settings->set_combat_iterations_quick_sim(settings["iterations"].toInt());
+        sim_settings->set_combat_iterations_full_sim(settings["iterations"].toInt());
+    }
+    if (settings.contains("combat_length"))
+        sim_settings->set_combat_length(settings["combat_length"].toInt());
+    if (settings.contains("threads"))
+        sim_settings->set_num_threads(settings["threads"].toInt());
+    if (settings.contains("full_sim"))
+        full_sim = settings["full_sim"].toBool();
+    if (settings.contains("target_confidence_interval"))
+        sim_settings->set_target_confidence_interval(settings["target_confidence_interval"].toDouble());
+    if (settings.contains("common_random_numbers"))
+        sim_settings->set_common_random_numbers(settings["common_random_numbers"].toBool());
+    if (settings.contains("fast_forward_pet_swings"))
+        sim_settings->set_fast_forward_pet_swings(settings["fast_forward_pet_swings"].toBool());
+    if (settings.contains("optimize_gear"))
+        optimize_gear = settings["optimize_gear"].toBool();
+    if (settings.contains("candidates_per_slot"))
+        candidates_per_slot = settings["candidates_per_slot"].toInt();
+    if (settings.contains("max_rounds"))
+        max_rounds = settings["max_rounds"].toInt();
+    if (settings.contains("gear_candidates") && !read_gear_candidates(settings["gear_candidates"].toObject()))
+        return false;
+    if (settings.contains("stat_weights") && !read_stat_weights(settings["stat_weights"].toObject()))
+        return false;
+    if (settings.contains("optimize_talents"))
+        optimize_talents = settings["optimize_talents"].toBool();
+    if (settings.contains("initial_iterations"))
+        initial_iterations = settings["initial_iterations"].toInt();
+
+    if (settings.contains("options")) {
+        QStringList option_keys;
+        for (const auto& option_key : settings["options"].toArray())
+            option_keys.append(option_key.toString());
+
+        return set_sim_options(option_keys);
+    }
+
+    return true;
+}
+
+bool HeadlessSimControl::set_sim_options(const QStringList& option_keys) {
+    const QMetaEnum meta_enum = QMetaEnum::fromType<SimOption::Name>();
+
+    QSet<SimOption::Name> options;
+    for (const auto& option_key : option_keys) {
+        bool ok = false;
+        const int value = meta_enum.keyToValue(option_key.toUtf8().constData(), &ok);
+        if (!ok || value == SimOption::Name::NoScale) {
+            print_error(QString("Unknown stat weight option '%1'").arg(option_key));
+            return false;
+        }
+
+        options.insert(static_cast<SimOption::Name>(value));
+    }
+
+    sim_settings->set_sim_options(options);
+    return true;
+}
+
+bool HeadlessSimControl::read_gear_candidates(const QJsonObject& candidates) {
+    for (const auto& slot_key : candidates.keys()) {
+        const int slot = GEAR_SLOT_KEYS.indexOf(slot_key);
+        if (slot == -1) {
+            print_error(QString("Unknown gear slot '%1'").arg(slot_key));
+            return false;
+        }
+
+        QVector<int> item_ids;
+        for (const auto& item_id : candidates[slot_key].toArray())
+            item_ids.append(item_id.toInt());
+
+        gear_candidates[slot] = item_ids;
+    }
+
+    return true;
+}
+
+bool HeadlessSimControl::read_stat_weights(const QJsonObject& weights) {
+    const QMetaEnum meta_enum = QMetaEnum::fromType<SimOption::Name>();
+
+    for (const auto& option_key : weights.keys()) {
+        bool ok = false;
+        const int value = meta_enum.keyToValue(option_key.toUtf8().constData(), &ok);
+        if (!ok || value == SimOption::Name::NoScale) {
+            print_error(QString("Unknown stat weight option '%1'").arg(option_key));
+            return false;
+        }
+
+        stat_weights[static_cast<SimOption::Name>(value)] = weights[option_key].toDouble();
+    }
+
+    return true;
+}
+
+void HeadlessSimControl::run() {
+    equipment_db->set_content_phase(Content::get_phase(CharacterDecoder(setup_strings[0]).get_value("PHASE").toInt()));
+
+    // Stat weights for the gear optimizer come from the settings unless a full sim simulates them first.
+    if ((optimize_gear || optimize_talents) && !full_sim) {
+        QJsonObject results;
+        if (!run_optimizers(results)) {
+            emit finished(1);
+            return;
+        }
+
+        QTextStream(stdout) << QJsonDocument(results).toJson(QJsonDocument::Indented);
+        emit finished(0);
+        return;
+    }
+
+    thread_pool = new SimulationThreadPool(equipment_db, random_affixes, sim_settings, number_cruncher);
+    connect(thread_pool, &SimulationThreadPool::threads_finished, this, &HeadlessSimControl::compile_thread_results);
+    connect(thread_pool, &SimulationThreadPool::simulation_error, this, &HeadlessSimControl::record_simulation_error);
+
+    if (full_sim)
+        thread_pool->run_sim(setup_strings, true, sim_settings->get_combat_iterations_full_sim(), 1 + sim_settings->get_active_options().size());
+    else
+        thread_pool->run_sim(setup_strings, false, sim_settings->get_combat_iterations_quick_sim(), 1);
+}
+
+void HeadlessSimControl::record_simulation_error(const QString& error) {
+    // Every runner loads the same setups, so the first error stands for all of them.
+    if (simulation_error.isEmpty())
+        simulation_error = error;
+}
+
+void HeadlessSimControl::compile_thread_results() {
+    if (!simulation_error.isEmpty()) {
+        print_error(QString("Simulation failed: %1").arg(simulation_error));
+        emit finished(1);
+        return;
+    }
+
+    QJsonObject results;
+    try {
+        results = get_results();
+    } catch (const std::logic_error& error) {
+        print_error(QString("Failed to compile results: %1").arg(error.what()));
+        emit finished(1);
+        return;
+    }
+
+    number_cruncher->reset();
+
+    if (!run_optimizers(results)) {
+        emit finished(1);
+        return;
+    }
+
+    QTextStream(stdout) << QJsonDocument(results).toJson(QJsonDocument::Indented);
+
+    emit finished(0);
+}
+
+QJsonObject HeadlessSimControl::get_results() {
+    QJsonObject results;
+    results["iterations"] = full_sim ? sim_settings->get_combat_iterations_full_sim() : sim_settings->get_combat_iterations_quick_sim();
+    results["combat_length"] = sim_settings->get_combat_length();
+    results["dps"] = number_cruncher->get_personal_dps(SimOption::Name::NoScale);
+    results["tps"] = number_cruncher->get_personal_tps(SimOption::Name::NoScale);
+    results["raid_dps"] = number_cruncher->get_raid_dps();
+    results["raid_tps"] = number_cruncher->get_raid_tps();
+
+    ScaleResult* dps_distribution = number_cruncher->get_dps_distribution();
+    QJsonObject distribution;
+    distribution["min"] = dps_distribution->min_dps;
+    distribution["max"] = dps_distribution->max_dps;
+    distribution["standard_deviation"] = dps_distribution->standard_deviation;
+    distribution["confidence_interval"] = dps_distribution->confidence_interval;
+    results["dps_distribution"] = distribution;
+    delete dps_distribution;
+
+    QJsonArray players;
+    for (const auto& player_result : number_cruncher->player_results) {
+        QJsonObject player;
+        player["name"] = player_result->player_name;
+        player["dps"] = player_result->dps;
+        player["tps"] = player_result->tps;
+        players.append(player);
+    }
+    results["players"] = players;
+
+    if (full_sim) {
+        QList<ScaleResult*> scale_results;
+        number_cruncher->calculate_stat_weights_for_dps(scale_results);
+        number_cruncher->calculate_stat_weights_for_tps(scale_results);
+
+        QJsonArray dps_weights;
+        QJsonArray tps_weights;
+        for (const auto& scale_result : scale_results) {
+            if (scale_result->for_dps) {
+                dps_weights.append(get_scale_result(scale_result));
+                stat_weights[scale_result->option] = scale_result->absolute_value;
+            }
+            else
+                tps_weights.append(get_scale_result(scale_result));
+        }
+        qDeleteAll(scale_results);
+
+        results["dps_stat_weights"] = dps_weights;
+        results["tps_stat_weights"] = tps_weights;
+    }
+
+    return results;
+}
+
+bool HeadlessSimControl::run_optimizers(QJsonObject& results) {
+    if (optimize_gear && !run_gear_optimizer(results))
+        return false;
+
+    return !optimize_talents || run_talent_optimizer(results);
+}
+
+bool HeadlessSimControl::run_gear_optimizer(QJsonObject& results) {
+    EvaluatorPool pool(equipment_db, random_affixes, sim_settings, setup_strings[0], sim_settings->get_num_threads_current());
+    if (!pool.successful()) {
+        print_error(QString("Failed to load setup for gear optimization: %1").arg(pool.get_error()));
+        return false;
+    }
+
+    GearOptimizer optimizer(equipment_db, &pool);
+    optimizer.set_stat_weights(stat_weights);
+    optimizer.set_iterations(sim_settings->get_combat_iterations_quick_sim());
+    optimizer.set_verify_iterations(4 * sim_settings->get_combat_iterations_quick_sim());
+    if (candidates_per_slot > 0)
+        optimizer.set_candidates_per_slot(candidates_per_slot);
+    if (max_rounds > 0)
+        optimizer.set_max_rounds(max_rounds);
+
+    QMap<int, QVector<int>>::const_iterator it = gear_candidates.constBegin();
+    while (it != gear_candidates.constEnd()) {
+        optimizer.set_candidates(it.key(), it.value());
+        ++it;
+    }
+
+    GearOptimizerResult result = optimizer.run();
+    if (!result.success) {
+        print_error(QString("Gear optimization failed: %1").arg(result.error));
+        return false;
+    }
+
+    QJsonArray swaps;
+    for (const auto& swap : result.swaps) {
+        QJsonObject swap_object;
+        swap_object["slot"] = GEAR_SLOT_KEYS[swap.equipment_slot];
+        swap_object["item_id"] = swap.item_id;
+        swap_object["name"] = swap.item_id != -1 ? equipment_db->get_name_for_item_id(swap.item_id) : QString();
+        swaps.append(swap_object);
+    }
+
+    QJsonObject gear_optimizer;
+    gear_optimizer["base_dps"] = result.base_dps;
+    gear_optimizer["best_dps"] = result.best_dps;
+    gear_optimizer["rounds"] = result.rounds;
+    gear_optimizer["evaluations"] = result.evaluations;
+    gear_optimizer["swaps"] = swaps;
+    gear_optimizer["setup"] = QJsonDocument::fromJson(result.best_setup_string.toUtf8()).object();
+    results["gear_optimizer"] = gear_optimizer;
+
+    return true;
+}
+
+bool HeadlessSimControl::run_talent_optimizer(QJsonObject& results) {
+    EvaluatorPool pool(equipment_db, random_affixes, sim_settings, setup_strings[0], sim_settings->get_num_threads_current());
+    if (!pool.successful()) {
+        print_error(QString("Failed to load setup for talent optimization: %1").arg(pool.get_error()));
+        return false;
+    }
+
+    TalentOptimizer optimizer(&pool);
+    optimizer.set_max_iterations(sim_settings->get_combat_iterations_quick_sim());
+    if (initial_iterations > 0)
+        optimizer.set_iterations(initial_iterations);
+    if (max_rounds > 0)
+        optimizer.set_max_rounds(max_rounds);
+
+    TalentOptimizerResult result = optimizer.run();
+    if (!result.success) {
+        print_error(QString("Talent optimization failed: %1").arg(result.error));
+        return false;
+    }
+
+    QJsonArray talents;
+    TalentBuild::const_iterator it = result.best_build.constBegin();
+    while (it != result.best_build.constEnd()) {
+        QJsonObject talent;
+        talent["tree"] = it.key().first;
+        talent["position"] = it.key().second;
+        talent["rank"] = it.value();
+        talents.append(talent);
+        ++it;
+    }
+
+    QJsonObject talent_optimizer;
+    talent_optimizer["base_dps"] = result.base_dps;
+    talent_optimizer["best_dps"] = result.best_dps;
+    talent_optimizer["rounds"] = result.rounds;
+    talent_optimizer["evaluations"] = result.evaluations;
+    talent_optimizer["talents"] = talents;
+    talent_optimizer["setup"] = QJsonDocument::fromJson(result.best_setup_string.toUtf8()).object();
+    results["talent_optimizer"] = talent_optimizer;
+
+    return true;
+}
+
+QJsonObject HeadlessSimControl::get_scale_result(const ScaleResult* scale_result) {
+    QJsonObject result;
+    result["option"] = QMetaEnum::fromType<SimOption::Name>().valueToKey(scale_result->option);
+    result["name"] = get_name_for_option(scale_result->option);
+    result["absolute"] = scale_result->absolute_value;
+    result["relative"] = scale_result->relative_value;
+    result["standard_deviation"] = scale_result->standard_deviation;
+    result["confidence_interval"] = scale_result->confidence_interval;
+    result["paired_confidence_interval"] = scale_result->paired_confidence_interval;
+
+    return result;
+}
+
+void HeadlessSimControl::print_error(const QString& error) {
+    QTextStream(stderr) << error << "\n";
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <QJsonObject>
+#include <QMap>
+#include <QObject>
+#include <QSet>
+#include <QVector>
+
+#include "SimOption.h"
+
+class EquipmentDb;
+class NumberCruncher;
+class QCoreApplication;
+class RandomAffixes;
+class ScaleResult;
+class SimSettings;
+class SimulationThreadPool;
+
+class HeadlessSimControl : public QObject {
+    Q_OBJECT
+public:
+    HeadlessSimControl(QObject* parent = nullptr);
+    ~HeadlessSimControl();
+
+    bool parse_arguments(const QCoreApplication& app);
+
+public slots:
+    void run();
+
+signals:
+    void finished(const int exit_code);
+
+private slots:
+    void compile_thread_results();
+    void record_simulation_error(const QString& error);
+
+private:
+    EquipmentDb* equipment_db;
+    RandomAffixes* random_affixes;
+    SimSettings* sim_settings;
+    NumberCruncher* number_cruncher;
+    SimulationThreadPool* thread_pool {nullptr};
+    QString simulation_error;
+
+    QVector<QString> setup_strings;
+    bool full_sim {false};
+
+    bool optimize_gear {false};
+    int candidates_per_slot {0};
+    int max_rounds {0};
+    QMap<int, QVector<int>> gear_candidates;
+    QMap<SimOption::Name, double> stat_weights;
+
+    bool optimize_talents {false};
+    int initial_iterations {0};
+
+    bool read_setups(const QJsonValue& value);
+    bool add_setup(const QJsonValue& value);
+    bool read_settings(const QJsonObject& settings);
+    bool set_sim_options(const QStringList& option_keys);
+    bool read_gear_candidates(const QJsonObject& candidates);
+    bool read_stat_weights(const QJsonObject& weights);
+
+    bool run_optimizers(QJsonObject& results);
+    bool run_gear_optimizer(QJsonObject& results);
+    bool run_talent_optimizer(QJsonObject& results);
+
+    QJsonObject get_results();
+
+    static QJsonObject get_scale_result(const ScaleResult* scale_result);
+    static void print_error(const QString& error);
+};
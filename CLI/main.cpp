@@ -0,0 +1,18 @@
+#include <QCoreApplication>
+#include <QTimer>
+
+#include "HeadlessSimControl.h"
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("ClassicSimCLI");
+
+    HeadlessSimControl sim_control;
+    if (!sim_control.parse_arguments(app))
+        return 1;
+
+    QObject::connect(&sim_control, &HeadlessSimControl::finished, &app, &QCoreApplication::exit);
+    QTimer::singleShot(0, &sim_control, &HeadlessSimControl::run);
+
+    return QCoreApplication::exec();
+}
@@ -19,6 +19,7 @@
 #include "ProcInfo.h"
 #include "Race.h"
 #include "RaidControl.h"
+#include "Rotation.h"
 #include "SimSettings.h"
 #include "Stats.h"
 #include "Target.h"
@@ -198,7 +199,7 @@ SimSettings* Character::get_sim_settings() const {
 }
 
 void Character::add_player_reaction_event() {
-    auto new_event = new PlayerAction(spells, engine->get_current_priority() + 0.1);
+    auto new_event = new (engine->get_event_pool()) PlayerAction(spells, engine->get_current_priority() + 0.1);
     engine->add_event(new_event);
 }
 
@@ -509,6 +510,11 @@ void Character::prepare_set_of_combat_iterations() {
     enabled_procs->prepare_set_of_combat_iterations();
 }
 
+void Character::finish_set_of_combat_iterations() {
+    spells->get_rotation()->finish_set_of_combat_iterations();
+    enabled_buffs->finish_set_of_combat_iterations();
+}
+
 void Character::set_special_statistics() {
     // Reset special statistics cases
     if (is_orc_warlock)
@@ -139,6 +139,7 @@ public:
 
     void reset();
     void prepare_set_of_combat_iterations();
+    void finish_set_of_combat_iterations();
 
     void gain_resource(const ResourceType resource_type, const unsigned value);
     void lose_resource(const ResourceType resource_type, const unsigned value);
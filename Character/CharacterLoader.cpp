@@ -390,22 +390,11 @@ void CharacterLoader::setup_target(CharacterDecoder& decoder) {
 }
 
 void CharacterLoader::select_rotation(CharacterDecoder& decoder, Character* pchar) {
-    QVector<Rotation*> new_rotations;
-    RotationFileReader::add_rotations(new_rotations);
-
     QString rotation_name = decoder.get_value("ROTATION", CharacterDecoder::MANDATORY);
 
-    for (const auto& rotation : new_rotations) {
-        if (rotation == nullptr)
-            continue;
-
-        if (pchar->class_name != rotation->get_class() || rotation->get_name() != rotation_name) {
-            delete rotation;
-            continue;
-        }
-
+    Rotation* rotation = RotationFileReader::get_rotation(pchar->class_name, rotation_name);
+    if (rotation != nullptr)
         pchar->get_spells()->set_rotation(rotation);
-    }
 
     if (pchar->get_spells()->get_rotation() == nullptr || pchar->get_spells()->get_rotation()->get_name() != rotation_name)
         fail("Failed to set rotation to " + rotation_name);
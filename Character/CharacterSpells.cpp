@@ -137,6 +137,7 @@ void CharacterSpells::add_spell(Spell* spell, bool relink) {
         spell->set_instance_id(pchar->get_raid_control()->next_instance_id());
 
     spells.append(spell);
+    spell->set_reset_queue(&spells_to_reset);
 
     if (relink)
         relink_spells();
@@ -148,6 +149,7 @@ void CharacterSpells::remove_spell(Spell* spell) {
         return;
 
     spell_rank_groups.remove(spell->get_name());
+    spell->set_reset_queue(nullptr);
     spells.erase(it);
 
     relink_spells();
@@ -162,13 +164,18 @@ void CharacterSpells::add_start_of_combat_spell(Spell* spell) {
 
 void CharacterSpells::remove_start_of_combat_spell(Spell* spell) {
     QVector<Spell*>::iterator it = std::find(spells.begin(), spells.end(), spell);
-    if (it != spells.end())
-        spells.erase(it);
+    if (it == spells.end())
+        return;
+
+    spell->set_reset_queue(nullptr);
+    spells.erase(it);
 }
 
 void CharacterSpells::run_start_of_combat_spells() {
-    for (const auto& spell : start_of_combat_spells)
+    for (const auto& spell : start_of_combat_spells) {
+        spell->request_reset();
         spell->perform_start_of_combat();
+    }
 }
 
 void CharacterSpells::add_spell_group(const QVector<Spell*> spell_group, const bool relink) {
@@ -206,8 +213,11 @@ void CharacterSpells::reset() {
     id_of_cast_in_progress = 0;
     attack_mode_active = false;
 
-    for (const auto& spell : spells)
-        spell->reset();
+    // Spells that were not used since the last reset are still in their reset state.
+    for (const auto& spell : spells_to_reset)
+        spell->reset_after_encounter();
+
+    spells_to_reset.clear();
 }
 
 void CharacterSpells::start_attack() {
@@ -325,8 +335,10 @@ void CharacterSpells::prepare_set_of_combat_iterations() {
     id_of_cast_in_progress = 0;
     attack_mode_active = false;
 
-    for (const auto& spell : spells)
+    for (const auto& spell : spells) {
         spell->prepare_set_of_combat_iterations();
+        spell->request_reset();
+    }
 
     if (rotation)
         rotation->prepare_set_of_combat_iterations();
@@ -84,6 +84,7 @@ protected:
     bool attack_mode_active;
     QVector<Spell*> spells;
     QVector<Spell*> start_of_combat_spells;
+    QVector<Spell*> spells_to_reset;
     QMap<QString, CooldownControl*> cooldown_controls;
     QMap<QString, SpellRankGroup*> spell_rank_groups;
 
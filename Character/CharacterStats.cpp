@@ -51,39 +51,22 @@ CharacterStats::CharacterStats(Character* pchar, EquipmentDb* equipment_db) : pc
     this->crit_dmg_bonuses_per_monster_type.insert(Target::CreatureType::Mechanical, 0);
     this->crit_dmg_bonuses_per_monster_type.insert(Target::CreatureType::Undead, 0);
 
-    this->magic_school_damage_changes.insert(MagicSchool::Arcane, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Fire, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Frost, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Holy, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Nature, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Physical, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Shadow, {});
-
-    this->magic_school_damage_modifiers.insert(MagicSchool::Arcane, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Fire, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Frost, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Holy, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Nature, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Physical, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Shadow, 1.0);
-
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Beast, {});
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Demon, {});
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Dragonkin, {});
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Elemental, {});
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Giant, {});
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Humanoid, {});
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Mechanical, {});
-    this->magic_damage_bonuses_per_monster_type.insert(Target::CreatureType::Undead, {});
-
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Beast, 1.0);
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Demon, 1.0);
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Dragonkin, 1.0);
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Elemental, 1.0);
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Giant, 1.0);
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Humanoid, 1.0);
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Mechanical, 1.0);
-    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Undead, 1.0);
+    this->magic_school_damage_modifiers.insert(MagicSchool::Arcane, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Fire, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Frost, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Holy, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Nature, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Physical, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Shadow, {});
+
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Beast, {});
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Demon, {});
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Dragonkin, {});
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Elemental, {});
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Giant, {});
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Humanoid, {});
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Mechanical, {});
+    this->magic_damage_mods_per_monster_type.insert(Target::CreatureType::Undead, {});
 }
 
 CharacterStats::~CharacterStats() {
@@ -96,8 +79,50 @@ Equipment* CharacterStats::get_equipment() const {
     return this->equipment;
 }
 
+bool CharacterStats::DerivedStatsKey::operator==(const DerivedStatsKey& rhs) const {
+    return version == rhs.version && base_stats_version == rhs.base_stats_version && aura_effects_version == rhs.aura_effects_version
+           && equipment_stats == rhs.equipment_stats && equipment_stats_version == rhs.equipment_stats_version && mainhand == rhs.mainhand
+           && offhand == rhs.offhand && race == rhs.race && clvl == rhs.clvl && target_stats == rhs.target_stats
+           && target_stats_version == rhs.target_stats_version && target_lvl == rhs.target_lvl && target_type == rhs.target_type;
+}
+
+void CharacterStats::invalidate_derived_stats() {
+    ++version;
+}
+
+CharacterStats::DerivedStatsKey CharacterStats::get_derived_stats_key() const {
+    const Stats* equipment_stats = equipment->get_stats();
+    const Target* target = pchar->get_target();
+
+    return {version,
+            base_stats->get_version(),
+            aura_effects->get_version(),
+            equipment_stats,
+            equipment_stats->get_version(),
+            equipment->get_mainhand(),
+            equipment->get_offhand(),
+            pchar->get_race(),
+            pchar->get_clvl(),
+            target->get_stats(),
+            target->get_stats()->get_version(),
+            target->get_lvl(),
+            target->get_creature_type()};
+}
+
+template <typename Calculate>
+unsigned CharacterStats::get_cached_stat(CachedStat& cached_stat, Calculate calculate) const {
+    const DerivedStatsKey key = get_derived_stats_key();
+    if (!cached_stat.valid || !(cached_stat.key == key)) {
+        cached_stat.value = calculate();
+        cached_stat.key = key;
+        cached_stat.valid = true;
+    }
+
+    return cached_stat.value;
+}
+
 unsigned CharacterStats::get_armor() const {
-    return static_cast<unsigned>(armor_mod * (base_stats->get_armor() + equipment->get_stats()->get_armor()) + get_agility() * 2);
+    return static_cast<unsigned>(armor_mod.get_modifier() * (base_stats->get_armor() + equipment->get_stats()->get_armor()) + get_agility() * 2);
 }
 
 unsigned CharacterStats::get_block_value() const {
@@ -105,28 +130,41 @@ unsigned CharacterStats::get_block_value() const {
 }
 
 unsigned CharacterStats::get_strength() const {
+    return get_cached_stat(cached_strength, [this]() { return calculate_strength(); });
+}
+
+unsigned CharacterStats::calculate_strength() const {
     return static_cast<unsigned>(
-        round(strength_mod * (base_stats->get_strength() + equipment->get_stats()->get_strength() + pchar->get_race()->get_base_strength())));
+        round(strength_mod.get_modifier()
+              * (base_stats->get_strength() + equipment->get_stats()->get_strength() + pchar->get_race()->get_base_strength())));
 }
 
 unsigned CharacterStats::get_agility() const {
+    return get_cached_stat(cached_agility, [this]() { return calculate_agility(); });
+}
+
+unsigned CharacterStats::calculate_agility() const {
     return static_cast<unsigned>(
-        round(agility_mod * (base_stats->get_agility() + equipment->get_stats()->get_agility() + pchar->get_race()->get_base_agility())));
+        round(agility_mod.get_modifier()
+              * (base_stats->get_agility() + equipment->get_stats()->get_agility() + pchar->get_race()->get_base_agility())));
 }
 
 unsigned CharacterStats::get_stamina() const {
     return static_cast<unsigned>(
-        round(stamina_mod * (base_stats->get_stamina() + equipment->get_stats()->get_stamina() + pchar->get_race()->get_base_stamina())));
+        round(stamina_mod.get_modifier()
+              * (base_stats->get_stamina() + equipment->get_stats()->get_stamina() + pchar->get_race()->get_base_stamina())));
 }
 
 unsigned CharacterStats::get_intellect() const {
     return static_cast<unsigned>(
-        round(intellect_mod * (base_stats->get_intellect() + equipment->get_stats()->get_intellect() + pchar->get_race()->get_base_intellect())));
+        round(intellect_mod.get_modifier()
+              * (base_stats->get_intellect() + equipment->get_stats()->get_intellect() + pchar->get_race()->get_base_intellect())));
 }
 
 unsigned CharacterStats::get_spirit() const {
     return static_cast<unsigned>(
-        round(spirit_mod * (base_stats->get_spirit() + equipment->get_stats()->get_spirit() + pchar->get_race()->get_base_spirit())));
+        round(spirit_mod.get_modifier()
+              * (base_stats->get_spirit() + equipment->get_stats()->get_spirit() + pchar->get_race()->get_base_spirit())));
 }
 
 unsigned CharacterStats::get_melee_hit_chance() const {
@@ -134,6 +172,10 @@ unsigned CharacterStats::get_melee_hit_chance() const {
 }
 
 unsigned CharacterStats::get_mh_crit_chance() const {
+    return get_cached_stat(cached_mh_crit_chance, [this]() { return calculate_mh_crit_chance(); });
+}
+
+unsigned CharacterStats::calculate_mh_crit_chance() const {
     const unsigned crit_from_agi = static_cast<unsigned>(
         round(static_cast<double>(get_agility()) / pchar->get_agi_needed_for_one_percent_phys_crit() * 100));
     const unsigned equip_effect = aura_effects->get_melee_crit_chance() + equipment->get_stats()->get_melee_crit_chance();
@@ -150,6 +192,10 @@ unsigned CharacterStats::get_mh_crit_chance() const {
 }
 
 unsigned CharacterStats::get_oh_crit_chance() const {
+    return get_cached_stat(cached_oh_crit_chance, [this]() { return calculate_oh_crit_chance(); });
+}
+
+unsigned CharacterStats::calculate_oh_crit_chance() const {
     if (equipment->get_offhand() == nullptr)
         return 0;
 
@@ -173,6 +219,10 @@ unsigned CharacterStats::get_ranged_hit_chance() const {
 }
 
 unsigned CharacterStats::get_ranged_crit_chance() const {
+    return get_cached_stat(cached_ranged_crit_chance, [this]() { return calculate_ranged_crit_chance(); });
+}
+
+unsigned CharacterStats::calculate_ranged_crit_chance() const {
     const unsigned equip_effect = base_stats->get_ranged_crit_chance() + equipment->get_stats()->get_ranged_crit_chance();
     const unsigned crit_from_agi = static_cast<unsigned>(
         round(static_cast<double>(get_agility()) / pchar->get_agi_needed_for_one_percent_phys_crit() * 100));
@@ -581,31 +631,31 @@ void CharacterStats::decrease_stat(const ItemStats stat_type, const unsigned val
 }
 
 void CharacterStats::increase_melee_attack_speed(const unsigned value) {
-    add_multiplicative_effect(melee_attack_speed_buffs, static_cast<int>(value), melee_attack_speed_mod);
+    melee_attack_speed_mod.add(static_cast<int>(value));
 }
 
 void CharacterStats::decrease_melee_attack_speed(const unsigned value) {
-    remove_multiplicative_effect(melee_attack_speed_buffs, static_cast<int>(value), melee_attack_speed_mod);
+    melee_attack_speed_mod.remove(static_cast<int>(value));
 }
 
 void CharacterStats::increase_ranged_attack_speed(const unsigned value) {
-    add_multiplicative_effect(ranged_attack_speed_buffs, static_cast<int>(value), ranged_attack_speed_mod);
+    ranged_attack_speed_mod.add(static_cast<int>(value));
 }
 
 void CharacterStats::decrease_ranged_attack_speed(const unsigned value) {
-    remove_multiplicative_effect(ranged_attack_speed_buffs, static_cast<int>(value), ranged_attack_speed_mod);
+    ranged_attack_speed_mod.remove(static_cast<int>(value));
 }
 
 double CharacterStats::get_casting_speed_mod() const {
-    return casting_speed_mod;
+    return casting_speed_mod.get_modifier();
 }
 
 void CharacterStats::increase_casting_speed_mod(const unsigned value) {
-    add_multiplicative_effect(casting_speed_buffs, static_cast<int>(value), casting_speed_mod);
+    casting_speed_mod.add(static_cast<int>(value));
 }
 
 void CharacterStats::decrease_casting_speed_mod(const unsigned value) {
-    remove_multiplicative_effect(casting_speed_buffs, static_cast<int>(value), casting_speed_mod);
+    casting_speed_mod.remove(static_cast<int>(value));
 }
 
 bool CharacterStats::casting_time_suppressed() const {
@@ -703,6 +753,10 @@ void CharacterStats::decrease_spirit(const unsigned value) {
 }
 
 unsigned CharacterStats::get_melee_ap() const {
+    return get_cached_stat(cached_melee_ap, [this]() { return calculate_melee_ap(); });
+}
+
+unsigned CharacterStats::calculate_melee_ap() const {
     unsigned stat_melee_ap = equipment->get_stats()->get_base_melee_ap() + base_stats->get_base_melee_ap();
     unsigned attributes_ap = get_strength() * pchar->get_melee_ap_per_strength() + get_agility() * pchar->get_melee_ap_per_agi();
     unsigned target_ap_eq = equipment->get_stats()->get_melee_ap_against_type(pchar->get_target()->get_creature_type());
@@ -711,7 +765,8 @@ unsigned CharacterStats::get_melee_ap() const {
     if (equipment->druid_is_in_feral_form()) {
         stat_feral_ap = equipment->get_stats()->get_base_feral_ap();
     }
-    return static_cast<unsigned>(round(total_ap_mod * (stat_melee_ap + attributes_ap + target_ap_eq + target_ap_base + stat_feral_ap)));
+    return static_cast<unsigned>(
+        round(total_ap_mod.get_modifier() * (stat_melee_ap + attributes_ap + target_ap_eq + target_ap_base + stat_feral_ap)));
 }
 
 void CharacterStats::increase_melee_ap(const unsigned value) {
@@ -731,12 +786,17 @@ void CharacterStats::decrease_feral_ap(const unsigned value) {
 }
 
 unsigned CharacterStats::get_ranged_ap() const {
+    return get_cached_stat(cached_ranged_ap, [this]() { return calculate_ranged_ap(); });
+}
+
+unsigned CharacterStats::calculate_ranged_ap() const {
     unsigned stat_ranged_ap = equipment->get_stats()->get_base_ranged_ap() + base_stats->get_base_ranged_ap();
     unsigned attributes_ap = get_agility() * pchar->get_ranged_ap_per_agi();
     unsigned target_ap_eq = equipment->get_stats()->get_ranged_ap_against_type(pchar->get_target()->get_creature_type());
     unsigned target_ap_base = base_stats->get_ranged_ap_against_type(pchar->get_target()->get_creature_type());
     unsigned target_debuff_ap = pchar->get_target()->get_stats()->get_base_ranged_ap();
-    return static_cast<unsigned>(round(total_ap_mod * (stat_ranged_ap + attributes_ap + target_ap_eq + target_ap_base + target_debuff_ap)));
+    return static_cast<unsigned>(
+        round(total_ap_mod.get_modifier() * (stat_ranged_ap + attributes_ap + target_ap_eq + target_ap_base + target_debuff_ap)));
 }
 
 void CharacterStats::increase_ranged_ap(const unsigned value) {
@@ -782,11 +842,11 @@ void CharacterStats::decrease_spell_damage_vs_type(const Target::CreatureType ta
 }
 
 void CharacterStats::increase_magic_damage_mod_vs_type(const Target::CreatureType target_type, const int value) {
-    add_multiplicative_effect(magic_damage_bonuses_per_monster_type[target_type], value, magic_damage_mods_per_monster_type[target_type]);
+    magic_damage_mods_per_monster_type[target_type].add(value);
 }
 
 void CharacterStats::decrease_magic_damage_mod_vs_type(const Target::CreatureType target_type, const int value) {
-    remove_multiplicative_effect(magic_damage_bonuses_per_monster_type[target_type], value, magic_damage_mods_per_monster_type[target_type]);
+    magic_damage_mods_per_monster_type[target_type].remove(value);
 }
 
 double CharacterStats::get_total_physical_damage_mod() const {
@@ -809,27 +869,27 @@ double CharacterStats::get_total_physical_damage_mod() const {
 
     double dmg_bonus_from_monster_type = 1.0 + damage_bonuses_per_monster_type[pchar->get_target()->get_creature_type()];
 
-    return total_phys_dmg_mod * dmg_bonus_from_wpn_type * dmg_bonus_from_monster_type;
+    return total_phys_dmg_mod.get_modifier() * dmg_bonus_from_wpn_type * dmg_bonus_from_monster_type;
 }
 
 double CharacterStats::get_total_threat_mod() const {
-    return total_threat_mod;
+    return total_threat_mod.get_modifier();
 }
 
 double CharacterStats::get_melee_attack_speed_mod() const {
-    return melee_attack_speed_mod;
+    return melee_attack_speed_mod.get_modifier();
 }
 
 double CharacterStats::get_ranged_attack_speed_mod() const {
-    return ranged_attack_speed_mod;
+    return ranged_attack_speed_mod.get_modifier();
 }
 
 double CharacterStats::get_physical_damage_taken_mod() const {
-    return physical_damage_taken_mod;
+    return physical_damage_taken_mod.get_modifier();
 }
 
 double CharacterStats::get_spell_damage_taken_mod() const {
-    return spell_damage_taken_mod;
+    return spell_damage_taken_mod.get_modifier();
 }
 
 void CharacterStats::increase_melee_hit(const unsigned value) {
@@ -879,10 +939,12 @@ void CharacterStats::decrease_ranged_crit(const unsigned value) {
 }
 
 void CharacterStats::increase_crit_for_weapon_type(const int weapon_type, const unsigned value) {
+    invalidate_derived_stats();
     crit_bonuses_per_weapon_type[weapon_type] += value;
 }
 
 void CharacterStats::decrease_crit_for_weapon_type(const int weapon_type, const unsigned value) {
+    invalidate_derived_stats();
     crit_bonuses_per_weapon_type[weapon_type] -= value;
 }
 
@@ -984,35 +1046,35 @@ void CharacterStats::decrease_spell_crit_dmg_mod(const double value) {
 }
 
 void CharacterStats::increase_total_phys_dmg_mod(const int increase) {
-    add_multiplicative_effect(phys_dmg_buffs, increase, total_phys_dmg_mod);
+    total_phys_dmg_mod.add(increase);
 }
 
 void CharacterStats::decrease_total_phys_dmg_mod(const int decrease) {
-    remove_multiplicative_effect(phys_dmg_buffs, decrease, total_phys_dmg_mod);
+    total_phys_dmg_mod.remove(decrease);
 }
 
 void CharacterStats::increase_total_threat_mod(const int increase) {
-    add_multiplicative_effect(threat_buffs, increase, total_threat_mod);
+    total_threat_mod.add(increase);
 }
 
 void CharacterStats::decrease_total_threat_mod(const int decrease) {
-    remove_multiplicative_effect(threat_buffs, decrease, total_threat_mod);
+    total_threat_mod.remove(decrease);
 }
 
 void CharacterStats::add_phys_damage_taken_mod(const int mod) {
-    add_multiplicative_effect(phys_damage_taken_changes, mod, physical_damage_taken_mod);
+    physical_damage_taken_mod.add(mod);
 }
 
 void CharacterStats::remove_phys_damage_taken_mod(const int mod) {
-    remove_multiplicative_effect(phys_damage_taken_changes, mod, physical_damage_taken_mod);
+    physical_damage_taken_mod.remove(mod);
 }
 
 void CharacterStats::add_spell_damage_taken_mod(const int mod) {
-    add_multiplicative_effect(spell_damage_taken_changes, mod, spell_damage_taken_mod);
+    spell_damage_taken_mod.add(mod);
 }
 
 void CharacterStats::remove_spell_damage_taken_mod(const int mod) {
-    remove_multiplicative_effect(spell_damage_taken_changes, mod, spell_damage_taken_mod);
+    spell_damage_taken_mod.remove(mod);
 }
 
 void CharacterStats::add_total_stat_mod(const int mod) {
@@ -1032,71 +1094,78 @@ void CharacterStats::remove_total_stat_mod(const int mod) {
 }
 
 void CharacterStats::add_ap_multiplier(const int mod) {
-    add_multiplicative_effect(ap_total_multipliers, mod, total_ap_mod);
+    invalidate_derived_stats();
+    total_ap_mod.add(mod);
 }
 
 void CharacterStats::remove_ap_multiplier(const int mod) {
-    remove_multiplicative_effect(ap_total_multipliers, mod, total_ap_mod);
+    invalidate_derived_stats();
+    total_ap_mod.remove(mod);
 }
 
 void CharacterStats::add_agility_mod(const int mod) {
-    add_multiplicative_effect(agility_mod_changes, mod, agility_mod);
+    invalidate_derived_stats();
+    agility_mod.add(mod);
 }
 
 void CharacterStats::remove_agility_mod(const int mod) {
-    remove_multiplicative_effect(agility_mod_changes, mod, agility_mod);
+    invalidate_derived_stats();
+    agility_mod.remove(mod);
 }
 
 void CharacterStats::add_intellect_mod(const int mod) {
-    add_multiplicative_effect(intellect_mod_changes, mod, intellect_mod);
+    intellect_mod.add(mod);
 }
 
 void CharacterStats::remove_intellect_mod(const int mod) {
-    remove_multiplicative_effect(intellect_mod_changes, mod, intellect_mod);
+    intellect_mod.remove(mod);
 }
 
 void CharacterStats::add_spirit_mod(const int mod) {
-    add_multiplicative_effect(spirit_mod_changes, mod, spirit_mod);
+    spirit_mod.add(mod);
 }
 
 void CharacterStats::remove_spirit_mod(const int mod) {
-    remove_multiplicative_effect(spirit_mod_changes, mod, spirit_mod);
+    spirit_mod.remove(mod);
 }
 
 void CharacterStats::add_stamina_mod(const int mod) {
-    add_multiplicative_effect(stamina_mod_changes, mod, stamina_mod);
+    stamina_mod.add(mod);
 }
 
 void CharacterStats::remove_stamina_mod(const int mod) {
-    remove_multiplicative_effect(stamina_mod_changes, mod, stamina_mod);
+    stamina_mod.remove(mod);
 }
 
 void CharacterStats::add_strength_mod(const int mod) {
-    add_multiplicative_effect(strength_mod_changes, mod, strength_mod);
+    invalidate_derived_stats();
+    strength_mod.add(mod);
 }
 
 void CharacterStats::remove_strength_mod(const int mod) {
-    remove_multiplicative_effect(strength_mod_changes, mod, strength_mod);
+    invalidate_derived_stats();
+    strength_mod.remove(mod);
 }
 
 void CharacterStats::add_armor_mod(const int mod) {
-    add_multiplicative_effect(armor_mod_changes, mod, armor_mod);
+    armor_mod.add(mod);
 }
 
 void CharacterStats::remove_armor_mod(const int mod) {
-    remove_multiplicative_effect(armor_mod_changes, mod, armor_mod);
+    armor_mod.remove(mod);
 }
 
 double CharacterStats::get_mh_wpn_speed() {
-    return pchar->has_mainhand() ? equipment->get_mainhand()->get_base_weapon_speed() / melee_attack_speed_mod : 2.0 / melee_attack_speed_mod;
+    return pchar->has_mainhand() ? equipment->get_mainhand()->get_base_weapon_speed() / melee_attack_speed_mod.get_modifier() :
+                                   2.0 / melee_attack_speed_mod.get_modifier();
 }
 
 double CharacterStats::get_oh_wpn_speed() {
-    return pchar->has_offhand() ? equipment->get_offhand()->get_base_weapon_speed() / melee_attack_speed_mod : 300;
+    return pchar->has_offhand() ? equipment->get_offhand()->get_base_weapon_speed() / melee_attack_speed_mod.get_modifier() : 300;
 }
 
 double CharacterStats::get_ranged_wpn_speed() {
-    return pchar->has_ranged() ? equipment->get_ranged()->get_base_weapon_speed() / ranged_attack_speed_mod : 300;
+    return pchar->has_ranged() ? equipment->get_ranged()->get_base_weapon_speed() / ranged_attack_speed_mod.get_modifier() : 300;
 }
 
 void CharacterStats::increase_dodge(const double value) {
@@ -1178,8 +1247,8 @@ void CharacterStats::decrease_spell_penetration(const MagicSchool school, const
 }
 
 double CharacterStats::get_magic_school_damage_mod(const MagicSchool school, const ConsumeCharge consume_charge) const {
-    return magic_school_damage_modifiers[school] * pchar->get_target()->get_magic_school_damage_mod(school, consume_charge)
-           * magic_damage_mods_per_monster_type[pchar->get_target()->get_creature_type()];
+    return magic_school_damage_modifiers.constFind(school)->get_modifier() * pchar->get_target()->get_magic_school_damage_mod(school, consume_charge)
+           * magic_damage_mods_per_monster_type.constFind(pchar->get_target()->get_creature_type())->get_modifier();
 }
 
 void CharacterStats::increase_magic_school_damage_mod(const unsigned increase) {
@@ -1201,11 +1270,11 @@ void CharacterStats::decrease_magic_school_damage_mod(const unsigned decrease) {
 }
 
 void CharacterStats::increase_magic_school_damage_mod(const unsigned increase, const MagicSchool school) {
-    add_multiplicative_effect(magic_school_damage_changes[school], static_cast<int>(increase), magic_school_damage_modifiers[school]);
+    magic_school_damage_modifiers[school].add(static_cast<int>(increase));
 }
 
 void CharacterStats::decrease_magic_school_damage_mod(const unsigned decrease, const MagicSchool school) {
-    remove_multiplicative_effect(magic_school_damage_changes[school], static_cast<int>(decrease), magic_school_damage_modifiers[school]);
+    magic_school_damage_modifiers[school].remove(static_cast<int>(decrease));
 }
 
 unsigned CharacterStats::get_mh_weapon_damage_bonus() const {
@@ -1274,31 +1343,10 @@ void CharacterStats::decrease_mana_skill_reduction(const unsigned value) {
 }
 
 void CharacterStats::increase_crit_penalty(const unsigned value) {
+    invalidate_derived_stats();
     crit_penalty += value;
 }
 
-void CharacterStats::add_multiplicative_effect(QVector<int>& effects, const int add_value, double& modifier) {
-    effects.append(add_value);
-
-    recalculate_multiplicative_effects(effects, modifier);
-}
-
-void CharacterStats::remove_multiplicative_effect(QVector<int>& effects, const int remove_value, double& modifier) {
-    check(effects.removeOne(remove_value), "Failed to remove multiplicative effect");
-
-    recalculate_multiplicative_effects(effects, modifier);
-}
-
-void CharacterStats::recalculate_multiplicative_effects(const QVector<int>& effects, double& modifier) {
-    modifier = 1.0;
-    for (int effect : effects) {
-        double coefficient = 1.0 + double(effect) / 100;
-        modifier = modifier * coefficient;
-    }
-
-    check((modifier > 0), "Modifier negative");
-}
-
 Target::CreatureType CharacterStats::get_type_for_stat(const ItemStats stats) {
     switch (stats) {
     case ItemStats::APVersusBeast:
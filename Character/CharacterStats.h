@@ -5,6 +5,7 @@
 
 #include "ItemStatsEnum.h"
 #include "Target.h"
+#include "Utils/ModifierStack.h"
 
 class Buff;
 class Character;
@@ -21,10 +22,6 @@ public:
 
     Equipment* get_equipment() const;
 
-    static void add_multiplicative_effect(QVector<int>& effects, const int add_value, double& modifier);
-    static void remove_multiplicative_effect(QVector<int>& effects, const int remove_value, double& modifier);
-    static void recalculate_multiplicative_effects(const QVector<int>& effects, double& modifier);
-
     unsigned get_mh_wpn_skill() const;
     unsigned get_oh_wpn_skill() const;
     unsigned get_ranged_wpn_skill() const;
@@ -251,34 +248,49 @@ public:
 
     void increase_crit_penalty(const unsigned value);
 
+    // Must be called when an input to the cached derived stats changes outside of CharacterStats, Stats, Equipment and
+    // Target, e.g. when a druid shifts form and thereby changes the attack power gained per agility.
+    void invalidate_derived_stats();
+
 private:
+    // Everything the cached derived stats (attributes, crit chances, attack power) depend on. The snapshots are
+    // recomputed whenever the key differs, so stat changes only cost a version bump instead of a recalculation
+    // on every swing.
+    struct DerivedStatsKey {
+        unsigned version;
+        unsigned base_stats_version;
+        unsigned aura_effects_version;
+        const Stats* equipment_stats;
+        unsigned equipment_stats_version;
+        const Weapon* mainhand;
+        const Weapon* offhand;
+        const Race* race;
+        unsigned clvl;
+        const Stats* target_stats;
+        unsigned target_stats_version;
+        unsigned target_lvl;
+        Target::CreatureType target_type;
+
+        bool operator==(const DerivedStatsKey& rhs) const;
+    };
+
+    struct CachedStat {
+        DerivedStatsKey key;
+        unsigned value;
+        bool valid {false};
+    };
+
     Character* pchar;
     Equipment* equipment;
     Stats* aura_effects;
     Stats* base_stats;
-    QVector<int> melee_attack_speed_buffs;
-    QVector<int> ranged_attack_speed_buffs;
-    QVector<int> casting_speed_buffs;
-    QVector<int> phys_dmg_buffs;
-    QVector<int> threat_buffs;
-    QVector<int> phys_damage_taken_changes;
-    QVector<int> spell_damage_taken_changes;
-    QVector<int> ap_total_multipliers;
-    QVector<int> agility_mod_changes;
-    QVector<int> intellect_mod_changes;
-    QVector<int> spirit_mod_changes;
-    QVector<int> stamina_mod_changes;
-    QVector<int> strength_mod_changes;
-    QVector<int> armor_mod_changes;
     QVector<Buff*> casting_time_suppression_buffs;
     QHash<int, unsigned> crit_bonuses_per_weapon_type;
     QHash<int, int> damage_bonuses_per_weapon_type;
     QHash<Target::CreatureType, double> damage_bonuses_per_monster_type;
     QHash<Target::CreatureType, double> crit_dmg_bonuses_per_monster_type;
-    QMap<Target::CreatureType, double> magic_damage_mods_per_monster_type;
-    QMap<Target::CreatureType, QVector<int>> magic_damage_bonuses_per_monster_type;
-    QMap<MagicSchool, QVector<int>> magic_school_damage_changes;
-    QMap<MagicSchool, double> magic_school_damage_modifiers;
+    QMap<Target::CreatureType, ModifierStack> magic_damage_mods_per_monster_type;
+    QMap<MagicSchool, ModifierStack> magic_school_damage_modifiers;
 
     unsigned mh_weapon_dmg_bonus {0};
     unsigned oh_weapon_dmg_bonus {0};
@@ -296,20 +308,41 @@ private:
     double melee_ability_crit_dmg_mod {2.0};
     double ranged_ability_crit_dmg_mod {2.0};
     double spell_crit_dmg_mod {1.5};
-    double melee_attack_speed_mod {1.0};
-    double ranged_attack_speed_mod {1.0};
-    double casting_speed_mod {1.0};
-    double total_phys_dmg_mod {1.0};
-    double total_threat_mod {1.0};
-    double physical_damage_taken_mod {1.0};
-    double spell_damage_taken_mod {1.0};
-    double total_ap_mod {1.0};
-    double agility_mod {1.0};
-    double intellect_mod {1.0};
-    double spirit_mod {1.0};
-    double stamina_mod {1.0};
-    double strength_mod {1.0};
-    double armor_mod {1.0};
+    ModifierStack melee_attack_speed_mod;
+    ModifierStack ranged_attack_speed_mod;
+    ModifierStack casting_speed_mod;
+    ModifierStack total_phys_dmg_mod;
+    ModifierStack total_threat_mod;
+    ModifierStack physical_damage_taken_mod;
+    ModifierStack spell_damage_taken_mod;
+    ModifierStack total_ap_mod;
+    ModifierStack agility_mod;
+    ModifierStack intellect_mod;
+    ModifierStack spirit_mod;
+    ModifierStack stamina_mod;
+    ModifierStack strength_mod;
+    ModifierStack armor_mod;
+
+    unsigned version {0};
+    mutable CachedStat cached_strength;
+    mutable CachedStat cached_agility;
+    mutable CachedStat cached_mh_crit_chance;
+    mutable CachedStat cached_oh_crit_chance;
+    mutable CachedStat cached_ranged_crit_chance;
+    mutable CachedStat cached_melee_ap;
+    mutable CachedStat cached_ranged_ap;
+
+    DerivedStatsKey get_derived_stats_key() const;
+    template <typename Calculate>
+    unsigned get_cached_stat(CachedStat& cached_stat, Calculate calculate) const;
+
+    unsigned calculate_strength() const;
+    unsigned calculate_agility() const;
+    unsigned calculate_mh_crit_chance() const;
+    unsigned calculate_oh_crit_chance() const;
+    unsigned calculate_ranged_crit_chance() const;
+    unsigned calculate_melee_ap() const;
+    unsigned calculate_ranged_ap() const;
 
     Target::CreatureType get_type_for_stat(const ItemStats);
 
@@ -25,12 +25,18 @@ void EnabledBuffs::remove_buff(Buff* buff, QVector<Buff*>& buffs) {
 void EnabledBuffs::add_buff(Buff* buff) {
     check(buff->is_enabled(), QString("Expected buff '%1' to be enabled").arg(buff->name).toStdString());
     enabled_buffs.append(buff);
+    buff->set_reset_queue(&buffs_to_reset);
 
     if (buff->get_instance_id() == InstanceID::INACTIVE)
         buff->set_instance_id(pchar->get_raid_control()->next_instance_id());
 }
 
 void EnabledBuffs::remove_buff(Buff* buff) {
+    for (const auto& enabled_buff : enabled_buffs) {
+        if (enabled_buff->get_instance_id() == buff->get_instance_id())
+            enabled_buff->set_reset_queue(nullptr);
+    }
+
     remove_buff(buff, enabled_buffs);
 }
 
@@ -83,13 +89,18 @@ void EnabledBuffs::return_shared_buff(Buff* shared_buff) {
 }
 
 void EnabledBuffs::reset() {
-    for (const auto& buff : enabled_buffs)
-        buff->reset();
+    ++num_encounters;
+
+    for (const auto& buff : buffs_to_reset)
+        buff->reset_after_encounter(num_encounters);
+
+    buffs_to_reset.clear();
 }
 
 void EnabledBuffs::clear_all() {
     while (!enabled_buffs.empty()) {
         Buff* buff = enabled_buffs.takeFirst();
+        buff->set_reset_queue(nullptr);
         buff->cancel_buff();
         buff->disable_buff();
     }
@@ -150,6 +161,17 @@ QVector<QString> EnabledBuffs::get_active_external_debuffs() {
 }
 
 void EnabledBuffs::prepare_set_of_combat_iterations() {
-    for (const auto& buff : enabled_buffs)
+    num_encounters = 0;
+
+    for (const auto& buff : enabled_buffs) {
         buff->prepare_set_of_combat_iterations();
+        buff->set_reset_queue(&buffs_to_reset);
+    }
+}
+
+void EnabledBuffs::finish_set_of_combat_iterations() {
+    for (const auto& buff : enabled_buffs)
+        buff->finish_set_of_combat_iterations(num_encounters);
+
+    num_encounters = 0;
 }
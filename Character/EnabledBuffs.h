@@ -28,6 +28,7 @@ public:
     void reset();
     void clear_all();
     void prepare_set_of_combat_iterations();
+    void finish_set_of_combat_iterations();
 
     void add_start_of_combat_buff(Buff* buff);
     void remove_start_of_combat_buff(Buff* buff);
@@ -43,6 +44,8 @@ private:
     QVector<Buff*> enabled_buffs;
     QVector<Buff*> alliance_only_buffs;
     QVector<Buff*> horde_only_buffs;
+    QVector<Buff*> buffs_to_reset;
+    int num_encounters {0};
 
     void remove_buff(Buff* buff, QVector<Buff*>& buffs);
 };
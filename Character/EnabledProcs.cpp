@@ -14,7 +14,7 @@ EnabledProcs::~EnabledProcs() {
 }
 
 void EnabledProcs::ignore_proc_in_next_proc_check(const int instance_id) {
-    procced_instance_ids.insert(instance_id);
+    set_procced(instance_id);
 }
 
 void EnabledProcs::run_proc_check(ProcInfo::Source source) {
@@ -22,10 +22,8 @@ void EnabledProcs::run_proc_check(ProcInfo::Source source) {
 
     ++procs_in_progress;
 
-    for (const auto& proc : enabled_procs) {
-        if (!proc->procs_from_source(source))
-            continue;
-        if (procced_instance_ids.contains(proc->get_instance_id()))
+    for (const auto& proc : enabled_procs_by_source[source]) {
+        if (has_procced(proc->get_instance_id()))
             continue;
 
         proc->set_current_proc_source(source);
@@ -33,18 +31,24 @@ void EnabledProcs::run_proc_check(ProcInfo::Source source) {
         if (!proc->check_proc_success())
             continue;
 
-        procced_instance_ids.insert(proc->get_instance_id());
+        set_procced(proc->get_instance_id());
         proc->perform();
     }
 
     --procs_in_progress;
 
     if (procs_in_progress == 0)
-        procced_instance_ids.clear();
+        clear_procced();
 }
 
 void EnabledProcs::add_proc(Proc* proc) {
     enabled_procs.append(proc);
+    proc->set_reset_queue(&procs_to_reset);
+
+    for (int source = 0; source < NUM_CHECKED_SOURCES; ++source) {
+        if (proc->procs_from_source(static_cast<ProcInfo::Source>(source)))
+            enabled_procs_by_source[static_cast<size_t>(source)].append(proc);
+    }
 
     if (proc->get_instance_id() == ProcStatus::INACTIVE) {
         proc->set_instance_id(next_instance_id);
@@ -56,9 +60,20 @@ void EnabledProcs::remove_proc_effect(const int instance_id) {
     if (instance_id == ProcStatus::INACTIVE)
         return;
 
+    for (auto& procs : enabled_procs_by_source) {
+        for (int i = 0; i < procs.size(); ++i) {
+            if (procs.at(i)->get_instance_id() == instance_id) {
+                procs.removeAt(i);
+                break;
+            }
+        }
+    }
+
     for (int i = 0; i < enabled_procs.size(); ++i) {
-        if (enabled_procs.at(i)->get_instance_id() == instance_id)
+        if (enabled_procs.at(i)->get_instance_id() == instance_id) {
+            enabled_procs.at(i)->set_reset_queue(nullptr);
             return enabled_procs.removeAt(i);
+        }
     }
 }
 
@@ -68,10 +83,13 @@ void EnabledProcs::clear_all() {
 }
 
 void EnabledProcs::reset() {
-    for (const auto& proc : enabled_procs)
-        proc->reset();
+    // Procs that have not procced since the last reset are still in their reset state.
+    for (const auto& proc : procs_to_reset)
+        proc->reset_after_encounter();
+
+    procs_to_reset.clear();
 
-    procced_instance_ids.clear();
+    clear_procced();
 }
 
 void EnabledProcs::switch_faction() {
@@ -79,8 +97,10 @@ void EnabledProcs::switch_faction() {
 }
 
 void EnabledProcs::prepare_set_of_combat_iterations() {
-    for (const auto& proc : enabled_procs)
+    for (const auto& proc : enabled_procs) {
         proc->prepare_set_of_combat_iterations();
+        proc->request_reset();
+    }
 }
 
 bool EnabledProcs::proc_enabled(Proc* proc) const {
@@ -90,3 +110,25 @@ bool EnabledProcs::proc_enabled(Proc* proc) const {
 
     return false;
 }
+
+void EnabledProcs::set_procced(const int instance_id) {
+    if (instance_id < 0)
+        return;
+
+    if (instance_id >= procced_instance_ids.size())
+        procced_instance_ids.resize(instance_id + 1);
+
+    procced_instance_ids.setBit(instance_id);
+    procced_instance_ids_to_clear.append(instance_id);
+}
+
+bool EnabledProcs::has_procced(const int instance_id) const {
+    return instance_id >= 0 && instance_id < procced_instance_ids.size() && procced_instance_ids.testBit(instance_id);
+}
+
+void EnabledProcs::clear_procced() {
+    for (const auto& instance_id : procced_instance_ids_to_clear)
+        procced_instance_ids.clearBit(instance_id);
+
+    procced_instance_ids_to_clear.clear();
+}
@@ -1,13 +1,15 @@
 #pragma once
 
-#include <QSet>
+#include <QBitArray>
 #include <QVector>
+#include <array>
 
 #include "ProcInfo.h"
 
 class Character;
 class GeneralProcs;
 class Proc;
+class Spell;
 class Engine;
 class CombatRoll;
 class Faction;
@@ -44,6 +46,18 @@ private:
     int next_instance_id;
     int procs_in_progress {0};
 
+    // Manual procs are performed directly and never checked, so they get no bucket.
+    static const int NUM_CHECKED_SOURCES = ProcInfo::Source::Manual;
+
     QVector<Proc*> enabled_procs;
-    QSet<int> procced_instance_ids;
+    std::array<QVector<Proc*>, NUM_CHECKED_SOURCES> enabled_procs_by_source;
+    QVector<Spell*> procs_to_reset;
+
+    // Indexed by instance id. The ids set during the current proc check are kept so only those bits need clearing.
+    QBitArray procced_instance_ids;
+    QVector<int> procced_instance_ids_to_clear;
+
+    void set_procced(const int instance_id);
+    bool has_procced(const int instance_id) const;
+    void clear_procced();
 };
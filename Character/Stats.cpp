@@ -42,6 +42,7 @@ Stats::Stats() {
 }
 
 void Stats::add(const QString& key, const QString& value) {
+    ++version;
     if (key == "STRENGTH") {
         this->increase_strength(value.toUInt());
         this->base_tooltip.append(QString("+%1 Strength").arg(value));
@@ -243,6 +244,7 @@ void Stats::add(const QString& key, const QString& value) {
 }
 
 void Stats::add(const Stats* rhs) {
+    ++version;
     increase_strength(rhs->get_strength());
     increase_agility(rhs->get_agility());
     increase_stamina(rhs->get_stamina());
@@ -338,6 +340,7 @@ void Stats::add(const Stats* rhs) {
 }
 
 void Stats::remove(const Stats* rhs) {
+    ++version;
     decrease_strength(rhs->get_strength());
     decrease_agility(rhs->get_agility());
     decrease_stamina(rhs->get_stamina());
@@ -461,130 +464,162 @@ unsigned Stats::get_block_value() const {
 }
 
 void Stats::increase_strength(const unsigned increase) {
+    ++version;
     strength += increase;
 }
 
 void Stats::decrease_strength(const unsigned decrease) {
+    ++version;
     strength -= decrease;
 }
 
 void Stats::increase_agility(const unsigned increase) {
+    ++version;
     agility += increase;
 }
 
 void Stats::decrease_agility(const unsigned decrease) {
+    ++version;
     agility -= decrease;
 }
 
 void Stats::increase_stamina(const unsigned increase) {
+    ++version;
     stamina += increase;
 }
 
 void Stats::decrease_stamina(const unsigned decrease) {
+    ++version;
     stamina -= decrease;
 }
 
 void Stats::increase_intellect(const unsigned increase) {
+    ++version;
     intellect += increase;
 }
 
 void Stats::decrease_intellect(const unsigned decrease) {
+    ++version;
     intellect -= decrease;
 }
 
 void Stats::increase_spirit(const unsigned increase) {
+    ++version;
     spirit += increase;
 }
 
 void Stats::decrease_spirit(const unsigned decrease) {
+    ++version;
     spirit -= decrease;
 }
 
 void Stats::increase_armor(const int increase) {
+    ++version;
     armor += increase;
 }
 
 void Stats::decrease_armor(const int decrease) {
+    ++version;
     armor -= decrease;
 }
 
 void Stats::increase_block_value(const int increase) {
+    ++version;
     block_value += increase;
 }
 
 void Stats::decrease_block_value(const int decrease) {
+    ++version;
     block_value -= decrease;
 }
 
 void Stats::increase_defense(const int increase) {
+    ++version;
     defense += increase;
 }
 
 void Stats::decrease_defense(const int decrease) {
+    ++version;
     defense -= decrease;
 }
 
 void Stats::increase_dodge(const double increase) {
+    ++version;
     dodge_chance += increase;
 }
 
 void Stats::decrease_dodge(const double decrease) {
+    ++version;
     dodge_chance -= decrease;
 }
 
 void Stats::increase_parry(const double increase) {
+    ++version;
     parry_chance += increase;
 }
 
 void Stats::decrease_parry(const double decrease) {
+    ++version;
     parry_chance -= decrease;
 }
 
 void Stats::increase_arcane_resistance(const int increase) {
+    ++version;
     arcane_res += increase;
 }
 
 void Stats::decrease_arcane_resistance(const int decrease) {
+    ++version;
     arcane_res -= decrease;
 }
 
 void Stats::increase_fire_resistance(const int increase) {
+    ++version;
     fire_res += increase;
 }
 
 void Stats::decrease_fire_resistance(const int decrease) {
+    ++version;
     fire_res -= decrease;
 }
 
 void Stats::increase_frost_resistance(const int increase) {
+    ++version;
     frost_res += increase;
 }
 
 void Stats::decrease_frost_resistance(const int decrease) {
+    ++version;
     frost_res -= decrease;
 }
 
 void Stats::increase_holy_resistance(const int increase) {
+    ++version;
     holy_res += increase;
 }
 
 void Stats::decrease_holy_resistance(const int decrease) {
+    ++version;
     holy_res -= decrease;
 }
 
 void Stats::increase_nature_resistance(const int increase) {
+    ++version;
     nature_res += increase;
 }
 
 void Stats::decrease_nature_resistance(const int decrease) {
+    ++version;
     nature_res -= decrease;
 }
 
 void Stats::increase_shadow_resistance(const int increase) {
+    ++version;
     shadow_res += increase;
 }
 
 void Stats::decrease_shadow_resistance(const int decrease) {
+    ++version;
     shadow_res -= decrease;
 }
 
@@ -593,9 +628,11 @@ unsigned Stats::get_axe_skill() const {
 }
 
 void Stats::increase_axe_skill(const unsigned value) {
+    ++version;
     axe_skill += value;
 }
 void Stats::decrease_axe_skill(const unsigned value) {
+    ++version;
     axe_skill -= value;
 }
 
@@ -604,10 +641,12 @@ unsigned Stats::get_dagger_skill() const {
 }
 
 void Stats::increase_dagger_skill(const unsigned value) {
+    ++version;
     dagger_skill += value;
 }
 
 void Stats::decrease_dagger_skill(const unsigned value) {
+    ++version;
     dagger_skill -= value;
 }
 
@@ -616,10 +655,12 @@ unsigned Stats::get_fist_skill() const {
 }
 
 void Stats::increase_fist_skill(const unsigned value) {
+    ++version;
     fist_skill += value;
 }
 
 void Stats::decrease_fist_skill(const unsigned value) {
+    ++version;
     fist_skill -= value;
 }
 
@@ -628,10 +669,12 @@ unsigned Stats::get_mace_skill() const {
 }
 
 void Stats::increase_mace_skill(const unsigned value) {
+    ++version;
     mace_skill += value;
 }
 
 void Stats::decrease_mace_skill(const unsigned value) {
+    ++version;
     mace_skill -= value;
 }
 
@@ -640,10 +683,12 @@ unsigned Stats::get_sword_skill() const {
 }
 
 void Stats::increase_sword_skill(const unsigned value) {
+    ++version;
     sword_skill += value;
 }
 
 void Stats::decrease_sword_skill(const unsigned value) {
+    ++version;
     sword_skill -= value;
 }
 
@@ -652,9 +697,11 @@ unsigned Stats::get_twohand_axe_skill() const {
 }
 
 void Stats::increase_twohand_axe_skill(const unsigned value) {
+    ++version;
     twohand_axe_skill += value;
 }
 void Stats::decrease_twohand_axe_skill(const unsigned value) {
+    ++version;
     twohand_axe_skill -= value;
 }
 
@@ -663,10 +710,12 @@ unsigned Stats::get_twohand_mace_skill() const {
 }
 
 void Stats::increase_twohand_mace_skill(const unsigned value) {
+    ++version;
     twohand_mace_skill += value;
 }
 
 void Stats::decrease_twohand_mace_skill(const unsigned value) {
+    ++version;
     twohand_mace_skill -= value;
 }
 
@@ -675,10 +724,12 @@ unsigned Stats::get_twohand_sword_skill() const {
 }
 
 void Stats::increase_twohand_sword_skill(const unsigned value) {
+    ++version;
     twohand_sword_skill += value;
 }
 
 void Stats::decrease_twohand_sword_skill(const unsigned value) {
+    ++version;
     twohand_sword_skill -= value;
 }
 
@@ -687,10 +738,12 @@ unsigned Stats::get_bow_skill() const {
 }
 
 void Stats::increase_bow_skill(const unsigned value) {
+    ++version;
     bow_skill += value;
 }
 
 void Stats::decrease_bow_skill(const unsigned value) {
+    ++version;
     bow_skill -= value;
 }
 
@@ -699,10 +752,12 @@ unsigned Stats::get_crossbow_skill() const {
 }
 
 void Stats::increase_crossbow_skill(const unsigned value) {
+    ++version;
     crossbow_skill += value;
 }
 
 void Stats::decrease_crossbow_skill(const unsigned value) {
+    ++version;
     crossbow_skill -= value;
 }
 
@@ -711,10 +766,12 @@ unsigned Stats::get_gun_skill() const {
 }
 
 void Stats::increase_gun_skill(const unsigned value) {
+    ++version;
     gun_skill += value;
 }
 
 void Stats::decrease_gun_skill(const unsigned value) {
+    ++version;
     gun_skill -= value;
 }
 
@@ -723,10 +780,12 @@ unsigned Stats::get_base_melee_ap() const {
 }
 
 void Stats::increase_base_melee_ap(const unsigned increase) {
+    ++version;
     melee_ap += increase;
 }
 
 void Stats::decrease_base_melee_ap(const unsigned decrease) {
+    ++version;
     check((melee_ap >= decrease), "Underflow base melee ap decrease");
     melee_ap -= decrease;
 }
@@ -736,10 +795,12 @@ unsigned Stats::get_base_feral_ap() const {
 }
 
 void Stats::increase_base_feral_ap(const unsigned increase) {
+    ++version;
     feral_ap += increase;
 }
 
 void Stats::decrease_base_feral_ap(const unsigned decrease) {
+    ++version;
     check((feral_ap >= decrease), "Underflow base feral ap decrease");
     feral_ap -= decrease;
 }
@@ -749,10 +810,12 @@ unsigned Stats::get_base_ranged_ap() const {
 }
 
 void Stats::increase_base_ranged_ap(const unsigned increase) {
+    ++version;
     ranged_ap += increase;
 }
 
 void Stats::decrease_base_ranged_ap(const unsigned decrease) {
+    ++version;
     check((ranged_ap >= decrease), "Underflow base ranged ap decrease");
     ranged_ap -= decrease;
 }
@@ -782,37 +845,45 @@ unsigned Stats::get_spell_crit_chance(MagicSchool school) const {
 }
 
 void Stats::increase_melee_aura_crit(const unsigned value) {
+    ++version;
     melee_crit += value;
 }
 
 void Stats::decrease_melee_aura_crit(const unsigned value) {
+    ++version;
     check((melee_crit >= value), "Underflow melee crit decrease");
     melee_crit -= value;
 }
 
 void Stats::increase_melee_hit(const unsigned value) {
+    ++version;
     melee_hit += value;
 }
 
 void Stats::decrease_melee_hit(const unsigned value) {
+    ++version;
     check((melee_hit >= value), "Underflow melee hit decrease");
     melee_hit -= value;
 }
 
 void Stats::increase_ranged_hit(const unsigned value) {
+    ++version;
     ranged_hit += value;
 }
 
 void Stats::decrease_ranged_hit(const unsigned value) {
+    ++version;
     check((ranged_hit >= value), "Underflow ranged hit decrease");
     ranged_hit -= value;
 }
 
 void Stats::increase_ranged_crit(const unsigned value) {
+    ++version;
     ranged_crit += value;
 }
 
 void Stats::decrease_ranged_crit(const unsigned value) {
+    ++version;
     check((ranged_crit >= value), "Underflow ranged crit decrease");
     ranged_crit -= value;
 }
@@ -822,57 +893,69 @@ unsigned Stats::get_ranged_attack_speed_percent() const {
 }
 
 void Stats::increase_ranged_attack_speed(const unsigned value) {
+    ++version;
     check((ranged_attack_speed == 0 || value == 0), "Cannot increase non-zero ranged attack speed");
     ranged_attack_speed += value;
 }
 
 void Stats::decrease_ranged_attack_speed(const unsigned value) {
+    ++version;
     check((ranged_attack_speed >= value), "Underflow decrease ranged attack speed");
     ranged_attack_speed -= value;
 }
 
 void Stats::increase_spell_hit(const unsigned value) {
+    ++version;
     spell_hit += value;
 }
 
 void Stats::decrease_spell_hit(const unsigned value) {
+    ++version;
     spell_hit -= value;
 }
 
 void Stats::increase_spell_hit(const MagicSchool school, const unsigned value) {
+    ++version;
     magic_school_hit_bonus[school] += value;
 }
 
 void Stats::decrease_spell_hit(const MagicSchool school, const unsigned value) {
+    ++version;
     check((magic_school_hit_bonus[school] >= value), "Underflow spell school hit decrease");
 
     magic_school_hit_bonus[school] -= value;
 }
 
 void Stats::increase_spell_crit(const unsigned value) {
+    ++version;
     spell_crit += value;
 }
 
 void Stats::decrease_spell_crit(const unsigned value) {
+    ++version;
     check((spell_crit >= value), "Underflow spell_crit decrease");
     spell_crit -= value;
 }
 
 void Stats::increase_spell_crit(const MagicSchool school, const unsigned value) {
+    ++version;
     magic_school_crit_bonus[school] += value;
 }
 
 void Stats::decrease_spell_crit(const MagicSchool school, const unsigned value) {
+    ++version;
     check((magic_school_crit_bonus[school] >= value), "Underflow spell school crit decrease");
 
     magic_school_crit_bonus[school] -= value;
 }
 
 void Stats::increase_melee_ap_against_type(const Target::CreatureType type, const unsigned increase) {
+    ++version;
     melee_ap_against_creature[type] += increase;
 }
 
 void Stats::decrease_melee_ap_against_type(const Target::CreatureType type, const unsigned decrease) {
+    ++version;
     melee_ap_against_creature[type] -= decrease;
 }
 
@@ -881,10 +964,12 @@ unsigned Stats::get_melee_ap_against_type(const Target::CreatureType type) const
 }
 
 void Stats::increase_ranged_ap_against_type(const Target::CreatureType type, const unsigned increase) {
+    ++version;
     ranged_ap_against_creature[type] += increase;
 }
 
 void Stats::decrease_ranged_ap_against_type(const Target::CreatureType type, const unsigned decrease) {
+    ++version;
     ranged_ap_against_creature[type] -= decrease;
 }
 
@@ -893,10 +978,12 @@ unsigned Stats::get_ranged_ap_against_type(const Target::CreatureType type) cons
 }
 
 void Stats::increase_spell_damage_against_type(const Target::CreatureType type, const unsigned increase) {
+    ++version;
     spell_damage_against_creature[type] += increase;
 }
 
 void Stats::decrease_spell_damage_against_type(const Target::CreatureType type, const unsigned decrease) {
+    ++version;
     check((spell_damage_against_creature[type] >= decrease), "Underflow decrease spell damage against type");
     spell_damage_against_creature[type] -= decrease;
 }
@@ -910,10 +997,12 @@ unsigned Stats::get_flat_weapon_damage() const {
 }
 
 void Stats::increase_flat_weapon_damage(const unsigned value) {
+    ++version;
     flat_weapon_damage += value;
 }
 
 void Stats::decrease_flat_weapon_damage(const unsigned value) {
+    ++version;
     check((value <= flat_weapon_damage), "Underflow decrease flat_weapon_damage");
     flat_weapon_damage -= value;
 }
@@ -923,10 +1012,12 @@ unsigned Stats::get_mp5() const {
 }
 
 void Stats::increase_mp5(const unsigned increase) {
+    ++version;
     mp5 += increase;
 }
 
 void Stats::decrease_mp5(const unsigned decrease) {
+    ++version;
     check((decrease <= mp5), "Underflow decrease mp5");
     mp5 -= decrease;
 }
@@ -936,10 +1027,12 @@ unsigned Stats::get_hp5() const {
 }
 
 void Stats::increase_hp5(const unsigned increase) {
+    ++version;
     hp5 += increase;
 }
 
 void Stats::decrease_hp5(const unsigned decrease) {
+    ++version;
     check((decrease <= hp5), "Underflow decrease hp5");
     hp5 -= decrease;
 }
@@ -949,10 +1042,12 @@ unsigned Stats::get_base_spell_damage() const {
 }
 
 void Stats::increase_base_spell_damage(const unsigned increase) {
+    ++version;
     spell_damage += increase;
 }
 
 void Stats::decrease_base_spell_damage(const unsigned decrease) {
+    ++version;
     check((decrease <= spell_damage), "Underflow decrease spell_damage");
     spell_damage -= decrease;
 }
@@ -962,10 +1057,12 @@ unsigned Stats::get_spell_damage(const MagicSchool school) const {
 }
 
 void Stats::increase_spell_damage_vs_school(const unsigned increase, const MagicSchool school) {
+    ++version;
     magic_school_damage_bonus[school] += increase;
 }
 
 void Stats::decrease_spell_damage_vs_school(const unsigned decrease, const MagicSchool school) {
+    ++version;
     check((decrease <= magic_school_damage_bonus[school]), "Underflow Stats::decrease_spell_damage_vs_school()");
     magic_school_damage_bonus[school] -= decrease;
 }
@@ -975,10 +1072,12 @@ unsigned Stats::get_spell_penetration(const MagicSchool school) const {
 }
 
 void Stats::increase_spell_penetration(const MagicSchool school, const unsigned increase) {
+    ++version;
     magic_school_spell_penetration_bonus[school] += increase;
 }
 
 void Stats::decrease_spell_penetration(const MagicSchool school, const unsigned decrease) {
+    ++version;
     check((decrease <= magic_school_spell_penetration_bonus[school]), "Underflow decrease spell penetration bonus");
     magic_school_spell_penetration_bonus[school] -= decrease;
 }
@@ -987,6 +1086,10 @@ QStringList Stats::get_equip_effects_tooltip() const {
     return this->equip_effects_tooltip;
 }
 
+unsigned Stats::get_version() const {
+    return this->version;
+}
+
 QStringList Stats::get_base_tooltip() const {
     return this->base_tooltip;
 }
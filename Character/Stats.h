@@ -195,7 +195,12 @@ public:
     QStringList get_base_tooltip() const;
     QStringList get_equip_effects_tooltip() const;
 
+    // Incremented by every mutator, so callers can tell whether values derived from these stats are stale.
+    unsigned get_version() const;
+
 private:
+    unsigned version {0};
+
     // Base stats
     unsigned strength {0};
     unsigned agility {0};
@@ -10,7 +10,7 @@ JomGabbar::JomGabbar(Character* pchar) :
     SelfBuff(pchar, "Jom Gabbar", "Assets/items/Inv_misc_enggizmos_19.png", 20, 0), curr_stacks(0), max_stacks(10) {}
 
 void JomGabbar::buff_effect_when_applied() {
-    auto event = new PeriodicRefreshBuff(this, pchar->get_engine()->get_current_priority() + 2.0);
+    auto event = new (pchar->get_engine()->get_event_pool()) PeriodicRefreshBuff(this, pchar->get_engine()->get_current_priority() + 2.0);
     pchar->get_engine()->add_event(event);
 
     ++curr_stacks;
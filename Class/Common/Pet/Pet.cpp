@@ -4,12 +4,12 @@
 
 #include "Character.h"
 #include "CharacterSpells.h"
-#include "CharacterStats.h"
 #include "Engine.h"
 #include "PetAction.h"
 #include "PetAutoAttack.h"
 #include "PetMeleeHit.h"
 #include "Random.h"
+#include "SimSettings.h"
 #include "Spell.h"
 #include "Utils/CompareDouble.h"
 
@@ -26,8 +26,6 @@ Pet::Pet(Character* pchar, const QString& name, double attack_speed, double base
     next_gcd(0.0),
     is_attacking(false),
     crit_chance(500),
-    attack_speed_modifier(1.0),
-    damage_modifier(1.0),
     pet_auto_attack(nullptr) {}
 
 Pet::~Pet() {
@@ -62,12 +60,12 @@ void Pet::start_attack() {
 
 void Pet::add_gcd_event() {
     next_gcd = pchar->get_engine()->get_current_priority() + global_cooldown;
-    auto new_event = new PetAction(this, next_gcd);
+    auto new_event = new (pchar->get_engine()->get_event_pool()) PetAction(this, next_gcd);
     pchar->get_engine()->add_event(new_event);
 }
 
 void Pet::add_pet_reaction() {
-    pchar->get_engine()->add_event(new PetAction(this, pchar->get_engine()->get_current_priority() + 0.1));
+    pchar->get_engine()->add_event(new (pchar->get_engine()->get_event_pool()) PetAction(this, pchar->get_engine()->get_current_priority() + 0.1));
 }
 
 bool Pet::action_ready() {
@@ -80,15 +78,18 @@ void Pet::auto_attack(const int iteration) {
 
     pet_auto_attack->perform();
 
+    if (pchar->get_sim_settings()->get_fast_forward_pet_swings())
+        fast_forward_auto_attacks();
+
     add_next_auto_attack();
 }
 
 double Pet::get_attack_speed() const {
-    return base_attack_speed / this->attack_speed_modifier;
+    return base_attack_speed / this->attack_speed_modifier.get_modifier();
 }
 
 void Pet::increase_attack_speed(const unsigned increase) {
-    CharacterStats::add_multiplicative_effect(attack_speed_modifiers, static_cast<int>(increase), attack_speed_modifier);
+    attack_speed_modifier.add(static_cast<int>(increase));
 
     double increase_double = double(increase) / 100;
     pet_auto_attack->update_next_expected_use(increase_double);
@@ -96,7 +97,7 @@ void Pet::increase_attack_speed(const unsigned increase) {
 }
 
 void Pet::decrease_attack_speed(const unsigned decrease) {
-    CharacterStats::remove_multiplicative_effect(attack_speed_modifiers, static_cast<int>(decrease), attack_speed_modifier);
+    attack_speed_modifier.remove(static_cast<int>(decrease));
 
     double decrease_double = double(decrease) / 100;
     pet_auto_attack->update_next_expected_use(-decrease_double);
@@ -104,15 +105,15 @@ void Pet::decrease_attack_speed(const unsigned decrease) {
 }
 
 double Pet::get_damage_modifier() const {
-    return this->damage_modifier;
+    return this->damage_modifier.get_modifier();
 }
 
 void Pet::increase_damage_modifier(const unsigned increase) {
-    CharacterStats::add_multiplicative_effect(damage_modifiers, static_cast<int>(increase), damage_modifier);
+    damage_modifier.add(static_cast<int>(increase));
 }
 
 void Pet::decrease_damage_modifier(const unsigned decrease) {
-    CharacterStats::remove_multiplicative_effect(damage_modifiers, static_cast<int>(decrease), damage_modifier);
+    damage_modifier.remove(static_cast<int>(decrease));
 }
 
 unsigned Pet::get_crit_chance() const {
@@ -170,8 +171,22 @@ Resource* Pet::get_resource() {
 }
 
 void Pet::add_next_auto_attack() {
-    auto new_event = new PetMeleeHit(this, pet_auto_attack->get_next_iteration(), pet_auto_attack->get_next_expected_use());
-    pchar->get_engine()->add_event(new_event);
+    auto new_event = new (pchar->get_engine()->get_event_pool()) PetMeleeHit(this, pet_auto_attack->get_next_iteration(), pet_auto_attack->get_next_expected_use());
+    pchar->get_engine()->reschedule_event(&pending_melee_hit, new_event);
+}
+
+void Pet::fast_forward_auto_attacks() {
+    Engine* engine = pchar->get_engine();
+
+    // A swing due before every queued event is the next event the engine would run anyway, so it is performed
+    // right away instead of going through the queue. Anything a swing schedules (e.g. Frenzy changing the attack
+    // speed) is in the queue before the next swing is considered, so swings and other events stay in order.
+    double next_swing = pet_auto_attack->get_next_expected_use();
+    while (engine->next_event_is_after(next_swing)) {
+        engine->fast_forward(EventType::PetMeleeHit, next_swing);
+        pet_auto_attack->perform();
+        next_swing = pet_auto_attack->get_next_expected_use();
+    }
 }
 
 void Pet::add_spells() {
@@ -2,6 +2,9 @@
 
 #include <QVector>
 
+#include "EventHandle.h"
+#include "Utils/ModifierStack.h"
+
 class Character;
 class PetAutoAttack;
 class Random;
@@ -66,15 +69,15 @@ protected:
 
     unsigned crit_chance;
 
-    double attack_speed_modifier;
-    double damage_modifier;
-    QVector<int> attack_speed_modifiers;
-    QVector<int> damage_modifiers;
+    ModifierStack attack_speed_modifier;
+    ModifierStack damage_modifier;
 
     PetAutoAttack* pet_auto_attack;
+    EventHandle pending_melee_hit;
     QVector<Spell*> spells;
 
     void add_next_auto_attack();
+    void fast_forward_auto_attacks();
     void add_spells();
     void remove_spells();
 };
@@ -75,10 +75,12 @@ void PetAutoAttack::update_next_expected_use(const double haste_change) {
         remainder_after_haste_change *= (1 + (-1) * haste_change);
     else
         remainder_after_haste_change /= (1 + haste_change);
+    request_reset();
     next_expected_use = curr_time + remainder_after_haste_change;
 }
 
 void PetAutoAttack::complete_swing() {
+    request_reset();
     cooldown->last_used = engine->get_current_priority();
     next_expected_use = cooldown->last_used + pet->get_attack_speed();
 }
@@ -80,6 +80,7 @@ void MainhandAttack::update_next_expected_use_for_parry() {
   double curr_time = pchar->get_engine()->get_current_priority();
 
   double remaining = next_expected_use - curr_time;
+  request_reset();
 
   if (remaining / speed > 0.5)
     next_expected_use = cooldown->last_used + speed - parry_haste_boost;
@@ -100,23 +101,26 @@ void MainhandAttack::update_next_expected_use(const double haste_change) {
         remainder_after_haste_change *= (1 + (-1) * haste_change);
     else
         remainder_after_haste_change /= (1 + haste_change);
+    request_reset();
     next_expected_use = curr_time + remainder_after_haste_change;
 }
 
 void MainhandAttack::complete_swing() {
+    request_reset();
     cooldown->last_used = engine->get_current_priority();
     next_expected_use = cooldown->last_used + pchar->get_stats()->get_mh_wpn_speed();
 }
 
 void MainhandAttack::reset_swingtimer() {
+    request_reset();
     next_expected_use = pchar->get_engine()->get_current_priority() + pchar->get_stats()->get_mh_wpn_speed();
     if (pchar->get_spells()->is_melee_attacking())
         add_next_mh_attack();
 }
 
 void MainhandAttack::add_next_mh_attack() {
-    auto new_event = new MainhandMeleeHit(pchar->get_spells(), get_next_expected_use(), get_next_iteration());
-    pchar->get_engine()->add_event(new_event);
+    auto new_event = new (pchar->get_engine()->get_event_pool()) MainhandMeleeHit(pchar->get_spells(), get_next_expected_use(), get_next_iteration());
+    pchar->get_engine()->reschedule_event(&pending_swing, new_event);
 }
 
 bool MainhandAttack::attack_is_valid(const int iteration) const {
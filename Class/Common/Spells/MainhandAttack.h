@@ -1,5 +1,6 @@
 #pragma once
 
+#include "EventHandle.h"
 #include "Spell.h"
 
 class MainhandAttack : public Spell {
@@ -21,6 +22,7 @@ public:
 protected:
     double next_expected_use;
     int iteration;
+    EventHandle pending_swing;
     QVector<double> talent_ranks;
 
     virtual void spell_effect() override;
@@ -82,23 +82,26 @@ void OffhandAttack::update_next_expected_use(const double haste_change) {
     else
         remainder_after_haste_change /= (1 + haste_change);
 
+    request_reset();
     next_expected_use = curr_time + remainder_after_haste_change;
 }
 
 void OffhandAttack::complete_swing() {
+    request_reset();
     cooldown->last_used = engine->get_current_priority();
     next_expected_use = cooldown->last_used + pchar->get_stats()->get_oh_wpn_speed();
 }
 
 void OffhandAttack::reset_swingtimer() {
+    request_reset();
     next_expected_use = pchar->get_engine()->get_current_priority() + pchar->get_stats()->get_oh_wpn_speed();
     if (pchar->get_spells()->is_melee_attacking())
         add_next_oh_attack();
 }
 
 void OffhandAttack::add_next_oh_attack() {
-    auto new_event = new OffhandMeleeHit(pchar->get_spells(), get_next_expected_use(), get_next_iteration());
-    pchar->get_engine()->add_event(new_event);
+    auto new_event = new (pchar->get_engine()->get_event_pool()) OffhandMeleeHit(pchar->get_spells(), get_next_expected_use(), get_next_iteration());
+    pchar->get_engine()->reschedule_event(&pending_swing, new_event);
 }
 
 bool OffhandAttack::attack_is_valid(const int iteration) const {
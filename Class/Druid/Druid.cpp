@@ -212,6 +212,7 @@ void Druid::cancel_form() {
     }
 
     current_form = DruidForm::Caster;
+    cstats->invalidate_derived_stats();
     druid_spells->get_caster_form()->buff->apply_buff();
 
     add_player_reaction_event();
@@ -227,6 +228,7 @@ void Druid::switch_to_form(const DruidForm new_form) {
     druid_spells->get_caster_form()->buff->cancel_buff();
 
     this->current_form = new_form;
+    cstats->invalidate_derived_stats();
 
     switch (new_form) {
     case DruidForm::Bear:
@@ -244,7 +246,7 @@ void Druid::switch_to_form(const DruidForm new_form) {
 
     if ((engine->get_current_priority() + 1.5) > this->next_gcd) {
         this->next_gcd = engine->get_current_priority() + 1.5;
-        engine->add_event(new PlayerAction(spells, next_gcd));
+        engine->add_event(new (engine->get_event_pool()) PlayerAction(spells, next_gcd));
     }
 }
 
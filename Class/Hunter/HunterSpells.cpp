@@ -66,8 +66,8 @@ void HunterSpells::add_next_ranged_attack() {
     if (attack_mode != AttackMode::RangedAttack)
         return;
 
-    auto new_event = new RangedHit(this, auto_shot->get_next_expected_use(), auto_shot->get_next_iteration());
-    hunter->get_engine()->add_event(new_event);
+    auto new_event = new (pchar->get_engine()->get_event_pool()) RangedHit(this, auto_shot->get_next_expected_use(), auto_shot->get_next_iteration());
+    hunter->get_engine()->reschedule_event(&pending_ranged_hit, new_event);
 }
 
 void HunterSpells::ranged_auto_attack(const int iteration) {
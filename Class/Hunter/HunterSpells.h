@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CharacterSpells.h"
+#include "EventHandle.h"
 
 class AspectOfTheHawk;
 class ExposeWeaknessProc;
@@ -27,6 +28,7 @@ private:
     Hunter* hunter;
     AspectOfTheHawk* aspect_of_the_hawk;
     AutoShot* auto_shot;
+    EventHandle pending_ranged_hit;
     ExposeWeaknessProc* expose_weakness_proc;
     HuntersMark* hunters_mark;
 };
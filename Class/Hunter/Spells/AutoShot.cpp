@@ -72,10 +72,12 @@ void AutoShot::update_next_expected_use(const double haste_change) {
         remainder_after_haste_change *= (1 + (-1) * haste_change);
     else
         remainder_after_haste_change /= (1 + haste_change);
+    request_reset();
     next_expected_use = curr_time + remainder_after_haste_change;
 }
 
 void AutoShot::complete_shot() {
+    request_reset();
     cooldown->last_used = engine->get_current_priority();
     next_expected_use = cooldown->last_used + pchar->get_stats()->get_ranged_wpn_speed();
 }
@@ -102,6 +104,7 @@ void AutoShot::add_adrenaline_rush_statistics() {
 }
 
 void AutoShot::reset_shot_timer() {
+    request_reset();
     next_expected_use = pchar->get_engine()->get_current_priority() + pchar->get_stats()->get_ranged_wpn_speed();
 }
 
@@ -21,7 +21,7 @@ SealOfCommandProc::SealOfCommandProc(Character* pchar, SealOfCommand* seal) :
 }
 
 void SealOfCommandProc::proc_effect() {
-    auto new_event = new SpellCallback(seal, engine->get_current_priority() + 0.5);
+    auto new_event = new (engine->get_event_pool()) SpellCallback(seal, engine->get_current_priority() + 0.5);
     this->engine->add_event(new_event);
     seal->signal_proc_in_progress();
 }
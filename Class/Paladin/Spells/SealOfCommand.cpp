@@ -47,6 +47,7 @@ Proc* SealOfCommand::get_proc() const {
 
 void SealOfCommand::signal_proc_in_progress() {
     check(!proc_in_progress, "SealOfCommand was signalled proc in progress while proc already in progress");
+    request_reset();
     proc_in_progress = true;
 }
 
@@ -0,0 +1,867 @@
+# Simulation core shared by the GUI application and the headless command-line simulator.
+# Depends on QtCore only.
+
+SOURCES += \
+    $$PWD/Class/Common/Buffs/CharmOfTrickery.cpp \
+    $$PWD/Class/Common/Buffs/NoEffectSelfBuff.cpp \
+    $$PWD/Class/Common/Buffs/NoEffectUniqueDebuff.cpp \
+    $$PWD/Class/Common/Buffs/SanctifiedOrb.cpp \
+    $$PWD/Class/Common/Buffs/SuppressCastBuff.cpp \
+    $$PWD/Class/Common/Buffs/ZandalarianHeroCharm.cpp \
+    $$PWD/Class/Common/Enchants/EnchantName.cpp \
+    $$PWD/Class/Common/Procs/ResourceGainProc.cpp \
+    $$PWD/Class/Common/Spells/DragonbreathChili.cpp \
+    $$PWD/Class/Common/Spells/EssenceOfTheRed.cpp \
+    $$PWD/Class/Common/Spells/PeriodicDamageSpell.cpp \
+    $$PWD/Class/Common/Spells/UseItem.cpp \
+    $$PWD/Class/Druid/Buffs/BearFormBuff.cpp \
+    $$PWD/Class/Druid/Buffs/CatFormBuff.cpp \
+    $$PWD/Class/Druid/Buffs/LeaderOfThePack.cpp \
+    $$PWD/Class/Druid/Buffs/MoonkinFormBuff.cpp \
+    $$PWD/Class/Druid/Buffs/NaturesGrace.cpp \
+    $$PWD/Class/Druid/Buffs/TigersFuryBuff.cpp \
+    $$PWD/Class/Druid/DruidEnchants.cpp \
+    $$PWD/Class/Druid/Procs/BloodFrenzy.cpp \
+    $$PWD/Class/Druid/Procs/ClearcastingDruid.cpp \
+    $$PWD/Class/Druid/Procs/Furor.cpp \
+    $$PWD/Class/Druid/Procs/PrimalFury.cpp \
+    $$PWD/Class/Druid/Spells/BearForm.cpp \
+    $$PWD/Class/Druid/Spells/CasterForm.cpp \
+    $$PWD/Class/Druid/Spells/CatForm.cpp \
+    $$PWD/Class/Druid/Spells/Enrage.cpp \
+    $$PWD/Class/Druid/Spells/FerociousBite.cpp \
+    $$PWD/Class/Druid/Spells/MainhandAttackDruid.cpp \
+    $$PWD/Class/Druid/Spells/Maul.cpp \
+    $$PWD/Class/Druid/Spells/Moonfire.cpp \
+    $$PWD/Class/Druid/Spells/MoonkinForm.cpp \
+    $$PWD/Class/Druid/Spells/Shred.cpp \
+    $$PWD/Class/Druid/Spells/Starfire.cpp \
+    $$PWD/Class/Druid/Spells/Swipe.cpp \
+    $$PWD/Class/Druid/Spells/TigersFury.cpp \
+    $$PWD/Class/Druid/Spells/Wrath.cpp \
+    $$PWD/Class/Druid/TalentTrees/Balance.cpp \
+    $$PWD/Class/Druid/TalentTrees/FeralCombat.cpp \
+    $$PWD/Class/Druid/TalentTrees/RestorationDruid.cpp \
+    $$PWD/Class/Mage/Buffs/ArcanePowerBuff.cpp \
+    $$PWD/Class/Mage/Buffs/CombustionBuff.cpp \
+    $$PWD/Class/Mage/Buffs/ElementalVulnerability.cpp \
+    $$PWD/Class/Mage/Buffs/EvocationBuff.cpp \
+    $$PWD/Class/Mage/Buffs/FireVulnerability.cpp \
+    $$PWD/Class/Mage/Buffs/IgniteBuff.cpp \
+    $$PWD/Class/Mage/Buffs/WintersChill.cpp \
+    $$PWD/Class/Mage/MageEnchants.cpp \
+    $$PWD/Class/Mage/Procs/ClearcastingMage.cpp \
+    $$PWD/Class/Mage/Procs/ImprovedScorch.cpp \
+    $$PWD/Class/Mage/Procs/WintersChillProc.cpp \
+    $$PWD/Class/Mage/Spells/ArcaneMissiles.cpp \
+    $$PWD/Class/Mage/Spells/ArcanePower.cpp \
+    $$PWD/Class/Mage/Spells/Combustion.cpp \
+    $$PWD/Class/Mage/Spells/Evocation.cpp \
+    $$PWD/Class/Mage/Spells/Fireball.cpp \
+    $$PWD/Class/Mage/Spells/Frostbolt.cpp \
+    $$PWD/Class/Mage/Spells/Ignite.cpp \
+    $$PWD/Class/Mage/Spells/RobeOfTheArchmage.cpp \
+    $$PWD/Class/Mage/Spells/Scorch.cpp \
+    $$PWD/Class/Mage/TalentTrees/Arcane.cpp \
+    $$PWD/Class/Mage/TalentTrees/Fire.cpp \
+    $$PWD/Class/Mage/TalentTrees/Frost.cpp \
+    $$PWD/Class/Paladin/Buffs/JudgementOfTheCrusader.cpp \
+    $$PWD/Class/Paladin/Buffs/SanctityAuraBuff.cpp \
+    $$PWD/Class/Paladin/Buffs/SealOfTheCrusaderBuff.cpp \
+    $$PWD/Class/Paladin/Buffs/Vengeance.cpp \
+    $$PWD/Class/Paladin/Procs/SealOfCommandProc.cpp \
+    $$PWD/Class/Paladin/Spells/Consecration.cpp \
+    $$PWD/Class/Paladin/Spells/Judgement.cpp \
+    $$PWD/Class/Paladin/Spells/MainhandAttackPaladin.cpp \
+    $$PWD/Class/Paladin/Spells/PaladinSeal.cpp \
+    $$PWD/Class/Paladin/Spells/SanctityAura.cpp \
+    $$PWD/Class/Paladin/Spells/SealOfCommand.cpp \
+    $$PWD/Class/Paladin/Spells/SealOfTheCrusader.cpp \
+    $$PWD/Class/Common/Buffs/Nightfall.cpp \
+    $$PWD/Class/Common/Procs/GenericBuffProc.cpp \
+    $$PWD/Class/Common/Procs/GenericSpellProc.cpp \
+    $$PWD/Class/Common/Spells/DemonicRune.cpp \
+    $$PWD/Class/Common/Spells/FireballInstant.cpp \
+    $$PWD/Class/Common/Spells/NightDragonsBreath.cpp \
+    $$PWD/Class/Rogue/Spells/ThistleTea.cpp \
+    $$PWD/Class/Shaman/Buffs/ElementalDevastation.cpp \
+    $$PWD/Class/Shaman/Buffs/StormstrikeBuff.cpp \
+    $$PWD/Class/Shaman/Procs/ClearcastingShaman.cpp \
+    $$PWD/Class/Shaman/Procs/WindfuryWeaponProc.cpp \
+    $$PWD/Class/Shaman/ShamanEnchants.cpp \
+    $$PWD/Class/Shaman/Spells/LightningBolt.cpp \
+    $$PWD/Class/Shaman/Spells/Stormstrike.cpp \
+    $$PWD/Class/Shaman/Spells/WindfuryWeapon.cpp \
+    $$PWD/Class/Shaman/TalentTrees/Elemental.cpp \
+    $$PWD/Class/Shaman/TalentTrees/Enhancement.cpp \
+    $$PWD/Class/Shaman/TalentTrees/RestorationShaman.cpp \
+    $$PWD/Class/Warlock/Buffs/ImprovedShadowBolt.cpp \
+    $$PWD/Class/Warlock/Spells/LifeTap.cpp \
+    $$PWD/Class/Warlock/TalentTrees/Affliction.cpp \
+    $$PWD/Class/Warlock/TalentTrees/Demonology.cpp \
+    $$PWD/Class/Warlock/TalentTrees/Destruction.cpp \
+    $$PWD/Class/Warlock/Spells/ShadowBolt.cpp \
+    $$PWD/Class/Warlock/WarlockEnchants.cpp \
+    $$PWD/Equipment/Item/ItemStatsEnum.cpp \
+    $$PWD/Equipment/Item/RandomAffix.cpp \
+    $$PWD/Equipment/Item/Quiver.cpp \
+    $$PWD/Equipment/RandomAffixes.cpp \
+    $$PWD/Event/Event.cpp \
+    $$PWD/Event/EventHandle.cpp \
+    $$PWD/Event/EventPool.cpp \
+    $$PWD/Engine/Engine.cpp \
+    $$PWD/Event/Events/EncounterEnd.cpp \
+    $$PWD/Event/Events/IncomingDamageEvent.cpp \
+    $$PWD/Event/Events/EncounterStart.cpp \
+    $$PWD/Event/Events/SpellCallback.cpp \
+    $$PWD/Phases/ContentPhase.cpp \
+    $$PWD/Phases/PhaseRequirer.cpp \
+    $$PWD/Queue/CalendarQueue.cpp \
+    $$PWD/Queue/HeapQueue.cpp \
+    $$PWD/Queue/Queue.cpp \
+    $$PWD/Character/Race/Races/Human.cpp \
+    $$PWD/Character/Race/Races/Dwarf.cpp \
+    $$PWD/Character/Race/Races/NightElf.cpp \
+    $$PWD/Character/Race/Races/Gnome.cpp \
+    $$PWD/Character/Race/Races/Orc.cpp \
+    $$PWD/Character/Race/Races/Undead.cpp \
+    $$PWD/Character/Race/Races/Tauren.cpp \
+    $$PWD/Character/Race/Races/Troll.cpp \
+    $$PWD/Class/Warrior/Warrior.cpp \
+    $$PWD/Class/Priest/Priest.cpp \
+    $$PWD/Class/Rogue/Rogue.cpp \
+    $$PWD/Class/Mage/Mage.cpp \
+    $$PWD/Class/Druid/Druid.cpp \
+    $$PWD/Class/Hunter/Hunter.cpp \
+    $$PWD/Class/Warlock/Warlock.cpp \
+    $$PWD/Class/Shaman/Shaman.cpp \
+    $$PWD/Class/Paladin/Paladin.cpp \
+    $$PWD/Character/Character.cpp \
+    $$PWD/Event/Events/PlayerAction.cpp \
+    $$PWD/Raid/RaidControl.cpp \
+    $$PWD/Rotation/Conditions/ConditionBuffDuration.cpp \
+    $$PWD/Rotation/Conditions/ConditionBuffStacks.cpp \
+    $$PWD/Spells/CastingTimeRequirer.cpp \
+    $$PWD/Spells/CooldownControl.cpp \
+    $$PWD/Spells/PartyBuff.cpp \
+    $$PWD/Spells/SelfBuff.cpp \
+    $$PWD/Spells/SharedDebuff.cpp \
+    $$PWD/Spells/SpellPeriodic.cpp \
+    $$PWD/Spells/SpellRankGroup.cpp \
+    $$PWD/Spells/UniqueDebuff.cpp \
+    $$PWD/Talent/CharacterTalents.cpp \
+    $$PWD/Equipment/Equipment.cpp \
+    $$PWD/CombatRoll/CombatRoll.cpp \
+    $$PWD/Spells/Spell.cpp \
+    $$PWD/Class/Warrior/Spells/Bloodthirst.cpp \
+    $$PWD/Event/Events/OffhandMeleeHit.cpp \
+    $$PWD/Event/Events/MainhandMeleeHit.cpp \
+    $$PWD/Class/Warrior/Spells/Whirlwind.cpp \
+    $$PWD/Class/Warrior/Spells/Execute.cpp \
+    $$PWD/Class/Warrior/Spells/HeroicStrike.cpp \
+    $$PWD/Class/Warrior/Spells/Overpower.cpp \
+    $$PWD/Class/Warrior/Spells/Hamstring.cpp \
+    $$PWD/Class/Warrior/Spells/Recklessness.cpp \
+    $$PWD/CombatRoll/AttackTables/MeleeSpecialTable.cpp \
+    $$PWD/Mechanics/Mechanics.cpp \
+    $$PWD/Spells/Buff.cpp \
+    $$PWD/Class/Warrior/Buffs/Flurry.cpp \
+    $$PWD/Event/Events/BuffRemoval.cpp \
+    $$PWD/Talent/TalentTree.cpp \
+    $$PWD/Talent/Talent.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Arms.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Fury.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Protection.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Arms/Impale.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Arms/TacticalMastery.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Arms/TwoHandedWeaponSpecialization.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Arms/AxeSpecialization.cpp \
+    $$PWD/Class/Warrior/TalentTrees/Arms/PolearmSpecialization.cpp \
+    $$PWD/Character/Stats.cpp \
+    $$PWD/Class/Warrior/Spells/DeepWounds.cpp \
+    $$PWD/Event/Events/DotTick.cpp \
+    $$PWD/Class/Warrior/Procs/UnbridledWrath.cpp \
+    $$PWD/Class/Warrior/Spells/DeathWish.cpp \
+    $$PWD/Class/Warrior/Buffs/DeathWishBuff.cpp \
+    $$PWD/Class/Warrior/Buffs/BattleShoutBuff.cpp \
+    $$PWD/Class/Warrior/Spells/BattleShout.cpp \
+    $$PWD/Class/Warrior/Spells/BerserkerRage.cpp \
+    $$PWD/Equipment/EquipmentDb/EquipmentDb.cpp \
+    $$PWD/Equipment/EquipmentDb/EquipmentDbCache.cpp \
+    $$PWD/Equipment/Item/Item.cpp \
+    $$PWD/Equipment/EquipmentDb/ItemFileReader.cpp \
+    $$PWD/Equipment/EquipmentDb/WeaponFileReader.cpp \
+    $$PWD/Equipment/Item/Weapon.cpp \
+    $$PWD/Class/Common/Spells/MainhandAttack.cpp \
+    $$PWD/Class/Common/Spells/OffhandAttack.cpp \
+    $$PWD/Class/Warrior/Spells/MainhandAttackWarrior.cpp \
+    $$PWD/Class/Warrior/Spells/OffhandAttackWarrior.cpp \
+    $$PWD/Class/Warrior/Spells/Bloodrage.cpp \
+    $$PWD/Spells/Proc.cpp \
+    $$PWD/Class/Common/Enchants/WindfuryTotemAttack.cpp \
+    $$PWD/Class/Common/Enchants/Crusader.cpp \
+    $$PWD/Spells/ProcPPM.cpp \
+    $$PWD/Class/Common/Buffs/HolyStrength.cpp \
+    $$PWD/Class/Common/Enchants/FieryWeapon.cpp \
+    $$PWD/Character/CharacterStats.cpp \
+    $$PWD/Class/Warrior/WarriorSpells.cpp \
+    $$PWD/Statistics/ClassStatistics.cpp \
+    $$PWD/Faction/Faction.cpp \
+    $$PWD/Target/Target.cpp \
+    $$PWD/Statistics/StatisticsSpell.cpp \
+    $$PWD/Statistics/StatisticsBuff.cpp \
+    $$PWD/Statistics/StatisticsResource.cpp \
+    $$PWD/Statistics/StatisticsProc.cpp \
+    $$PWD/Statistics/RunningStatistics.cpp \
+    $$PWD/Class/Common/Procs/ExtraAttackOnNextSwingProc.cpp \
+    $$PWD/Class/Common/Buffs/ExtraAttackOnNextSwingBuff.cpp \
+    $$PWD/Class/Common/Procs/ExtraAttackInstantProc.cpp \
+    $$PWD/Class/Common/GeneralProcs.cpp \
+    $$PWD/Character/CharacterDecoder.cpp \
+    $$PWD/Character/CharacterEncoder.cpp \
+    $$PWD/Thread/IterationScheduler.cpp \
+    $$PWD/Thread/SimulationThreadPool.cpp \
+    $$PWD/Thread/SimulationRunner.cpp \
+    $$PWD/Optimizer/SetupEvaluator.cpp \
+    $$PWD/Optimizer/EvaluatorPool.cpp \
+    $$PWD/Optimizer/GearOptimizer.cpp \
+    $$PWD/Optimizer/TalentOptimizer.cpp \
+    $$PWD/Class/Common/GeneralBuffs.cpp \
+    $$PWD/Spells/ExternalBuff.cpp \
+    $$PWD/Rotation/RotationFileReader.cpp \
+    $$PWD/Rotation/Rotation.cpp \
+    $$PWD/Rotation/Condition.cpp \
+    $$PWD/Rotation/ConditionProgram.cpp \
+    $$PWD/Rotation/Conditions/ConditionSpell.cpp \
+    $$PWD/Rotation/Conditions/ConditionResource.cpp \
+    $$PWD/Rotation/Conditions/ConditionVariableBuiltin.cpp \
+    $$PWD/CombatRoll/xorshift/xoroshiro128plus.cpp \
+    $$PWD/CombatRoll/Random.cpp \
+    $$PWD/Class/Warrior/Buffs/RecklessnessBuff.cpp \
+    $$PWD/Class/Warrior/Spells/BattleStance.cpp \
+    $$PWD/Class/Warrior/Spells/BerserkerStance.cpp \
+    $$PWD/Class/Warrior/Buffs/BerserkerStanceBuff.cpp \
+    $$PWD/Class/Warrior/Buffs/BattleStanceBuff.cpp \
+    $$PWD/Character/Race/Racials/BloodFury.cpp \
+    $$PWD/Character/Race/Racials/BloodFuryBuff.cpp \
+    $$PWD/Character/Race/Racials/Berserking.cpp \
+    $$PWD/Character/Race/Racials/BerserkingBuff.cpp \
+    $$PWD/Class/Warlock/WarlockSpells.cpp \
+    $$PWD/Class/Shaman/ShamanSpells.cpp \
+    $$PWD/Class/Rogue/RogueSpells.cpp \
+    $$PWD/Class/Priest/PriestSpells.cpp \
+    $$PWD/Class/Paladin/PaladinSpells.cpp \
+    $$PWD/Class/Mage/MageSpells.cpp \
+    $$PWD/Class/Hunter/HunterSpells.cpp \
+    $$PWD/Class/Druid/DruidSpells.cpp \
+    $$PWD/Character/Race/Race.cpp \
+    $$PWD/Class/Warrior/Spells/DefensiveStance.cpp \
+    $$PWD/Class/Warrior/Buffs/DefensiveStanceBuff.cpp \
+    $$PWD/Class/Warrior/Procs/SwordSpecialization.cpp \
+    $$PWD/Class/Warrior/Spells/MortalStrike.cpp \
+    $$PWD/Class/Warrior/Spells/Revenge.cpp \
+    $$PWD/Class/Warrior/Spells/ShieldSlam.cpp \
+    $$PWD/Class/Warrior/Spells/Slam.cpp \
+    $$PWD/Class/Warrior/Spells/SunderArmor.cpp \
+    $$PWD/Event/Events/CastComplete.cpp \
+    $$PWD/Talent/TalentRequirer.cpp \
+    $$PWD/GUI/SimSettings.cpp \
+    $$PWD/GUI/SimControl.cpp \
+    $$PWD/Statistics/NumberCruncher.cpp \
+    $$PWD/Class/Common/Enchants/Enchant.cpp \
+    $$PWD/Class/Common/Enchants/EnchantStatic.cpp \
+    $$PWD/Class/Common/Enchants/EnchantProc.cpp \
+    $$PWD/Class/Common/Buffs/ArmorPenetrationBuff.cpp \
+    $$PWD/Class/Common/Procs/ArmorPenetrationProc.cpp \
+    $$PWD/Class/Common/Spells/InstantSpellAttack.cpp \
+    $$PWD/Class/Common/Procs/InstantSpellProc.cpp \
+    $$PWD/Class/Common/Procs/FelstrikerProc.cpp \
+    $$PWD/Class/Common/Buffs/FelstrikerBuff.cpp \
+    $$PWD/Spells/SharedBuff.cpp \
+    $$PWD/Class/Common/Spells/PeriodicResourceGainSpell.cpp \
+    $$PWD/Rulesets/RulesetControl.cpp \
+    $$PWD/Rotation/RotationExecutor.cpp \
+    $$PWD/Class/Common/Buffs/GenericStatBuff.cpp \
+    $$PWD/Class/Common/Buffs/JomGabbar.cpp \
+    $$PWD/Event/Events/PeriodicRefreshBuff.cpp \
+    $$PWD/Class/Common/Buffs/FlatWeaponDamageBuff.cpp \
+    $$PWD/Class/Common/Procs/GenericChargeConsumerProc.cpp \
+    $$PWD/Class/Common/Spells/UseTrinket.cpp \
+    $$PWD/Class/Warrior/Spells/Rend.cpp \
+    $$PWD/Character/EnabledBuffs.cpp \
+    $$PWD/Character/EnabledProcs.cpp \
+    $$PWD/Class/Warrior/Spells/AngerManagement.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Assassination.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Combat.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Subtlety.cpp \
+    $$PWD/Class/Rogue/Spells/Backstab.cpp \
+    $$PWD/Resource/Rage.cpp \
+    $$PWD/Resource/Energy.cpp \
+    $$PWD/Resource/Mana.cpp \
+    $$PWD/Class/Rogue/Spells/Eviscerate.cpp \
+    $$PWD/Class/Rogue/Spells/SliceAndDice.cpp \
+    $$PWD/Class/Rogue/Buffs/SliceAndDiceBuff.cpp \
+    $$PWD/Class/Rogue/Spells/AdrenalineRush.cpp \
+    $$PWD/Class/Rogue/Buffs/AdrenalineRushBuff.cpp \
+    $$PWD/Class/Rogue/Spells/BladeFlurry.cpp \
+    $$PWD/Class/Rogue/Buffs/BladeFlurryBuff.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Combat/Precision.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Combat/DaggerSpecialization.cpp \
+    $$PWD/Class/Rogue/Spells/OffhandAttackRogue.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Combat/FistWeaponSpecialization.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Combat/MaceSpecialization.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Combat/WeaponExpertise.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Assassination/Malice.cpp \
+    $$PWD/Class/Rogue/Spells/SinisterStrike.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Assassination/Murder.cpp \
+    $$PWD/Class/Rogue/Procs/Ruthlessness.cpp \
+    $$PWD/Class/Rogue/Procs/RelentlessStrikes.cpp \
+    $$PWD/Class/Rogue/Procs/SealFate.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Assassination/Vigor.cpp \
+    $$PWD/CombatRoll/AttackTables/MagicAttackTable.cpp \
+    $$PWD/Class/Rogue/Procs/InstantPoison.cpp \
+    $$PWD/Class/Rogue/Buffs/InstantPoisonBuff.cpp \
+    $$PWD/Character/CharacterEnchants.cpp \
+    $$PWD/Class/Warrior/WarriorEnchants.cpp \
+    $$PWD/Class/Rogue/RogueEnchants.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Subtlety/SerratedBlades.cpp \
+    $$PWD/Class/Rogue/TalentTrees/Subtlety/Deadliness.cpp \
+    $$PWD/Class/Rogue/Spells/Hemorrhage.cpp \
+    $$PWD/Equipment/EquipmentDb/SetBonusFileReader.cpp \
+    $$PWD/Equipment/SetBonusControl.cpp \
+    $$PWD/Spells/SetBonusRequirer.cpp \
+    $$PWD/Spells/ItemModificationRequirer.cpp \
+    $$PWD/Character/CharacterLoader.cpp \
+    $$PWD/Class/Hunter/TalentTrees/BeastMastery.cpp \
+    $$PWD/Class/Hunter/TalentTrees/Marksmanship.cpp \
+    $$PWD/Class/Hunter/TalentTrees/Survival.cpp \
+    $$PWD/Class/Hunter/HunterEnchants.cpp \
+    $$PWD/Character/CharacterSpells.cpp \
+    $$PWD/CombatRoll/AttackTables/MeleeWhiteHitTable.cpp \
+    $$PWD/CombatRoll/AttackTables/RangedWhiteHitTable.cpp \
+    $$PWD/Class/Hunter/Spells/MultiShot.cpp \
+    $$PWD/Class/Hunter/Spells/AutoShot.cpp \
+    $$PWD/Class/Hunter/Spells/AimedShot.cpp \
+    $$PWD/Event/Events/RangedHit.cpp \
+    $$PWD/Utils/CompareDouble.cpp \
+    $$PWD/Utils/ModifierStack.cpp \
+    $$PWD/Talent/TalentStatIncrease.cpp \
+    $$PWD/Class/Hunter/Spells/HuntersMark.cpp \
+    $$PWD/Class/Hunter/Buffs/HuntersMarkBuff.cpp \
+    $$PWD/Class/Hunter/Spells/AspectOfTheHawk.cpp \
+    $$PWD/Class/Hunter/Buffs/AspectOfTheHawkBuff.cpp \
+    $$PWD/Class/Hunter/Buffs/ImprovedAspectOfTheHawkBuff.cpp \
+    $$PWD/Class/Hunter/Procs/ImprovedAspectOfTheHawkProc.cpp \
+    $$PWD/Class/Hunter/Spells/RapidFire.cpp \
+    $$PWD/Class/Hunter/Buffs/RapidFireBuff.cpp \
+    $$PWD/Class/Common/Buffs/DevilsaurEye.cpp \
+    $$PWD/Class/Common/Pet/Pet.cpp \
+    $$PWD/Event/Events/PetAction.cpp \
+    $$PWD/Class/Common/Pet/Species/Cat.cpp \
+    $$PWD/Class/Common/Pet/Spells/PetAutoAttack.cpp \
+    $$PWD/Event/Events/PetMeleeHit.cpp \
+    $$PWD/Class/Common/Pet/Spells/Claw.cpp \
+    $$PWD/Resource/Focus.cpp \
+    $$PWD/Resource/RegeneratingResource.cpp \
+    $$PWD/Class/Common/Spells/ResourceTick.cpp \
+    $$PWD/Class/Hunter/Spells/BestialWrath.cpp \
+    $$PWD/Class/Hunter/Buffs/BestialWrathBuff.cpp \
+    $$PWD/Class/Hunter/Buffs/FrenzyBuff.cpp \
+    $$PWD/Class/Hunter/Procs/FrenzyProc.cpp \
+    $$PWD/Equipment/EquipmentDb/ProjectileFileReader.cpp \
+    $$PWD/Equipment/Item/Projectile.cpp \
+    $$PWD/Class/Common/Spells/ManaPotion.cpp \
+    $$PWD/Class/Hunter/Procs/ExposeWeaknessProc.cpp \
+    $$PWD/Class/Hunter/Buffs/ExposeWeaknessBuff.cpp \
+    $$PWD/Class/Hunter/HunterPet.cpp \
+    $$PWD/Statistics/StatisticsEngine.cpp \
+    $$PWD/Statistics/StatisticsRotationExecutor.cpp \
+    $$PWD/Class/Paladin/TalentTrees/HolyPaladin.cpp \
+    $$PWD/Class/Paladin/TalentTrees/ProtectionPaladin.cpp \
+    $$PWD/Class/Paladin/TalentTrees/Retribution.cpp \
+    $$PWD/Class/Paladin/PaladinEnchants.cpp \
+    $$PWD/Class/Mage/Buffs/MageArmorBuff.cpp \
+    $$PWD/Class/Mage/Spells/MageArmor.cpp
+
+HEADERS += \
+    $$PWD/Class/Common/Buffs/CharmOfTrickery.h \
+    $$PWD/Class/Common/Buffs/NoEffectSelfBuff.h \
+    $$PWD/Class/Common/Buffs/NoEffectUniqueDebuff.h \
+    $$PWD/Class/Common/Buffs/SanctifiedOrb.h \
+    $$PWD/Class/Common/Buffs/SuppressCastBuff.h \
+    $$PWD/Class/Common/Buffs/ZandalarianHeroCharm.h \
+    $$PWD/Class/Common/Enchants/EnchantName.h \
+    $$PWD/Class/Common/Procs/ResourceGainProc.h \
+    $$PWD/Class/Common/Spells/DragonbreathChili.h \
+    $$PWD/Class/Common/Spells/EssenceOfTheRed.h \
+    $$PWD/Class/Common/Spells/PeriodicDamageSpell.h \
+    $$PWD/Class/Common/Spells/UseItem.h \
+    $$PWD/Class/Druid/Buffs/BearFormBuff.h \
+    $$PWD/Class/Druid/Buffs/CatFormBuff.h \
+    $$PWD/Class/Druid/Buffs/LeaderOfThePack.h \
+    $$PWD/Class/Druid/Buffs/MoonkinFormBuff.h \
+    $$PWD/Class/Druid/Buffs/NaturesGrace.h \
+    $$PWD/Class/Druid/Buffs/TigersFuryBuff.h \
+    $$PWD/Class/Druid/DruidEnchants.h \
+    $$PWD/Class/Druid/Procs/BloodFrenzy.h \
+    $$PWD/Class/Druid/Procs/ClearcastingDruid.h \
+    $$PWD/Class/Druid/Procs/Furor.h \
+    $$PWD/Class/Druid/Procs/PrimalFury.h \
+    $$PWD/Class/Druid/Spells/BearForm.h \
+    $$PWD/Class/Druid/Spells/CasterForm.h \
+    $$PWD/Class/Druid/Spells/CatForm.h \
+    $$PWD/Class/Druid/Spells/Enrage.h \
+    $$PWD/Class/Druid/Spells/FerociousBite.h \
+    $$PWD/Class/Druid/Spells/MainhandAttackDruid.h \
+    $$PWD/Class/Druid/Spells/Maul.h \
+    $$PWD/Class/Druid/Spells/Moonfire.h \
+    $$PWD/Class/Druid/Spells/MoonkinForm.h \
+    $$PWD/Class/Druid/Spells/Shred.h \
+    $$PWD/Class/Druid/Spells/Starfire.h \
+    $$PWD/Class/Druid/Spells/Swipe.h \
+    $$PWD/Class/Druid/Spells/TigersFury.h \
+    $$PWD/Class/Druid/Spells/Wrath.h \
+    $$PWD/Class/Druid/TalentTrees/Balance.h \
+    $$PWD/Class/Druid/TalentTrees/FeralCombat.h \
+    $$PWD/Class/Druid/TalentTrees/RestorationDruid.h \
+    $$PWD/Class/Mage/Buffs/ArcanePowerBuff.h \
+    $$PWD/Class/Mage/Buffs/CombustionBuff.h \
+    $$PWD/Class/Mage/Buffs/ElementalVulnerability.h \
+    $$PWD/Class/Mage/Buffs/EvocationBuff.h \
+    $$PWD/Class/Mage/Buffs/FireVulnerability.h \
+    $$PWD/Class/Mage/Buffs/IgniteBuff.h \
+    $$PWD/Class/Mage/Buffs/WintersChill.h \
+    $$PWD/Class/Mage/MageEnchants.h \
+    $$PWD/Class/Mage/Procs/ClearcastingMage.h \
+    $$PWD/Class/Mage/Procs/ImprovedScorch.h \
+    $$PWD/Class/Mage/Procs/WintersChillProc.h \
+    $$PWD/Class/Mage/Spells/ArcaneMissiles.h \
+    $$PWD/Class/Mage/Spells/ArcanePower.h \
+    $$PWD/Class/Mage/Spells/Combustion.h \
+    $$PWD/Class/Mage/Spells/Evocation.h \
+    $$PWD/Class/Mage/Spells/Fireball.h \
+    $$PWD/Class/Mage/Spells/Frostbolt.h \
+    $$PWD/Class/Mage/Spells/Ignite.h \
+    $$PWD/Class/Mage/Spells/RobeOfTheArchmage.h \
+    $$PWD/Class/Mage/Spells/Scorch.h \
+    $$PWD/Class/Mage/TalentTrees/Arcane.h \
+    $$PWD/Class/Mage/TalentTrees/Fire.h \
+    $$PWD/Class/Mage/TalentTrees/Frost.h \
+    $$PWD/Class/Paladin/Buffs/JudgementOfTheCrusader.h \
+    $$PWD/Class/Paladin/Buffs/SanctityAuraBuff.h \
+    $$PWD/Class/Paladin/Buffs/SealOfTheCrusaderBuff.h \
+    $$PWD/Class/Paladin/Buffs/Vengeance.h \
+    $$PWD/Class/Paladin/Procs/SealOfCommandProc.h \
+    $$PWD/Class/Paladin/Spells/Consecration.h \
+    $$PWD/Class/Paladin/Spells/Judgement.h \
+    $$PWD/Class/Paladin/Spells/MainhandAttackPaladin.h \
+    $$PWD/Class/Paladin/Spells/PaladinSeal.h \
+    $$PWD/Class/Paladin/Spells/SanctityAura.h \
+    $$PWD/Class/Paladin/Spells/SealOfCommand.h \
+    $$PWD/Class/Paladin/Spells/SealOfTheCrusader.h \
+    $$PWD/Class/Common/Buffs/Nightfall.h \
+    $$PWD/Class/Common/Procs/GenericBuffProc.h \
+    $$PWD/Class/Common/Procs/GenericSpellProc.h \
+    $$PWD/Class/Common/Spells/DemonicRune.h \
+    $$PWD/Class/Common/Spells/FireballInstant.h \
+    $$PWD/Class/Common/Spells/NightDragonsBreath.h \
+    $$PWD/Class/Rogue/Spells/ThistleTea.h \
+    $$PWD/Class/Shaman/Buffs/ElementalDevastation.h \
+    $$PWD/Class/Shaman/Buffs/StormstrikeBuff.h \
+    $$PWD/Class/Shaman/Procs/ClearcastingShaman.h \
+    $$PWD/Class/Shaman/Procs/WindfuryWeaponProc.h \
+    $$PWD/Class/Shaman/ShamanEnchants.h \
+    $$PWD/Class/Shaman/Spells/LightningBolt.h \
+    $$PWD/Class/Shaman/Spells/Stormstrike.h \
+    $$PWD/Class/Shaman/Spells/WindfuryWeapon.h \
+    $$PWD/Class/Shaman/TalentTrees/Elemental.h \
+    $$PWD/Class/Shaman/TalentTrees/Enhancement.h \
+    $$PWD/Class/Shaman/TalentTrees/RestorationShaman.h \
+    $$PWD/Class/Warlock/Buffs/ImprovedShadowBolt.h \
+    $$PWD/Class/Warlock/Spells/LifeTap.h \
+    $$PWD/Class/Warlock/TalentTrees/Affliction.h \
+    $$PWD/Class/Warlock/TalentTrees/Demonology.h \
+    $$PWD/Class/Warlock/TalentTrees/Destruction.h \
+    $$PWD/Class/Warlock/Spells/ShadowBolt.h \
+    $$PWD/Class/Warlock/WarlockEnchants.h \
+    $$PWD/Equipment/Item/RandomAffix.h \
+    $$PWD/Equipment/Item/Quiver.h \
+    $$PWD/Equipment/RandomAffixes.h \
+    $$PWD/Event/Events/SpellCallback.h \
+    $$PWD/Phases/ContentPhase.h \
+    $$PWD/Phases/PhaseRequirer.h \
+    $$PWD/Queue/CalendarQueue.h \
+    $$PWD/Queue/HeapQueue.h \
+    $$PWD/Queue/Queue.h \
+    $$PWD/Event/Event.h \
+    $$PWD/Event/EventHandle.h \
+    $$PWD/Event/EventPool.h \
+    $$PWD/Engine/Engine.h \
+    $$PWD/Event/Events/EncounterEnd.h \
+    $$PWD/Event/Events/IncomingDamageEvent.h \
+    $$PWD/Event/Events/EncounterStart.h \
+    $$PWD/Character/Character.h \
+    $$PWD/Character/Race/Race.h \
+    $$PWD/Character/Race/Races/Human.h \
+    $$PWD/Character/Race/Races/Dwarf.h \
+    $$PWD/Character/Race/Races/NightElf.h \
+    $$PWD/Character/Race/Races/Gnome.h \
+    $$PWD/Character/Race/Races/Orc.h \
+    $$PWD/Character/Race/Races/Undead.h \
+    $$PWD/Character/Race/Races/Tauren.h \
+    $$PWD/Character/Race/Races/Troll.h \
+    $$PWD/Class/Warrior/Warrior.h \
+    $$PWD/Class/Priest/Priest.h \
+    $$PWD/Class/Rogue/Rogue.h \
+    $$PWD/Class/Mage/Mage.h \
+    $$PWD/Class/Druid/Druid.h \
+    $$PWD/Class/Hunter/Hunter.h \
+    $$PWD/Class/Warlock/Warlock.h \
+    $$PWD/Class/Shaman/Shaman.h \
+    $$PWD/Class/Paladin/Paladin.h \
+    $$PWD/Event/Events/PlayerAction.h \
+    $$PWD/Raid/RaidControl.h \
+    $$PWD/Rotation/Conditions/ConditionBuffDuration.h \
+    $$PWD/Rotation/Conditions/ConditionBuffStacks.h \
+    $$PWD/Spells/CastingTimeRequirer.h \
+    $$PWD/Spells/CooldownControl.h \
+    $$PWD/Spells/PartyBuff.h \
+    $$PWD/Spells/SelfBuff.h \
+    $$PWD/Spells/SharedDebuff.h \
+    $$PWD/Spells/SpellPeriodic.h \
+    $$PWD/Spells/SpellRankGroup.h \
+    $$PWD/Spells/UniqueDebuff.h \
+    $$PWD/Statistics/RaidMemberResult.h \
+    $$PWD/Talent/CharacterTalents.h \
+    $$PWD/Equipment/Equipment.h \
+    $$PWD/Equipment/Item/Item.h \
+    $$PWD/Target/Target.h \
+    $$PWD/CombatRoll/PhysicalAttackResult.h \
+    $$PWD/CombatRoll/MagicAttackResult.h \
+    $$PWD/CombatRoll/AttackTables/MagicAttackTable.h \
+    $$PWD/CombatRoll/CombatRoll.h \
+    $$PWD/CombatRoll/Random.h \
+    $$PWD/Spells/Spell.h \
+    $$PWD/Class/Warrior/Spells/Bloodthirst.h \
+    $$PWD/Event/Events/OffhandMeleeHit.h \
+    $$PWD/Event/Events/MainhandMeleeHit.h \
+    $$PWD/Class/Warrior/Spells/Whirlwind.h \
+    $$PWD/Class/Warrior/Spells/Execute.h \
+    $$PWD/Class/Warrior/Spells/HeroicStrike.h \
+    $$PWD/Class/Warrior/Spells/Overpower.h \
+    $$PWD/Class/Warrior/Spells/Hamstring.h \
+    $$PWD/Class/Warrior/Spells/Recklessness.h \
+    $$PWD/CombatRoll/AttackTables/MeleeSpecialTable.h \
+    $$PWD/Mechanics/Mechanics.h \
+    $$PWD/Spells/Buff.h \
+    $$PWD/Class/Warrior/Buffs/Flurry.h \
+    $$PWD/Event/Events/BuffRemoval.h \
+    $$PWD/Talent/TalentTree.h \
+    $$PWD/Talent/Talent.h \
+    $$PWD/Class/Warrior/TalentTrees/Arms.h \
+    $$PWD/Class/Warrior/TalentTrees/Fury.h \
+    $$PWD/Class/Warrior/TalentTrees/Protection.h \
+    $$PWD/Class/Warrior/TalentTrees/Arms/Impale.h \
+    $$PWD/Class/Warrior/TalentTrees/Arms/TacticalMastery.h \
+    $$PWD/Class/Warrior/TalentTrees/Arms/TwoHandedWeaponSpecialization.h \
+    $$PWD/Class/Warrior/TalentTrees/Arms/AxeSpecialization.h \
+    $$PWD/Class/Warrior/TalentTrees/Arms/PolearmSpecialization.h \
+    $$PWD/Character/Stats.h \
+    $$PWD/Class/Warrior/Spells/DeepWounds.h \
+    $$PWD/Event/Events/DotTick.h \
+    $$PWD/Class/Warrior/Procs/UnbridledWrath.h \
+    $$PWD/Class/Warrior/Spells/DeathWish.h \
+    $$PWD/Class/Warrior/Buffs/DeathWishBuff.h \
+    $$PWD/Class/Warrior/Buffs/BattleShoutBuff.h \
+    $$PWD/Class/Warrior/Spells/BattleShout.h \
+    $$PWD/Class/Warrior/Spells/BerserkerRage.h \
+    $$PWD/Equipment/EquipmentDb/EquipmentDb.h \
+    $$PWD/Equipment/EquipmentDb/EquipmentDbCache.h \
+    $$PWD/Equipment/EquipmentDb/ItemFileReader.h \
+    $$PWD/Equipment/EquipmentDb/WeaponFileReader.h \
+    $$PWD/Equipment/Item/Weapon.h \
+    $$PWD/Class/Common/Spells/MainhandAttack.h \
+    $$PWD/Class/Common/Spells/OffhandAttack.h \
+    $$PWD/Class/Warrior/Spells/MainhandAttackWarrior.h \
+    $$PWD/Class/Warrior/Spells/OffhandAttackWarrior.h \
+    $$PWD/Class/Warrior/Spells/Bloodrage.h \
+    $$PWD/Spells/Proc.h \
+    $$PWD/Class/Common/Enchants/WindfuryTotemAttack.h \
+    $$PWD/Class/Common/Enchants/Crusader.h \
+    $$PWD/Spells/ProcPPM.h \
+    $$PWD/Class/Common/Buffs/HolyStrength.h \
+    $$PWD/Class/Common/Enchants/FieryWeapon.h \
+    $$PWD/Character/CharacterStats.h \
+    $$PWD/Class/Warrior/WarriorSpells.h \
+    $$PWD/Statistics/ClassStatistics.h \
+    $$PWD/Faction/Faction.h \
+    $$PWD/Statistics/StatisticsSpell.h \
+    $$PWD/Statistics/StatisticsBuff.h \
+    $$PWD/Statistics/StatisticsResource.h \
+    $$PWD/Statistics/StatisticsProc.h \
+    $$PWD/Statistics/RunningStatistics.h \
+    $$PWD/Spells/ProcInfo.h \
+    $$PWD/Class/Common/Procs/ExtraAttackOnNextSwingProc.h \
+    $$PWD/Class/Common/Buffs/ExtraAttackOnNextSwingBuff.h \
+    $$PWD/Class/Common/Procs/ExtraAttackInstantProc.h \
+    $$PWD/Class/Common/GeneralProcs.h \
+    $$PWD/Character/CharacterDecoder.h \
+    $$PWD/Character/CharacterEncoder.h \
+    $$PWD/Thread/IterationScheduler.h \
+    $$PWD/Thread/SimulationThreadPool.h \
+    $$PWD/Thread/SimulationRunner.h \
+    $$PWD/Optimizer/SetupEvaluator.h \
+    $$PWD/Optimizer/EvaluatorPool.h \
+    $$PWD/Optimizer/GearOptimizer.h \
+    $$PWD/Optimizer/TalentOptimizer.h \
+    $$PWD/Class/Common/GeneralBuffs.h \
+    $$PWD/Spells/ExternalBuff.h \
+    $$PWD/Rotation/RotationFileReader.h \
+    $$PWD/Rotation/Rotation.h \
+    $$PWD/Rotation/Condition.h \
+    $$PWD/Rotation/ConditionProgram.h \
+    $$PWD/Rotation/Conditions/ConditionSpell.h \
+    $$PWD/Rotation/Conditions/ConditionResource.h \
+    $$PWD/Rotation/Conditions/ConditionVariableBuiltin.h \
+    $$PWD/CombatRoll/xorshift/xoroshiro128plus.h \
+    $$PWD/Class/Warrior/Buffs/RecklessnessBuff.h \
+    $$PWD/Class/Warrior/Spells/BattleStance.h \
+    $$PWD/Class/Warrior/Spells/BerserkerStance.h \
+    $$PWD/Class/Warrior/Buffs/BattleStanceBuff.h \
+    $$PWD/Class/Warrior/Buffs/BerserkerStanceBuff.h \
+    $$PWD/Character/Race/Racials/BloodFury.h \
+    $$PWD/Character/Race/Racials/BloodFuryBuff.h \
+    $$PWD/Character/Race/Racials/Berserking.h \
+    $$PWD/Character/Race/Racials/BerserkingBuff.h \
+    $$PWD/Equipment/Item/ItemNamespace.h \
+    $$PWD/Class/Warlock/WarlockSpells.h \
+    $$PWD/Class/Shaman/ShamanSpells.h \
+    $$PWD/Class/Rogue/RogueSpells.h \
+    $$PWD/Class/Priest/PriestSpells.h \
+    $$PWD/Class/Paladin/PaladinSpells.h \
+    $$PWD/Class/Mage/MageSpells.h \
+    $$PWD/Class/Hunter/HunterSpells.h \
+    $$PWD/Class/Druid/DruidSpells.h \
+    $$PWD/Equipment/Item/ItemStatsEnum.h \
+    $$PWD/Class/Warrior/Spells/DefensiveStance.h \
+    $$PWD/Class/Warrior/Buffs/DefensiveStanceBuff.h \
+    $$PWD/Class/Warrior/Procs/SwordSpecialization.h \
+    $$PWD/Class/Warrior/Spells/MortalStrike.h \
+    $$PWD/Class/Warrior/Spells/Revenge.h \
+    $$PWD/Class/Warrior/Spells/ShieldSlam.h \
+    $$PWD/Class/Warrior/Spells/Slam.h \
+    $$PWD/Class/Warrior/Spells/SunderArmor.h \
+    $$PWD/Event/Events/CastComplete.h \
+    $$PWD/Talent/TalentRequirer.h \
+    $$PWD/GUI/SimSettings.h \
+    $$PWD/GUI/SimControl.h \
+    $$PWD/Statistics/NumberCruncher.h \
+    $$PWD/Class/Common/Enchants/Enchant.h \
+    $$PWD/Class/Common/Enchants/EnchantStatic.h \
+    $$PWD/Class/Common/Enchants/EnchantProc.h \
+    $$PWD/Class/Common/Buffs/ArmorPenetrationBuff.h \
+    $$PWD/Class/Common/Procs/ArmorPenetrationProc.h \
+    $$PWD/Class/Common/Spells/InstantSpellAttack.h \
+    $$PWD/Class/Common/Procs/InstantSpellProc.h \
+    $$PWD/Spells/MagicSchools.h \
+    $$PWD/Class/Common/Procs/FelstrikerProc.h \
+    $$PWD/Class/Common/Buffs/FelstrikerBuff.h \
+    $$PWD/Spells/SharedBuff.h \
+    $$PWD/Resource/Resource.h \
+    $$PWD/Class/Common/Spells/PeriodicResourceGainSpell.h \
+    $$PWD/Rulesets/Rulesets.h \
+    $$PWD/Rulesets/RulesetControl.h \
+    $$PWD/Faction/AvailableFactions.h \
+    $$PWD/Rotation/RotationExecutor.h \
+    $$PWD/Class/Common/Buffs/GenericStatBuff.h \
+    $$PWD/Class/Common/Buffs/JomGabbar.h \
+    $$PWD/Event/Events/PeriodicRefreshBuff.h \
+    $$PWD/Class/Common/Buffs/FlatWeaponDamageBuff.h \
+    $$PWD/Class/Common/Procs/GenericChargeConsumerProc.h \
+    $$PWD/Class/Common/Spells/UseTrinket.h \
+    $$PWD/Class/Warrior/Spells/Rend.h \
+    $$PWD/Character/EnabledBuffs.h \
+    $$PWD/Character/EnabledProcs.h \
+    $$PWD/Class/Warrior/Spells/AngerManagement.h \
+    $$PWD/GUI/SimOption.h \
+    $$PWD/Class/Rogue/TalentTrees/Assassination.h \
+    $$PWD/Class/Rogue/TalentTrees/Combat.h \
+    $$PWD/Class/Rogue/TalentTrees/Subtlety.h \
+    $$PWD/Class/Rogue/Spells/Backstab.h \
+    $$PWD/Resource/Rage.h \
+    $$PWD/Resource/Energy.h \
+    $$PWD/Resource/Mana.h \
+    $$PWD/Class/Rogue/Spells/Eviscerate.h \
+    $$PWD/Class/Rogue/Spells/SliceAndDice.h \
+    $$PWD/Class/Rogue/Buffs/SliceAndDiceBuff.h \
+    $$PWD/Class/Rogue/Spells/AdrenalineRush.h \
+    $$PWD/Class/Rogue/Buffs/AdrenalineRushBuff.h \
+    $$PWD/Class/Rogue/Spells/BladeFlurry.h \
+    $$PWD/Class/Rogue/Buffs/BladeFlurryBuff.h \
+    $$PWD/Class/Rogue/TalentTrees/Combat/Precision.h \
+    $$PWD/Class/Rogue/TalentTrees/Combat/DaggerSpecialization.h \
+    $$PWD/Class/Rogue/Spells/OffhandAttackRogue.h \
+    $$PWD/Class/Rogue/TalentTrees/Combat/FistWeaponSpecialization.h \
+    $$PWD/Class/Rogue/TalentTrees/Combat/MaceSpecialization.h \
+    $$PWD/Class/Rogue/TalentTrees/Combat/WeaponExpertise.h \
+    $$PWD/Class/Rogue/TalentTrees/Assassination/Malice.h \
+    $$PWD/Class/Rogue/Spells/SinisterStrike.h \
+    $$PWD/Class/Rogue/TalentTrees/Assassination/Murder.h \
+    $$PWD/Class/Rogue/Procs/Ruthlessness.h \
+    $$PWD/Class/Rogue/Procs/RelentlessStrikes.h \
+    $$PWD/Class/Rogue/Procs/SealFate.h \
+    $$PWD/Class/Rogue/TalentTrees/Assassination/Vigor.h \
+    $$PWD/Class/Rogue/Procs/InstantPoison.h \
+    $$PWD/Class/Rogue/Buffs/InstantPoisonBuff.h \
+    $$PWD/Character/CharacterEnchants.h \
+    $$PWD/Class/Warrior/WarriorEnchants.h \
+    $$PWD/Class/Rogue/RogueEnchants.h \
+    $$PWD/Class/Rogue/TalentTrees/Subtlety/SerratedBlades.h \
+    $$PWD/Class/Rogue/TalentTrees/Subtlety/Deadliness.h \
+    $$PWD/Class/Rogue/Spells/Hemorrhage.h \
+    $$PWD/Equipment/EquipmentDb/SetBonusFileReader.h \
+    $$PWD/Equipment/SetBonusControl.h \
+    $$PWD/Spells/SetBonusRequirer.h \
+    $$PWD/Spells/ItemModificationRequirer.h \
+    $$PWD/Character/CharacterLoader.h \
+    $$PWD/Class/Hunter/TalentTrees/BeastMastery.h \
+    $$PWD/Class/Hunter/TalentTrees/Marksmanship.h \
+    $$PWD/Class/Hunter/TalentTrees/Survival.h \
+    $$PWD/Class/Hunter/HunterEnchants.h \
+    $$PWD/Character/CharacterSpells.h \
+    $$PWD/CombatRoll/AttackTables/AttackTableThresholds.h \
+    $$PWD/CombatRoll/AttackTables/MeleeWhiteHitTable.h \
+    $$PWD/CombatRoll/AttackTables/RangedWhiteHitTable.h \
+    $$PWD/Class/Hunter/Spells/MultiShot.h \
+    $$PWD/Class/Hunter/Spells/AutoShot.h \
+    $$PWD/Class/Hunter/Spells/AimedShot.h \
+    $$PWD/Utils/Check.h \
+    $$PWD/Class/Common/AttackMode.h \
+    $$PWD/Event/Events/RangedHit.h \
+    $$PWD/Utils/CompareDouble.h \
+    $$PWD/Utils/ModifierStack.h \
+    $$PWD/Talent/TalentStatIncrease.h \
+    $$PWD/Class/Hunter/Spells/HuntersMark.h \
+    $$PWD/Class/Hunter/Buffs/HuntersMarkBuff.h \
+    $$PWD/Class/Hunter/Spells/AspectOfTheHawk.h \
+    $$PWD/Class/Hunter/Buffs/AspectOfTheHawkBuff.h \
+    $$PWD/Class/Hunter/Buffs/ImprovedAspectOfTheHawkBuff.h \
+    $$PWD/Class/Hunter/Procs/ImprovedAspectOfTheHawkProc.h \
+    $$PWD/Class/Hunter/Spells/RapidFire.h \
+    $$PWD/Class/Hunter/Buffs/RapidFireBuff.h \
+    $$PWD/Class/Common/Buffs/DevilsaurEye.h \
+    $$PWD/Class/Common/Pet/Pet.h \
+    $$PWD/Event/Events/PetAction.h \
+    $$PWD/Class/Common/Pet/Species/Cat.h \
+    $$PWD/Class/Common/Pet/Spells/PetAutoAttack.h \
+    $$PWD/Event/Events/PetMeleeHit.h \
+    $$PWD/Class/Common/Pet/Spells/Claw.h \
+    $$PWD/Resource/Focus.h \
+    $$PWD/Resource/RegeneratingResource.h \
+    $$PWD/Class/Common/Spells/ResourceTick.h \
+    $$PWD/Class/Hunter/Spells/BestialWrath.h \
+    $$PWD/Class/Hunter/Buffs/BestialWrathBuff.h \
+    $$PWD/Class/Hunter/Buffs/FrenzyBuff.h \
+    $$PWD/Class/Hunter/Procs/FrenzyProc.h \
+    $$PWD/Equipment/EquipmentDb/ProjectileFileReader.h \
+    $$PWD/Equipment/Item/Projectile.h \
+    $$PWD/Class/Common/Spells/ManaPotion.h \
+    $$PWD/Class/Hunter/Procs/ExposeWeaknessProc.h \
+    $$PWD/Class/Hunter/Buffs/ExposeWeaknessBuff.h \
+    $$PWD/Class/Hunter/HunterPet.h \
+    $$PWD/Statistics/StatisticsEngine.h \
+    $$PWD/Statistics/StatisticsRotationExecutor.h \
+    $$PWD/Class/Paladin/TalentTrees/HolyPaladin.h \
+    $$PWD/Class/Paladin/TalentTrees/ProtectionPaladin.h \
+    $$PWD/Class/Paladin/TalentTrees/Retribution.h \
+    $$PWD/Class/Paladin/PaladinEnchants.h \
+    $$PWD/Class/Mage/Buffs/MageArmorBuff.h \
+    $$PWD/Class/Mage/Spells/MageArmor.h
+
+INCLUDEPATH += \
+    $$PWD \
+    $$PWD/Engine \
+    $$PWD/Event \
+    $$PWD/Event/Events \
+    $$PWD/Queue \
+    $$PWD/Character \
+    $$PWD/Character/Race \
+    $$PWD/Character/Race/Races \
+    $$PWD/Character/Race/Racials \
+    $$PWD/Character/Class \
+    $$PWD/Class/Warrior \
+    $$PWD/Class/Warrior/Spells \
+    $$PWD/Class/Warrior/Buffs \
+    $$PWD/Class/Warrior/Procs \
+    $$PWD/Class/Warrior/TalentTrees \
+    $$PWD/Class/Warrior/TalentTrees/Fury \
+    $$PWD/Class/Warrior/TalentTrees/Arms \
+    $$PWD/Class/Warrior/TalentTrees/Prot \
+    $$PWD/Class/Priest \
+    $$PWD/Class/Rogue \
+    $$PWD/Class/Rogue/Buffs \
+    $$PWD/Class/Rogue/Procs \
+    $$PWD/Class/Rogue/Spells \
+    $$PWD/Class/Rogue/TalentTrees \
+    $$PWD/Class/Rogue/TalentTrees/Assassination \
+    $$PWD/Class/Rogue/TalentTrees/Combat \
+    $$PWD/Class/Rogue/TalentTrees/Subtlety \
+    $$PWD/Class/Mage \
+    $$PWD/Class/Mage/Buffs \
+    $$PWD/Class/Mage/Procs \
+    $$PWD/Class/Mage/Spells \
+    $$PWD/Class/Mage/TalentTrees \
+    $$PWD/Class/Druid \
+    $$PWD/Class/Druid/Buffs \
+    $$PWD/Class/Druid/Procs \
+    $$PWD/Class/Druid/Spells \
+    $$PWD/Class/Druid/TalentTrees \
+    $$PWD/Class/Hunter \
+    $$PWD/Class/Hunter/Buffs \
+    $$PWD/Class/Hunter/Procs \
+    $$PWD/Class/Hunter/Spells \
+    $$PWD/Class/Hunter/TalentTrees \
+    $$PWD/Class/Warlock \
+    $$PWD/Class/Warlock/Buffs \
+    $$PWD/Class/Warlock/TalentTrees \
+    $$PWD/Class/Warlock/Spells \
+    $$PWD/Class/Shaman \
+    $$PWD/Class/Shaman/Buffs \
+    $$PWD/Class/Shaman/Procs \
+    $$PWD/Class/Shaman/Spells \
+    $$PWD/Class/Shaman/TalentTrees \
+    $$PWD/Class/Paladin \
+    $$PWD/Class/Paladin/Buffs \
+    $$PWD/Class/Paladin/Procs \
+    $$PWD/Class/Paladin/Spells \
+    $$PWD/Class/Paladin/TalentTrees \
+    $$PWD/Equipment \
+    $$PWD/Equipment/Item \
+    $$PWD/Equipment/EquipmentDb \
+    $$PWD/CombatRoll \
+    $$PWD/CombatRoll/AttackTables \
+    $$PWD/CombatRoll/xorshift \
+    $$PWD/Target \
+    $$PWD/Spells \
+    $$PWD/Statistics \
+    $$PWD/Statistics/Charts \
+    $$PWD/Mechanics \
+    $$PWD/Class/Common \
+    $$PWD/Class/Common/Enchants \
+    $$PWD/Class/Common/Buffs \
+    $$PWD/Class/Common/Spells \
+    $$PWD/Class/Common/Procs \
+    $$PWD/Class/Common/Pet \
+    $$PWD/Class/Common/Pet/Species \
+    $$PWD/Class/Common/Pet/Spells \
+    $$PWD/GUI \
+    $$PWD/Faction \
+    $$PWD/Thread \
+    $$PWD/Optimizer \
+    $$PWD/Raid \
+    $$PWD/Rotation \
+    $$PWD/Rotation/Conditions \
+    $$PWD/Rulesets \
+    $$PWD/Phases \
+    $$PWD/Resource \
+    $$PWD/Talent
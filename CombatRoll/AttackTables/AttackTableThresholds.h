@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+// Cumulative upper bounds of the outcomes on a physical attack table, in table order. An outcome that is
+// excluded from the roll (or has no range) ends where the previous one ends, so it can never be rolled.
+struct AttackTableThresholds {
+    unsigned miss;
+    unsigned dodge;
+    unsigned parry;
+    unsigned glancing;
+    unsigned block;
+};
+
+// One row of thresholds per combination of the include_* flags, computed when a range changes rather than on every roll.
+static const int NUM_INCLUDE_MASKS = 16;
+using AttackTableRows = std::array<AttackTableThresholds, NUM_INCLUDE_MASKS>;
+
+inline int get_include_mask(const bool include_dodge, const bool include_parry, const bool include_block, const bool include_miss) {
+    return (include_dodge ? 1 : 0) | (include_parry ? 2 : 0) | (include_block ? 4 : 0) | (include_miss ? 8 : 0);
+}
+
+inline AttackTableRows get_attack_table_rows(
+    const unsigned miss_range, const unsigned dodge_range, const unsigned parry_range, const unsigned glancing_range, const unsigned block_range) {
+    AttackTableRows rows;
+    for (int mask = 0; mask < NUM_INCLUDE_MASKS; ++mask) {
+        AttackTableThresholds& row = rows[static_cast<size_t>(mask)];
+        row.miss = (mask & 8) ? miss_range : 0;
+        row.dodge = row.miss + ((mask & 1) ? dodge_range : 0);
+        row.parry = row.dodge + ((mask & 2) ? parry_range : 0);
+        row.glancing = row.parry + glancing_range;
+        row.block = row.glancing + ((mask & 4) ? block_range : 0);
+    }
+
+    return rows;
+}
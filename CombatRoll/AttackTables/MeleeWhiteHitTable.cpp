@@ -20,34 +20,29 @@ int MeleeWhiteHitTable::get_outcome(const unsigned roll,
                                     const bool include_parry,
                                     const bool include_block,
                                     const bool include_miss) {
-    check((roll < 10000), "Roll outside range");
+    hot_check((roll < 10000), "Roll outside range");
 
-    unsigned range = 0;
+    const AttackTableThresholds& row = rows[static_cast<size_t>(get_include_mask(include_dodge, include_parry, include_block, include_miss))];
 
-    if (include_miss && roll < this->miss_range)
+    if (roll < row.miss)
         return PhysicalAttackResult::MISS;
-    range += include_miss ? miss_range : 0;
 
-    if (include_dodge && roll < (range + this->dodge_range))
+    if (roll < row.dodge)
         return PhysicalAttackResult::DODGE;
-    range += include_dodge ? dodge_range : 0;
 
-    if (include_parry && roll < (range + this->parry_range))
+    if (roll < row.parry)
         return PhysicalAttackResult::PARRY;
-    range += include_parry ? parry_range : 0;
 
-    if (roll < (range + this->glancing_range))
+    if (roll < row.glancing)
         return PhysicalAttackResult::GLANCING;
-    range += glancing_range;
 
-    if (include_block && roll < (range + this->block_range)) {
-        if (random->get_roll() < range + crit_chance)
+    if (roll < row.block) {
+        if (random->get_roll() < row.glancing + crit_chance)
             return PhysicalAttackResult::BLOCK_CRITICAL;
         return PhysicalAttackResult::BLOCK;
     }
-    range += include_block ? block_range : 0;
 
-    if (roll < range + crit_chance)
+    if (roll < row.block + crit_chance)
         return PhysicalAttackResult::CRITICAL;
 
     return PhysicalAttackResult::HIT;
@@ -55,20 +50,29 @@ int MeleeWhiteHitTable::get_outcome(const unsigned roll,
 
 void MeleeWhiteHitTable::update_miss_chance(const unsigned miss) {
     this->miss_range = miss;
+    update_rows();
 }
 
 void MeleeWhiteHitTable::update_dodge_chance(const double dodge) {
     this->dodge_range = static_cast<unsigned>(round(dodge * 10000));
+    update_rows();
 }
 
 void MeleeWhiteHitTable::update_parry_chance(const double parry) {
     this->parry_range = static_cast<unsigned>(round(parry * 10000));
+    update_rows();
 }
 
 void MeleeWhiteHitTable::update_glancing_chance(const double glancing) {
     this->glancing_range = static_cast<unsigned>(round(glancing * 10000));
+    update_rows();
 }
 
 void MeleeWhiteHitTable::update_block_chance(const double block) {
     this->block_range = static_cast<unsigned>(round(block * 10000));
+    update_rows();
+}
+
+void MeleeWhiteHitTable::update_rows() {
+    rows = get_attack_table_rows(miss_range, dodge_range, parry_range, glancing_range, block_range);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AttackTableThresholds.h"
 #include "PhysicalAttackResult.h"
 
 class Random;
@@ -32,9 +33,13 @@ public:
 private:
     Random* random;
 
-    unsigned miss_range;
-    unsigned dodge_range;
-    unsigned parry_range;
-    unsigned glancing_range;
-    unsigned block_range;
+    unsigned miss_range {0};
+    unsigned dodge_range {0};
+    unsigned parry_range {0};
+    unsigned glancing_range {0};
+    unsigned block_range {0};
+
+    AttackTableRows rows;
+
+    void update_rows();
 };
@@ -11,22 +11,20 @@ RangedWhiteHitTable::RangedWhiteHitTable(Random* random, const unsigned wpn_skil
 }
 
 int RangedWhiteHitTable::get_outcome(const unsigned roll, const unsigned crit_chance, const bool include_block, const bool include_miss) {
-    check((roll < 10000), "Roll outside range");
+    hot_check((roll < 10000), "Roll outside range");
 
-    unsigned range = 0;
+    const AttackTableThresholds& row = rows[static_cast<size_t>(get_include_mask(false, false, include_block, include_miss))];
 
-    if (include_miss && roll < this->miss_range)
+    if (roll < row.miss)
         return PhysicalAttackResult::MISS;
-    range += include_miss ? miss_range : 0;
 
-    if (include_block && roll < (range + this->block_range)) {
-        if (random->get_roll() < range + crit_chance)
+    if (roll < row.block) {
+        if (random->get_roll() < row.miss + crit_chance)
             return PhysicalAttackResult::BLOCK_CRITICAL;
         return PhysicalAttackResult::BLOCK;
     }
-    range += include_block ? block_range : 0;
 
-    if (roll < range + crit_chance)
+    if (roll < row.block + crit_chance)
         return PhysicalAttackResult::CRITICAL;
 
     return PhysicalAttackResult::HIT;
@@ -34,8 +32,14 @@ int RangedWhiteHitTable::get_outcome(const unsigned roll, const unsigned crit_ch
 
 void RangedWhiteHitTable::update_miss_chance(const unsigned miss) {
     this->miss_range = miss;
+    update_rows();
 }
 
 void RangedWhiteHitTable::update_block_chance(const double block) {
     this->block_range = static_cast<unsigned>(round(block * 10000));
+    update_rows();
+}
+
+void RangedWhiteHitTable::update_rows() {
+    rows = get_attack_table_rows(miss_range, 0, 0, 0, block_range);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AttackTableThresholds.h"
 #include "PhysicalAttackResult.h"
 
 class Random;
@@ -12,13 +13,16 @@ public:
 
     void update_miss_chance(const unsigned miss);
     void update_block_chance(const double block);
-    void update_ranges();
 
     const unsigned wpn_skill;
 
 private:
     Random* random;
 
-    unsigned miss_range;
-    unsigned block_range;
+    unsigned miss_range {0};
+    unsigned block_range {0};
+
+    AttackTableRows rows;
+
+    void update_rows();
 };
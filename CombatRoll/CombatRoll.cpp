@@ -98,8 +98,10 @@ int CombatRoll::get_pet_ability_result(const unsigned wpn_skill, const unsigned
 }
 
 MeleeWhiteHitTable* CombatRoll::get_melee_white_table(const unsigned wpn_skill, bool is_attacking_from_behind) {
-    if (melee_white_tables.contains({wpn_skill, is_attacking_from_behind}))
-        return melee_white_tables[{wpn_skill, is_attacking_from_behind}];
+    const int index = get_positional_index(wpn_skill, is_attacking_from_behind);
+    MeleeWhiteHitTable* table = melee_white_tables.value(index, nullptr);
+    if (table != nullptr)
+        return table;
 
     unsigned miss_chance = static_cast<unsigned>(round(get_white_miss_chance(wpn_skill) * 10000));
     const unsigned miss_reduction = pchar->get_stats()->get_melee_hit_chance();
@@ -114,17 +116,19 @@ MeleeWhiteHitTable* CombatRoll::get_melee_white_table(const unsigned wpn_skill,
     if (!is_attacking_from_behind)
         parry_chance = mechanics->get_parry_chance(wpn_skill);
 
-    auto table = new MeleeWhiteHitTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill), parry_chance,
-                                        glancing_blow_chance, mechanics->get_block_chance());
+    table = new MeleeWhiteHitTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill), parry_chance, glancing_blow_chance,
+                                   mechanics->get_block_chance());
 
-    melee_white_tables[{wpn_skill, is_attacking_from_behind}] = table;
+    store_table(melee_white_tables, index, table);
 
     return table;
 }
 
 MeleeSpecialTable* CombatRoll::get_melee_special_table(const unsigned wpn_skill, bool is_attacking_from_behind) {
-    if (melee_special_tables.contains({wpn_skill, is_attacking_from_behind}))
-        return melee_special_tables[{wpn_skill, is_attacking_from_behind}];
+    const int index = get_positional_index(wpn_skill, is_attacking_from_behind);
+    MeleeSpecialTable* table = melee_special_tables.value(index, nullptr);
+    if (table != nullptr)
+        return table;
 
     unsigned miss_chance = static_cast<unsigned>(round(get_yellow_miss_chance(wpn_skill) * 10000));
     unsigned miss_reduction = pchar->get_stats()->get_melee_hit_chance();
@@ -135,43 +139,47 @@ MeleeSpecialTable* CombatRoll::get_melee_special_table(const unsigned wpn_skill,
     if (!is_attacking_from_behind)
         parry_chance = mechanics->get_parry_chance(wpn_skill);
 
-    auto table = new MeleeSpecialTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill), parry_chance,
-                                       mechanics->get_block_chance());
+    table = new MeleeSpecialTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill), parry_chance,
+                                  mechanics->get_block_chance());
 
-    melee_special_tables[{wpn_skill, is_attacking_from_behind}] = table;
+    store_table(melee_special_tables, index, table);
 
     return table;
 }
 
 RangedWhiteHitTable* CombatRoll::get_ranged_white_table(const unsigned wpn_skill) {
-    if (ranged_white_tables.contains(wpn_skill))
-        return ranged_white_tables[wpn_skill];
+    const int index = static_cast<int>(wpn_skill);
+    RangedWhiteHitTable* table = ranged_white_tables.value(index, nullptr);
+    if (table != nullptr)
+        return table;
 
     unsigned miss_chance = static_cast<unsigned>(round(get_yellow_miss_chance(wpn_skill) * 10000));
     unsigned miss_reduction = pchar->get_stats()->get_ranged_hit_chance();
 
     miss_chance = miss_reduction > miss_chance ? 0 : miss_chance - miss_reduction;
 
-    auto table = new RangedWhiteHitTable(this->random, wpn_skill, miss_chance, mechanics->get_block_chance());
+    table = new RangedWhiteHitTable(this->random, wpn_skill, miss_chance, mechanics->get_block_chance());
 
-    ranged_white_tables[wpn_skill] = table;
+    store_table(ranged_white_tables, index, table);
 
     return table;
 }
 
 MagicAttackTable* CombatRoll::get_magic_attack_table(const MagicSchool school) {
-    if (magic_attack_tables.contains(school))
-        return magic_attack_tables[school];
+    MagicAttackTable*& table = magic_attack_tables[static_cast<size_t>(school)];
+    if (table != nullptr)
+        return table;
 
-    auto table = new MagicAttackTable(mechanics, random, pchar->get_clvl(), pchar->get_stats()->get_spell_hit_chance(school),
-                                      pchar->get_stats()->get_target_resistance(school));
-    magic_attack_tables[school] = table;
+    table = new MagicAttackTable(mechanics, random, pchar->get_clvl(), pchar->get_stats()->get_spell_hit_chance(school),
+                                 pchar->get_stats()->get_target_resistance(school));
     return table;
 }
 
 MeleeWhiteHitTable* CombatRoll::get_pet_white_table(const unsigned wpn_skill) {
-    if (pet_white_tables.contains(wpn_skill))
-        return pet_white_tables[wpn_skill];
+    const int index = static_cast<int>(wpn_skill);
+    MeleeWhiteHitTable* table = pet_white_tables.value(index, nullptr);
+    if (table != nullptr)
+        return table;
 
     unsigned miss_chance = static_cast<unsigned>(round(mechanics->get_2h_white_miss_chance(wpn_skill) * 10000));
 
@@ -179,23 +187,25 @@ MeleeWhiteHitTable* CombatRoll::get_pet_white_table(const unsigned wpn_skill) {
                                       0 :
                                       mechanics->get_glancing_blow_chance(pchar->get_clvl());
 
-    auto table = new MeleeWhiteHitTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill),
-                                        mechanics->get_parry_chance(wpn_skill), glancing_blow_chance, mechanics->get_block_chance());
+    table = new MeleeWhiteHitTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill),
+                                   mechanics->get_parry_chance(wpn_skill), glancing_blow_chance, mechanics->get_block_chance());
 
-    pet_white_tables[wpn_skill] = table;
+    store_table(pet_white_tables, index, table);
 
     return table;
 }
 
 MeleeSpecialTable* CombatRoll::get_pet_ability_table(const unsigned wpn_skill) {
-    if (pet_special_tables.contains(wpn_skill))
-        return pet_special_tables[wpn_skill];
+    const int index = static_cast<int>(wpn_skill);
+    MeleeSpecialTable* table = pet_special_tables.value(index, nullptr);
+    if (table != nullptr)
+        return table;
 
     unsigned miss_chance = static_cast<unsigned>(round(get_yellow_miss_chance(wpn_skill) * 10000));
 
-    auto table = new MeleeSpecialTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill),
-                                       mechanics->get_parry_chance(wpn_skill), mechanics->get_block_chance());
-    pet_special_tables[wpn_skill] = table;
+    table = new MeleeSpecialTable(this->random, wpn_skill, miss_chance, mechanics->get_dodge_chance(wpn_skill),
+                                  mechanics->get_parry_chance(wpn_skill), mechanics->get_block_chance());
+    store_table(pet_special_tables, index, table);
 
     return table;
 }
@@ -226,6 +236,9 @@ double CombatRoll::get_glancing_blow_dmg_penalty(const unsigned wpn_skill) {
 void CombatRoll::update_melee_yellow_miss_chance() {
     const unsigned miss_reduction = pchar->get_stats()->get_melee_hit_chance();
     for (const auto& table : melee_special_tables) {
+        if (table == nullptr)
+            continue;
+
         unsigned miss_chance = static_cast<unsigned>(round(get_yellow_miss_chance(table->wpn_skill) * 10000));
 
         miss_chance = miss_reduction > miss_chance ? 0 : miss_chance - miss_reduction;
@@ -236,6 +249,9 @@ void CombatRoll::update_melee_yellow_miss_chance() {
 void CombatRoll::update_melee_white_miss_chance() {
     const unsigned miss_reduction = pchar->get_stats()->get_melee_hit_chance();
     for (const auto& table : melee_white_tables) {
+        if (table == nullptr)
+            continue;
+
         unsigned miss_chance = static_cast<unsigned>(round(get_white_miss_chance(table->wpn_skill) * 10000));
 
         miss_chance = miss_reduction > miss_chance ? 0 : miss_chance - miss_reduction;
@@ -246,6 +262,9 @@ void CombatRoll::update_melee_white_miss_chance() {
 void CombatRoll::update_ranged_miss_chance() {
     const unsigned miss_reduction = pchar->get_stats()->get_ranged_hit_chance();
     for (const auto& table : ranged_white_tables) {
+        if (table == nullptr)
+            continue;
+
         unsigned miss_chance = static_cast<unsigned>(round(get_yellow_miss_chance(table->wpn_skill) * 10000));
 
         miss_chance = miss_reduction > miss_chance ? 0 : miss_chance - miss_reduction;
@@ -254,18 +273,20 @@ void CombatRoll::update_ranged_miss_chance() {
 }
 
 void CombatRoll::update_spell_miss_chance(const MagicSchool school, const unsigned spell_hit) {
-    if (!magic_attack_tables.contains(school))
+    MagicAttackTable* table = magic_attack_tables[static_cast<size_t>(school)];
+    if (table == nullptr)
         return;
 
     const unsigned clvl = pchar->get_clvl();
-    magic_attack_tables[school]->update_miss_chance(clvl, spell_hit);
+    table->update_miss_chance(clvl, spell_hit);
 }
 
 void CombatRoll::update_target_resistance(const MagicSchool school, const unsigned target_resistance) {
-    if (!magic_attack_tables.contains(school))
+    MagicAttackTable* table = magic_attack_tables[static_cast<size_t>(school)];
+    if (table == nullptr)
         return;
 
-    magic_attack_tables[school]->update_target_resistance(target_resistance);
+    table->update_target_resistance(target_resistance);
 }
 
 void CombatRoll::drop_tables() {
@@ -290,7 +311,7 @@ void CombatRoll::drop_tables() {
     melee_white_tables.clear();
     melee_special_tables.clear();
     ranged_white_tables.clear();
-    magic_attack_tables.clear();
+    magic_attack_tables.fill(nullptr);
     pet_white_tables.clear();
     pet_special_tables.clear();
 }
@@ -299,6 +320,10 @@ void CombatRoll::set_new_seed(const unsigned seed) {
     this->random->set_gen_from_seed(seed);
 }
 
+int CombatRoll::get_positional_index(const unsigned wpn_skill, const bool is_attacking_from_behind) {
+    return static_cast<int>(wpn_skill) * 2 + (is_attacking_from_behind ? 1 : 0);
+}
+
 unsigned CombatRoll::get_suppressed_crit(const unsigned crit_chance) const {
     const unsigned crit_suppression_from_target_level = static_cast<unsigned>(round(10000 * mechanics->get_melee_crit_suppression(pchar->get_clvl())));
 
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <QMap>
+#include <QVector>
+#include <array>
 
 #include <math.h>
 #include <stdlib.h>
@@ -64,12 +65,24 @@ private:
     Random* random;
     Random* glance_roll;
 
-    QMap<QPair<unsigned, bool>, MeleeWhiteHitTable*> melee_white_tables;
-    QMap<QPair<unsigned, bool>, MeleeSpecialTable*> melee_special_tables;
-    QMap<unsigned, RangedWhiteHitTable*> ranged_white_tables;
-    QMap<MagicSchool, MagicAttackTable*> magic_attack_tables;
-    QMap<unsigned, MeleeWhiteHitTable*> pet_white_tables;
-    QMap<unsigned, MeleeSpecialTable*> pet_special_tables;
+    // Tables are looked up on every roll, so they are stored flat: melee tables by get_positional_index(), ranged
+    // and pet tables by weapon skill and magic tables by school. Tables not created yet are nullptr.
+    QVector<MeleeWhiteHitTable*> melee_white_tables;
+    QVector<MeleeSpecialTable*> melee_special_tables;
+    QVector<RangedWhiteHitTable*> ranged_white_tables;
+    std::array<MagicAttackTable*, NUM_MAGIC_SCHOOLS> magic_attack_tables {};
+    QVector<MeleeWhiteHitTable*> pet_white_tables;
+    QVector<MeleeSpecialTable*> pet_special_tables;
 
     unsigned get_suppressed_crit(const unsigned crit_chance) const;
+
+    static int get_positional_index(const unsigned wpn_skill, const bool is_attacking_from_behind);
+
+    template <typename T>
+    static void store_table(QVector<T*>& tables, const int index, T* table) {
+        if (index >= tables.size())
+            tables.resize(index + 1);
+
+        tables[index] = table;
+    }
 };
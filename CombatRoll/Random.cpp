@@ -1,26 +1,108 @@
 #include "Random.h"
 
 #include "Utils/Check.h"
+#include "xoroshiro128plus.h"
 
-Random::Random(const unsigned min_range, const unsigned max_range) :
-    min_range(min_range), modulo(max_range - min_range), xoroshiro(new xoroshiro128plus()) {}
+thread_local QVector<Random*> Random::generators_on_thread;
+thread_local RandomStreamScope* RandomStreamScope::current = nullptr;
+
+namespace {
+uint64_t rotl(const uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+// A single splitmix64 step used as a hash. Nearby inputs give unrelated outputs.
+uint64_t hash64(const uint64_t x) {
+    uint64_t state = x;
+    return splitmix64(state);
+}
+} // namespace
+
+Random::Random(const unsigned min_range, const unsigned max_range) {
+    set_range(min_range, max_range);
+
+    // Seeded from the OS tick count, like a default constructed xoroshiro128plus, until reseeded.
+    set_gen_from_seed(xoroshiro128plus().next());
+
+    if (RandomStreamScope::current != nullptr) {
+        RandomStreamScope* scope = RandomStreamScope::current;
+        has_stream_key = true;
+        stream_key = hash64(scope->scope_key ^ hash64(++scope->num_created));
+    }
+
+    generators_on_thread.append(this);
+}
 
 Random::~Random() {
-    delete xoroshiro;
+    generators_on_thread.removeOne(this);
 }
 
 void Random::set_new_range(const unsigned min_range, const unsigned max_range) {
     check((min_range <= max_range), "Min must be <= max");
+    set_range(min_range, max_range);
+}
+
+void Random::set_range(const unsigned min_range, const unsigned max_range) {
     this->min_range = min_range;
-    this->modulo = max_range - min_range;
+    this->range = max_range - min_range;
+
+    // 2^32 mod range: the number of raw values that would make some rolls more likely than others.
+    this->rejection_threshold = range == 0 ? 0 : static_cast<uint32_t>(0 - static_cast<uint32_t>(range)) % static_cast<uint32_t>(range);
 }
 
 void Random::set_gen_from_seed(const unsigned long long seed) {
-    xoroshiro->set_state(seed);
+    // Lane L takes the splitmix64 outputs 2L + 1 and 2L + 2 from its starting point. Starting from the seed itself
+    // would give seeds that are one splitmix64 increment apart overlapping lanes.
+    uint64_t state = hash64(seed);
+    for (int lane = 0; lane < NUM_LANES; ++lane) {
+        lane_state0[lane] = splitmix64(state);
+        lane_state1[lane] = splitmix64(state);
+    }
+
+    batch_index = BATCH_SIZE;
+}
+
+void Random::fill_batch() {
+    for (int i = 0; i < BATCH_SIZE; i += NUM_LANES) {
+        for (int lane = 0; lane < NUM_LANES; ++lane) {
+            const uint64_t s0 = lane_state0[lane];
+            uint64_t s1 = lane_state1[lane];
+            batch[i + lane] = s0 + s1;
+
+            s1 ^= s0;
+            lane_state0[lane] = rotl(s0, 24) ^ s1 ^ (s1 << 16);
+            lane_state1[lane] = rotl(s1, 37);
+        }
+    }
+
+    batch_index = 0;
+}
+
+void Random::reseed_generators_on_current_thread(const unsigned long long seed) {
+    // Offsetting the seed by a multiple of splitmix64's increment would make each generator's state a shifted copy of
+    // its neighbour's, so the seed and the position are hashed together instead.
+    uint64_t unkeyed_position = 0;
+    for (Random* generator : generators_on_thread) {
+        const uint64_t stream = generator->has_stream_key ? generator->stream_key : hash64(++unkeyed_position);
+        generator->set_gen_from_seed(hash64(seed ^ stream));
+    }
+}
+
+RandomStreamScope::RandomStreamScope(const int party, const int party_member, const QString& key) : outer_scope(current) {
+    scope_key = hash64((static_cast<uint64_t>(static_cast<uint32_t>(party)) << 32) | static_cast<uint32_t>(party_member));
+    for (int i = 0; i < key.size(); ++i)
+        scope_key = hash64(scope_key ^ key.at(i).unicode());
+
+    current = this;
 }
 
-unsigned Random::get_roll() {
-    if (modulo == 0)
-        return static_cast<unsigned>(min_range);
-    return static_cast<unsigned>((xoroshiro->next() % modulo) + min_range);
+RandomStreamScope::~RandomStreamScope() {
+    current = outer_scope;
 }
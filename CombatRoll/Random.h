@@ -1,7 +1,15 @@
 #pragma once
 
-#include "xoroshiro128plus.h"
+#include <QString>
+#include <QVector>
+#include <cstdint>
 
+// Uniform rolls in [min_range, max_range).
+//
+// Raw numbers come from NUM_LANES independent xoroshiro128+ generators that are stepped together, BATCH_SIZE
+// numbers at a time, so the compiler can vectorize the generation. They are reduced to the range with Lemire's
+// multiply-shift method, rejecting the few raw numbers that would bias the result. A given seed always yields
+// the same sequence of rolls.
 class Random {
 public:
     Random(const unsigned min_range, const unsigned max_range);
@@ -9,10 +17,67 @@ public:
 
     void set_new_range(const unsigned min_range, const unsigned max_range);
     void set_gen_from_seed(const unsigned long long seed);
-    unsigned get_roll();
+
+    unsigned get_roll() {
+        if (range == 0)
+            return min_range;
+
+        while (true) {
+            // The upper 32 bits are the strongest bits of xoroshiro128+.
+            const uint64_t product = (next() >> 32) * range;
+            if (static_cast<uint32_t>(product) >= rejection_threshold)
+                return min_range + static_cast<unsigned>(product >> 32);
+        }
+    }
+
+    // Reseeds every generator alive on the calling thread from the given seed and the generator's stream: the key
+    // of the RandomStreamScope it was created in, or else its creation order among the generators created outside
+    // of any scope. Identical raids set up on different threads thereby replay identical streams.
+    static void reseed_generators_on_current_thread(const unsigned long long seed);
+
+    static const int NUM_LANES = 4;
+    static const int BATCH_SIZE = 32;
 
 private:
-    uint64_t min_range;
-    uint64_t modulo;
-    xoroshiro128plus* xoroshiro;
+    unsigned min_range;
+    uint64_t range;
+    uint32_t rejection_threshold;
+
+    uint64_t lane_state0[NUM_LANES];
+    uint64_t lane_state1[NUM_LANES];
+    uint64_t batch[BATCH_SIZE];
+    int batch_index {BATCH_SIZE};
+
+    bool has_stream_key {false};
+    uint64_t stream_key {0};
+
+    static thread_local QVector<Random*> generators_on_thread;
+
+    void set_range(const unsigned min_range, const unsigned max_range);
+    void fill_batch();
+
+    uint64_t next() {
+        if (batch_index == BATCH_SIZE)
+            fill_batch();
+
+        return batch[batch_index++];
+    }
+};
+
+// Keys the streams of the generators created while it is alive by the owning character's raid position (party and
+// party member), the given key and their creation order within the scope. Equipping an item in one slot then leaves
+// the streams of every other generator untouched, so sims with common random numbers stay paired across gear changes.
+class RandomStreamScope {
+public:
+    RandomStreamScope(const int party, const int party_member, const QString& key);
+    ~RandomStreamScope();
+
+private:
+    friend class Random;
+
+    static thread_local RandomStreamScope* current;
+
+    RandomStreamScope* outer_scope;
+    uint64_t scope_key;
+    uint64_t num_created {0};
 };
@@ -5,6 +5,7 @@ Minor modifications made by Tim Hultman (tim.hultman@gmail.com):
     - Wrapped into class
     - Automatic seed based on OS tick count
     - Code style changes
+    - Seeding through splitmix64 so that a given seed always yields the same sequence
 
 See http://vigna.di.unimi.it/xorshift/ for an explanation of PRNGs developed by Vigna, et al.
 See http://vigna.di.unimi.it/xorshift/xoroshiro128plus.c for the original C code.
@@ -36,11 +37,16 @@ xoroshiro128plus::xoroshiro128plus() {
     set_state(_rdtsc());
 }
 
+static inline uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
 void xoroshiro128plus::set_state(uint64_t state) {
-    this->state[0] = state;
-    this->state[1] = _rdtsc();
-    for (int i = 0; i < 100; ++i)
-        this->next();
+    this->state[0] = splitmix64(state);
+    this->state[1] = splitmix64(state);
 }
 
 uint64_t xoroshiro128plus::next() {
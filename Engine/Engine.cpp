@@ -1,20 +1,46 @@
 #include "Engine.h"
 
+#include "CalendarQueue.h"
 #include "Event.h"
-#include "Queue.h"
+#include "EventHandle.h"
+#include "EventPool.h"
+#include "HeapQueue.h"
 #include "StatisticsEngine.h"
 #include "Utils/Check.h"
 
-Engine::Engine() : queue(new Queue()), timer(new QTime()), current_prio(0) {}
+#ifdef CALENDAR_QUEUE
+static const QueueType DEFAULT_QUEUE_TYPE = QueueType::Calendar;
+#else
+static const QueueType DEFAULT_QUEUE_TYPE = QueueType::Heap;
+#endif
+
+Engine::Engine() : Engine(DEFAULT_QUEUE_TYPE) {}
+
+Engine::Engine(const QueueType queue_type) : queue(nullptr), event_pool(new EventPool()), timer(new QTime()), current_prio(0) {
+    switch (queue_type) {
+    case QueueType::Heap:
+        queue = new HeapQueue();
+        break;
+    case QueueType::Calendar:
+        queue = new CalendarQueue();
+        break;
+    }
+}
 
 Engine::~Engine() {
     delete queue;
+    delete event_pool;
     delete timer;
 }
 
 void Engine::run() {
     while (!queue->empty()) {
         Event* event = queue->get_next();
+        if (event->is_cancelled()) {
+            delete event;
+            continue;
+        }
+
         set_current_priority(event);
         engine_statistics->increment_event(event->event_type);
         event->act();
@@ -26,6 +52,7 @@ void Engine::prepare_set_of_iterations(StatisticsEngine* engine_statistics) {
     this->engine_statistics = engine_statistics;
     current_prio = 0;
     queue->clear();
+    event_pool->reset_high_water_mark();
     timer->start();
 }
 
@@ -36,6 +63,7 @@ void Engine::prepare_iteration(const double start_at) {
 
 void Engine::reset() {
     engine_statistics->set_elapsed(static_cast<unsigned>(timer->elapsed()));
+    engine_statistics->set_event_pool_high_water_mark(event_pool->get_high_water_mark());
     delete timer;
     timer = new QTime();
 }
@@ -49,8 +77,8 @@ double Engine::get_current_priority() const {
 }
 
 void Engine::set_current_priority(Event* event) {
-    check((event->priority >= this->current_prio),
-          QString("Engine is at '%1' and got event at '%2'").arg(current_prio).arg(event->priority).toStdString());
+    hot_check((event->priority >= this->current_prio),
+              QString("Engine is at '%1' and got event at '%2'").arg(current_prio).arg(event->priority).toStdString());
     this->current_prio = event->priority;
 }
 
@@ -58,6 +86,39 @@ void Engine::add_event(Event* event) {
     this->queue->push(event);
 }
 
+void Engine::reschedule_event(EventHandle* handle, Event* event) {
+    cancel_event(handle);
+    handle->bind(event);
+    this->queue->push(event);
+}
+
+void Engine::cancel_event(EventHandle* handle) {
+    Event* event = handle->release();
+    if (event == nullptr)
+        return;
+
+    if (engine_statistics != nullptr)
+        engine_statistics->increment_cancelled_event(event->event_type);
+
+    this->queue->cancel(event);
+}
+
+bool Engine::next_event_is_after(const double timestamp) const {
+    return !queue->empty() && queue->peek()->priority > timestamp;
+}
+
+void Engine::fast_forward(const EventType event_type, const double timestamp) {
+    hot_check((timestamp >= this->current_prio), QString("Engine is at '%1' and fast forwarded to '%2'").arg(current_prio).arg(timestamp).toStdString());
+    this->current_prio = timestamp;
+
+    if (engine_statistics != nullptr)
+        engine_statistics->increment_event(event_type);
+}
+
 Queue* Engine::get_queue() const {
     return this->queue;
 }
+
+EventPool* Engine::get_event_pool() const {
+    return this->event_pool;
+}
@@ -4,12 +4,17 @@
 #include <QTime>
 
 class Event;
+class EventHandle;
+class EventPool;
 class Queue;
 class StatisticsEngine;
+enum class EventType : int;
+enum class QueueType : int;
 
 class Engine {
 public:
     Engine();
+    Engine(const QueueType queue_type);
     ~Engine();
 
     void run();
@@ -20,11 +25,21 @@ public:
     double get_current_priority() const;
     void set_current_priority(Event* event);
     void add_event(Event* event);
+    void reschedule_event(EventHandle* handle, Event* event);
+    void cancel_event(EventHandle* handle);
+
+    // True if every event in the queue is scheduled strictly after the given time.
+    bool next_event_is_after(const double timestamp) const;
+    // Advances time to an event that is handled inline rather than pushed to the queue, e.g. because
+    // next_event_is_after() showed that no other event could run before it.
+    void fast_forward(const EventType event_type, const double timestamp);
 
     Queue* get_queue() const;
+    EventPool* get_event_pool() const;
 
 private:
     Queue* queue;
+    EventPool* event_pool;
     StatisticsEngine* engine_statistics {nullptr};
     QTime* timer;
 
@@ -11,6 +11,7 @@
 #include "Item.h"
 #include "Projectile.h"
 #include "Quiver.h"
+#include "Random.h"
 #include "RandomAffixes.h"
 #include "SetBonusControl.h"
 #include "Stats.h"
@@ -20,7 +21,7 @@
 Equipment::Equipment(EquipmentDb* equipment_db, Character* pchar) :
     pchar(pchar),
     db(equipment_db),
-    random_affixes(new RandomAffixes()),
+    random_affixes(equipment_db != nullptr ? equipment_db->get_random_affixes() : nullptr),
     set_bonuses(new SetBonusControl(equipment_db, pchar)),
     stats_from_equipped_gear({nullptr, nullptr, nullptr}) {
     setup_index = 0;
@@ -314,6 +315,8 @@ Quiver* Equipment::get_quiver() const {
 }
 
 void Equipment::set_mainhand(const int item_id, RandomAffix* random_affix) {
+    RandomStreamScope stream_scope(pchar->get_party(), pchar->get_party_member(), QString("Weapon %1").arg(EquipmentSlot::MAINHAND));
+
     Weapon* weapon = db->get_melee_weapon(item_id);
 
     if (weapon == nullptr)
@@ -343,6 +346,8 @@ void Equipment::set_mainhand(const int item_id, RandomAffix* random_affix) {
 }
 
 void Equipment::set_offhand(const int item_id, RandomAffix* random_affix) {
+    RandomStreamScope stream_scope(pchar->get_party(), pchar->get_party_member(), QString("Weapon %1").arg(EquipmentSlot::OFFHAND));
+
     Weapon* weapon = db->get_melee_weapon(item_id);
 
     if (weapon == nullptr)
@@ -371,6 +376,8 @@ void Equipment::set_offhand(const int item_id, RandomAffix* random_affix) {
 }
 
 void Equipment::set_ranged(const int item_id, RandomAffix* random_affix) {
+    RandomStreamScope stream_scope(pchar->get_party(), pchar->get_party_member(), QString("Weapon %1").arg(EquipmentSlot::RANGED));
+
     Weapon* weapon = db->get_ranged(item_id);
 
     if (weapon == nullptr)
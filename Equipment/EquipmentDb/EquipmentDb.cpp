@@ -4,15 +4,20 @@
 
 #include <QDebug>
 #include <QDir>
+#include <QStandardPaths>
 #include <QVersionNumber>
 
+#include "EquipmentDbCache.h"
 #include "ItemFileReader.h"
+#include "ItemStatsEnum.h"
 #include "Projectile.h"
 #include "Quiver.h"
+#include "RandomAffixes.h"
+#include "SetBonusFileReader.h"
 #include "Utils/Check.h"
 #include "Weapon.h"
 
-EquipmentDb::EquipmentDb(QObject* parent) : QObject(parent), enchant_info(new EnchantInfo()) {
+EquipmentDb::EquipmentDb(QObject* parent) : QObject(parent), enchant_info(new EnchantInfo()), random_affixes(new RandomAffixes()) {
     read_equipment_files();
     add_druid_cat_form_claws();
     add_druid_bear_form_paws();
@@ -35,6 +40,7 @@ EquipmentDb::~EquipmentDb() {
     }
 
     delete enchant_info;
+    delete random_affixes;
 }
 
 void EquipmentDb::delete_items(QVector<Item*>* list) {
@@ -75,128 +81,116 @@ void EquipmentDb::add_melee_weapon(Weapon* wpn) {
     add_item_id(wpn);
     mh_slot_items.append(wpn);
     current_phase_mh_slot_items.append(wpn);
+    if (!current_phase_mh_slot_items_by_id.contains(wpn->item_id))
+        current_phase_mh_slot_items_by_id.insert(wpn->item_id, wpn);
 }
 
 void EquipmentDb::add_ranged(Weapon* wpn) {
     add_item_id(wpn);
     ranged_items.append(wpn);
     current_phase_ranged_items.append(wpn);
+    if (!current_phase_ranged_items_by_id.contains(wpn->item_id))
+        current_phase_ranged_items_by_id.insert(wpn->item_id, wpn);
 }
 
 void EquipmentDb::add_ring(Item* ring) {
     add_item_id(ring);
     rings.append(ring);
     current_phase_rings.append(ring);
+    if (!current_phase_rings_by_id.contains(ring->item_id))
+        current_phase_rings_by_id.insert(ring->item_id, ring);
 }
 
 Weapon* EquipmentDb::get_melee_weapon(const int item_id) const {
-    for (const auto& current_phase_mh_slot_item : current_phase_mh_slot_items) {
-        if (item_id == current_phase_mh_slot_item->item_id)
-            return new Weapon(static_cast<Weapon*>(current_phase_mh_slot_item));
-    }
-
-    for (const auto& current_phase_oh_slot_item : current_phase_oh_slot_items) {
-        if (item_id == current_phase_oh_slot_item->item_id)
-            return new Weapon(static_cast<Weapon*>(current_phase_oh_slot_item));
-    }
+    Item* weapon = current_phase_mh_slot_items_by_id.value(item_id, nullptr);
+    if (weapon == nullptr)
+        weapon = current_phase_oh_slot_items_by_id.value(item_id, nullptr);
 
-    return nullptr;
+    return weapon != nullptr ? new Weapon(static_cast<Weapon*>(weapon)) : nullptr;
 }
 
-Item* EquipmentDb::get_item(const QVector<Item*>& item_list, const int item_id) const {
-    for (const auto item : item_list) {
-        if (item_id == item->item_id)
-            return new Item(item);
-    }
+Item* EquipmentDb::get_item(const QHash<int, Item*>& items_by_id, const int item_id) const {
+    Item* item = items_by_id.value(item_id, nullptr);
 
-    return nullptr;
+    return item != nullptr ? new Item(item) : nullptr;
 }
 
 Weapon* EquipmentDb::get_ranged(const int item_id) const {
-    for (const auto& current_phase_ranged_slot_item : current_phase_ranged_items) {
-        if (item_id == current_phase_ranged_slot_item->item_id)
-            return new Weapon(static_cast<Weapon*>(current_phase_ranged_slot_item));
-    }
+    Item* weapon = current_phase_ranged_items_by_id.value(item_id, nullptr);
 
-    return nullptr;
+    return weapon != nullptr ? new Weapon(static_cast<Weapon*>(weapon)) : nullptr;
 }
 
 Item* EquipmentDb::get_head(const int item_id) const {
-    return get_item(current_phase_helms, item_id);
+    return get_item(current_phase_helms_by_id, item_id);
 }
 
 Item* EquipmentDb::get_neck(const int item_id) const {
-    return get_item(current_phase_amulets, item_id);
+    return get_item(current_phase_amulets_by_id, item_id);
 }
 
 Item* EquipmentDb::get_shoulders(const int item_id) const {
-    return get_item(current_phase_shoulders, item_id);
+    return get_item(current_phase_shoulders_by_id, item_id);
 }
 
 Item* EquipmentDb::get_back(const int item_id) const {
-    return get_item(current_phase_backs, item_id);
+    return get_item(current_phase_backs_by_id, item_id);
 }
 
 Item* EquipmentDb::get_chest(const int item_id) const {
-    return get_item(current_phase_chests, item_id);
+    return get_item(current_phase_chests_by_id, item_id);
 }
 
 Item* EquipmentDb::get_wrist(const int item_id) const {
-    return get_item(current_phase_wrists, item_id);
+    return get_item(current_phase_wrists_by_id, item_id);
 }
 
 Item* EquipmentDb::get_gloves(const int item_id) const {
-    return get_item(current_phase_gloves, item_id);
+    return get_item(current_phase_gloves_by_id, item_id);
 }
 
 Item* EquipmentDb::get_belt(const int item_id) const {
-    return get_item(current_phase_belts, item_id);
+    return get_item(current_phase_belts_by_id, item_id);
 }
 
 Item* EquipmentDb::get_legs(const int item_id) const {
-    return get_item(current_phase_legs, item_id);
+    return get_item(current_phase_legs_by_id, item_id);
 }
 
 Item* EquipmentDb::get_boots(const int item_id) const {
-    return get_item(current_phase_boots, item_id);
+    return get_item(current_phase_boots_by_id, item_id);
 }
 
 Item* EquipmentDb::get_ring(const int item_id) const {
-    return get_item(current_phase_rings, item_id);
+    return get_item(current_phase_rings_by_id, item_id);
 }
 
 Item* EquipmentDb::get_trinket(const int item_id) const {
-    return get_item(current_phase_trinkets, item_id);
+    return get_item(current_phase_trinkets_by_id, item_id);
 }
 
 Item* EquipmentDb::get_caster_offhand(const int item_id) const {
-    return get_item(current_phase_oh_slot_items, item_id);
+    return get_item(current_phase_oh_slot_items_by_id, item_id);
 }
 
 Item* EquipmentDb::get_relic(const int item_id) const {
-    return get_item(current_phase_relics, item_id);
+    return get_item(current_phase_relics_by_id, item_id);
 }
 
 Projectile* EquipmentDb::get_projectile(const int item_id) const {
-    for (const auto& current_phase_projectile : current_phase_projectiles) {
-        if (item_id == current_phase_projectile->item_id)
-            return new Projectile(static_cast<Projectile*>(current_phase_projectile));
-    }
+    Item* projectile = current_phase_projectiles_by_id.value(item_id, nullptr);
 
-    return nullptr;
+    return projectile != nullptr ? new Projectile(static_cast<Projectile*>(projectile)) : nullptr;
 }
 
 Quiver* EquipmentDb::get_quiver(const int item_id) const {
-    for (const auto& current_phase_quiver : current_phase_quivers) {
-        if (item_id == current_phase_quiver->item_id)
-            return new Quiver(static_cast<Quiver*>(current_phase_quiver));
-    }
+    Item* quiver = current_phase_quivers_by_id.value(item_id, nullptr);
 
-    return nullptr;
+    return quiver != nullptr ? new Quiver(static_cast<Quiver*>(quiver)) : nullptr;
 }
 
 Item* EquipmentDb::get_shield(const int item_id) const {
-    return get_item(current_phase_shields, item_id);
+    return get_item(current_phase_shields_by_id, item_id);
 }
 
 Item* EquipmentDb::get_item(const int item_id) const {
@@ -206,6 +200,10 @@ Item* EquipmentDb::get_item(const int item_id) const {
     return nullptr;
 }
 
+RandomAffixes* EquipmentDb::get_random_affixes() const {
+    return random_affixes;
+}
+
 const QVector<Item*>& EquipmentDb::get_slot_items(const int slot) const {
     switch (slot) {
     case ItemSlots::MAINHAND:
@@ -257,32 +255,47 @@ QString EquipmentDb::get_name_for_item_id(const int item_id) const {
     return item_id_to_item[item_id]->name;
 }
 
+const QMap<int, QString>& EquipmentDb::get_possible_set_items() const {
+    return possible_set_items;
+}
+
+const QMap<QString, QVector<QPair<int, QString>>>& EquipmentDb::get_set_bonus_tooltips() const {
+    return set_bonus_tooltips;
+}
+
+const QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& EquipmentDb::get_set_bonus_effects() const {
+    return set_bonus_effects;
+}
+
 void EquipmentDb::set_content_phase(const Content::Phase phase) {
     this->current_phase = phase;
 
-    set_phase_for_slot(mh_slot_items, current_phase_mh_slot_items);
-    set_phase_for_slot(oh_slot_items, current_phase_oh_slot_items);
-    set_phase_for_slot(ranged_items, current_phase_ranged_items);
-    set_phase_for_slot(helms, current_phase_helms);
-    set_phase_for_slot(amulets, current_phase_amulets);
-    set_phase_for_slot(shoulders, current_phase_shoulders);
-    set_phase_for_slot(backs, current_phase_backs);
-    set_phase_for_slot(chests, current_phase_chests);
-    set_phase_for_slot(wrists, current_phase_wrists);
-    set_phase_for_slot(gloves, current_phase_gloves);
-    set_phase_for_slot(belts, current_phase_belts);
-    set_phase_for_slot(legs, current_phase_legs);
-    set_phase_for_slot(boots, current_phase_boots);
-    set_phase_for_slot(rings, current_phase_rings);
-    set_phase_for_slot(trinkets, current_phase_trinkets);
-    set_phase_for_slot(projectiles, current_phase_projectiles);
-    set_phase_for_slot(relics, current_phase_relics);
-    set_phase_for_slot(quivers, current_phase_quivers);
-    set_phase_for_slot(shields, current_phase_shields);
-}
-
-void EquipmentDb::set_phase_for_slot(QVector<Item*>& total_slot_items, QVector<Item*>& phase_slot_items) {
+    set_phase_for_slot(mh_slot_items, current_phase_mh_slot_items, current_phase_mh_slot_items_by_id);
+    set_phase_for_slot(oh_slot_items, current_phase_oh_slot_items, current_phase_oh_slot_items_by_id);
+    set_phase_for_slot(ranged_items, current_phase_ranged_items, current_phase_ranged_items_by_id);
+    set_phase_for_slot(helms, current_phase_helms, current_phase_helms_by_id);
+    set_phase_for_slot(amulets, current_phase_amulets, current_phase_amulets_by_id);
+    set_phase_for_slot(shoulders, current_phase_shoulders, current_phase_shoulders_by_id);
+    set_phase_for_slot(backs, current_phase_backs, current_phase_backs_by_id);
+    set_phase_for_slot(chests, current_phase_chests, current_phase_chests_by_id);
+    set_phase_for_slot(wrists, current_phase_wrists, current_phase_wrists_by_id);
+    set_phase_for_slot(gloves, current_phase_gloves, current_phase_gloves_by_id);
+    set_phase_for_slot(belts, current_phase_belts, current_phase_belts_by_id);
+    set_phase_for_slot(legs, current_phase_legs, current_phase_legs_by_id);
+    set_phase_for_slot(boots, current_phase_boots, current_phase_boots_by_id);
+    set_phase_for_slot(rings, current_phase_rings, current_phase_rings_by_id);
+    set_phase_for_slot(trinkets, current_phase_trinkets, current_phase_trinkets_by_id);
+    set_phase_for_slot(projectiles, current_phase_projectiles, current_phase_projectiles_by_id);
+    set_phase_for_slot(relics, current_phase_relics, current_phase_relics_by_id);
+    set_phase_for_slot(quivers, current_phase_quivers, current_phase_quivers_by_id);
+    set_phase_for_slot(shields, current_phase_shields, current_phase_shields_by_id);
+}
+
+void EquipmentDb::set_phase_for_slot(QVector<Item*>& total_slot_items,
+                                     QVector<Item*>& phase_slot_items,
+                                     QHash<int, Item*>& phase_slot_items_by_id) {
     phase_slot_items.clear();
+    phase_slot_items_by_id.clear();
     QMap<int, Item*> tmp_items;
 
     for (const auto& item : total_slot_items) {
@@ -298,8 +311,10 @@ void EquipmentDb::set_phase_for_slot(QVector<Item*>& total_slot_items, QVector<I
         }
     }
 
-    for (const auto& item : tmp_items)
+    for (const auto& item : tmp_items) {
         phase_slot_items.append(item);
+        phase_slot_items_by_id.insert(item->item_id, item);
+    }
 }
 
 void EquipmentDb::read_equipment_files() {
@@ -342,10 +357,25 @@ void EquipmentDb::read_equipment_files() {
     if (equipment_file_paths.empty())
         qDebug() << "Failed to find equipment files in equipment_paths.xml";
 
+    QVector<QString> source_paths = equipment_file_paths;
+    source_paths.append({"equipment_paths.xml", "set_bonuses.xml"});
+    const QByteArray checksum = EquipmentDbCache::get_checksum(source_paths);
+    // The cache is keyed by the checksum of the data files, so one file in the user's cache directory serves every
+    // working directory the simulator is started from.
+    QString cache_dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (cache_dir.isEmpty() || !QDir().mkpath(cache_dir))
+        cache_dir = QDir::currentPath();
+    EquipmentDbCache cache(QDir(cache_dir).filePath("equipment_db.bin"), enchant_info);
+
     QVector<Item*> items;
 
-    for (const auto& equipment_file_path : equipment_file_paths) {
-        ItemFileReader(enchant_info).read_items(items, equipment_file_path);
+    if (!cache.read(checksum, items, possible_set_items, set_bonus_tooltips, set_bonus_effects)) {
+        for (const auto& equipment_file_path : equipment_file_paths) {
+            ItemFileReader(enchant_info).read_items(items, equipment_file_path);
+        }
+
+        SetBonusFileReader().read_set_bonuses("set_bonuses.xml", possible_set_items, set_bonus_tooltips, set_bonus_effects);
+        cache.write(checksum, items, possible_set_items, set_bonus_tooltips, set_bonus_effects);
     }
 
     take_weapons_from_given_items(items);
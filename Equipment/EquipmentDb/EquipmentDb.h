@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QFile>
+#include <QHash>
 #include <QMap>
 #include <QObject>
 #include <QVector>
@@ -13,8 +14,11 @@ class EnchantInfo;
 class Item;
 class Projectile;
 class Quiver;
+class RandomAffixes;
 class Weapon;
 
+enum class ItemStats : int;
+
 class EquipmentDb : public QObject {
 public:
     EquipmentDb(QObject* parent = nullptr);
@@ -42,6 +46,7 @@ public:
     Quiver* get_quiver(const int item_id) const;
 
     Item* get_item(const int item_id) const;
+    RandomAffixes* get_random_affixes() const;
 
     void set_content_phase(const Content::Phase current_phase);
 
@@ -49,6 +54,10 @@ public:
 
     QString get_name_for_item_id(const int item_id) const;
 
+    const QMap<int, QString>& get_possible_set_items() const;
+    const QMap<QString, QVector<QPair<int, QString>>>& get_set_bonus_tooltips() const;
+    const QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& get_set_bonus_effects() const;
+
     void add_melee_weapon(Weapon* wpn);
     void add_ranged(Weapon* wpn);
     void add_ring(Item* ring);
@@ -56,11 +65,12 @@ public:
     EnchantInfo* enchant_info;
 
 private:
+    RandomAffixes* random_affixes;
     Content::Phase current_phase;
 
     void read_equipment_files();
-    void set_phase_for_slot(QVector<Item*>& total_slot_items, QVector<Item*>& phase_slot_items);
-    Item* get_item(const QVector<Item*>& list, const int item_id) const;
+    void set_phase_for_slot(QVector<Item*>& total_slot_items, QVector<Item*>& phase_slot_items, QHash<int, Item*>& phase_slot_items_by_id);
+    Item* get_item(const QHash<int, Item*>& items_by_id, const int item_id) const;
     void take_weapons_from_given_items(QVector<Item*>& mixed_items);
     void take_items_of_slot_from_given_items(QVector<Item*>& mixed_items, QVector<Item*>& sorted, const int slot);
     void delete_items(QVector<Item*>*);
@@ -70,62 +80,85 @@ private:
 
     QVector<Item*> mh_slot_items;
     QVector<Item*> current_phase_mh_slot_items;
+    QHash<int, Item*> current_phase_mh_slot_items_by_id;
 
     QVector<Item*> oh_slot_items;
     QVector<Item*> current_phase_oh_slot_items;
+    QHash<int, Item*> current_phase_oh_slot_items_by_id;
 
     QVector<Item*> ranged_items;
     QVector<Item*> current_phase_ranged_items;
+    QHash<int, Item*> current_phase_ranged_items_by_id;
 
     QVector<Item*> helms;
     QVector<Item*> current_phase_helms;
+    QHash<int, Item*> current_phase_helms_by_id;
 
     QVector<Item*> amulets;
     QVector<Item*> current_phase_amulets;
+    QHash<int, Item*> current_phase_amulets_by_id;
 
     QVector<Item*> shoulders;
     QVector<Item*> current_phase_shoulders;
+    QHash<int, Item*> current_phase_shoulders_by_id;
 
     QVector<Item*> backs;
     QVector<Item*> current_phase_backs;
+    QHash<int, Item*> current_phase_backs_by_id;
 
     QVector<Item*> chests;
     QVector<Item*> current_phase_chests;
+    QHash<int, Item*> current_phase_chests_by_id;
 
     QVector<Item*> wrists;
     QVector<Item*> current_phase_wrists;
+    QHash<int, Item*> current_phase_wrists_by_id;
 
     QVector<Item*> gloves;
     QVector<Item*> current_phase_gloves;
+    QHash<int, Item*> current_phase_gloves_by_id;
 
     QVector<Item*> belts;
     QVector<Item*> current_phase_belts;
+    QHash<int, Item*> current_phase_belts_by_id;
 
     QVector<Item*> legs;
     QVector<Item*> current_phase_legs;
+    QHash<int, Item*> current_phase_legs_by_id;
 
     QVector<Item*> boots;
     QVector<Item*> current_phase_boots;
+    QHash<int, Item*> current_phase_boots_by_id;
 
     QVector<Item*> rings;
     QVector<Item*> current_phase_rings;
+    QHash<int, Item*> current_phase_rings_by_id;
 
     QVector<Item*> trinkets;
     QVector<Item*> current_phase_trinkets;
+    QHash<int, Item*> current_phase_trinkets_by_id;
 
     QVector<Item*> projectiles;
     QVector<Item*> current_phase_projectiles;
+    QHash<int, Item*> current_phase_projectiles_by_id;
 
     QVector<Item*> relics;
     QVector<Item*> current_phase_relics;
+    QHash<int, Item*> current_phase_relics_by_id;
 
     QVector<Item*> quivers;
     QVector<Item*> current_phase_quivers;
+    QHash<int, Item*> current_phase_quivers_by_id;
 
     QVector<Item*> shields;
     QVector<Item*> current_phase_shields;
+    QHash<int, Item*> current_phase_shields_by_id;
 
     QVector<QVector<Item*>*> all_slots_items;
 
     QMap<int, Item*> item_id_to_item;
+
+    QMap<int, QString> possible_set_items;
+    QMap<QString, QVector<QPair<int, QString>>> set_bonus_tooltips;
+    QMap<QString, QMap<int, QPair<ItemStats, unsigned>>> set_bonus_effects;
 };
@@ -0,0 +1,215 @@
+#include "EquipmentDbCache.h"
+
+#include <utility>
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QFile>
+#include <QSaveFile>
+
+#include "ItemStatsEnum.h"
+#include "Projectile.h"
+#include "Weapon.h"
+
+EquipmentDbCache::EquipmentDbCache(QString path, EnchantInfo* enchant_info) : path(std::move(path)), enchant_info(enchant_info) {}
+
+QByteArray EquipmentDbCache::get_checksum(const QVector<QString>& source_paths) {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::number(FORMAT_VERSION));
+
+    for (const auto& source_path : source_paths) {
+        hash.addData(source_path.toUtf8());
+
+        QFile file(source_path);
+        if (file.open(QFile::ReadOnly))
+            hash.addData(&file);
+    }
+
+    return hash.result();
+}
+
+bool EquipmentDbCache::read(const QByteArray& checksum,
+                            QVector<Item*>& items,
+                            QMap<int, QString>& possible_set_items,
+                            QMap<QString, QVector<QPair<int, QString>>>& set_bonus_tooltips,
+                            QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& set_bonus_effects) const {
+    QFile file(path);
+    if (!file.exists() || !file.open(QFile::ReadOnly))
+        return false;
+
+    uchar* data = file.map(0, file.size());
+    if (data == nullptr)
+        return false;
+
+    const QByteArray bytes = QByteArray::fromRawData(reinterpret_cast<const char*>(data), static_cast<int>(file.size()));
+    QDataStream stream(bytes);
+    stream.setVersion(QDataStream::Qt_5_11);
+
+    const bool success = read_stream(stream, checksum, items, possible_set_items, set_bonus_tooltips, set_bonus_effects);
+
+    file.unmap(data);
+    file.close();
+
+    return success;
+}
+
+bool EquipmentDbCache::read_stream(QDataStream& stream,
+                                   const QByteArray& checksum,
+                                   QVector<Item*>& items,
+                                   QMap<int, QString>& possible_set_items,
+                                   QMap<QString, QVector<QPair<int, QString>>>& set_bonus_tooltips,
+                                   QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& set_bonus_effects) const {
+    quint32 magic = 0;
+    quint32 format_version = 0;
+    QByteArray stored_checksum;
+    stream >> magic >> format_version >> stored_checksum;
+
+    if (stream.status() != QDataStream::Ok || magic != MAGIC || format_version != FORMAT_VERSION || stored_checksum != checksum)
+        return false;
+
+    qint32 num_items = 0;
+    stream >> num_items;
+
+    QVector<Item*> read_items;
+    for (int i = 0; i < num_items && stream.status() == QDataStream::Ok; ++i) {
+        Item* item = read_item(stream);
+        if (item == nullptr)
+            break;
+
+        read_items.append(item);
+    }
+
+    QMap<int, QString> read_possible_set_items;
+    QMap<QString, QVector<QPair<int, QString>>> read_set_bonus_tooltips;
+    QMap<QString, QMap<int, QPair<qint32, quint32>>> read_set_bonus_effects;
+    stream >> read_possible_set_items >> read_set_bonus_tooltips >> read_set_bonus_effects;
+
+    if (stream.status() != QDataStream::Ok || read_items.size() != num_items || !stream.atEnd()) {
+        qDebug() << "Ignoring corrupt equipment cache" << path;
+        qDeleteAll(read_items);
+        return false;
+    }
+
+    items.append(read_items);
+    possible_set_items = read_possible_set_items;
+    set_bonus_tooltips = read_set_bonus_tooltips;
+
+    set_bonus_effects.clear();
+    for (auto set_it = read_set_bonus_effects.constBegin(); set_it != read_set_bonus_effects.constEnd(); ++set_it) {
+        for (auto bonus_it = set_it.value().constBegin(); bonus_it != set_it.value().constEnd(); ++bonus_it)
+            set_bonus_effects[set_it.key()][bonus_it.key()] = {static_cast<ItemStats>(bonus_it.value().first), bonus_it.value().second};
+    }
+
+    return true;
+}
+
+Item* EquipmentDbCache::read_item(QDataStream& stream) const {
+    quint8 kind = 0;
+    QString name;
+    qint32 item_id = 0;
+    qint32 phase = 0;
+    QMap<QString, QString> info;
+    QVector<QPair<QString, QString>> stats;
+    QVector<QMap<QString, QString>> procs;
+    QVector<QMap<QString, QString>> uses;
+    QVector<QString> item_modifications;
+    QVector<QString> special_equip_effects;
+    QSet<int> mutex_item_ids;
+    QVector<int> random_affixes;
+
+    stream >> kind >> name >> item_id >> phase >> info >> stats >> procs >> uses >> item_modifications >> special_equip_effects >> mutex_item_ids
+        >> random_affixes;
+
+    switch (static_cast<ItemKind>(kind)) {
+    case ItemKind::Item:
+        if (stream.status() != QDataStream::Ok)
+            return nullptr;
+
+        return new Item(name, item_id, Content::get_phase(phase), enchant_info, info, stats, procs, uses, item_modifications, special_equip_effects,
+                        mutex_item_ids, random_affixes);
+    case ItemKind::Weapon: {
+        qint32 weapon_type = 0;
+        qint32 weapon_slot = 0;
+        quint32 min_dmg = 0;
+        quint32 max_dmg = 0;
+        double weapon_speed = 0.0;
+        stream >> weapon_type >> weapon_slot >> min_dmg >> max_dmg >> weapon_speed;
+
+        if (stream.status() != QDataStream::Ok)
+            return nullptr;
+
+        return new Weapon(name, item_id, Content::get_phase(phase), weapon_type, weapon_slot, min_dmg, max_dmg, weapon_speed, enchant_info, info,
+                          stats, procs, uses, special_equip_effects, mutex_item_ids, random_affixes);
+    }
+    case ItemKind::Projectile: {
+        qint32 projectile_type = 0;
+        double dps = 0.0;
+        stream >> projectile_type >> dps;
+
+        if (stream.status() != QDataStream::Ok)
+            return nullptr;
+
+        return new Projectile(name, item_id, Content::get_phase(phase), projectile_type, dps, info, stats, procs, mutex_item_ids);
+    }
+    }
+
+    return nullptr;
+}
+
+bool EquipmentDbCache::write(const QByteArray& checksum,
+                             const QVector<Item*>& items,
+                             const QMap<int, QString>& possible_set_items,
+                             const QMap<QString, QVector<QPair<int, QString>>>& set_bonus_tooltips,
+                             const QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& set_bonus_effects) const {
+    // QSaveFile only replaces the previous snapshot once the new one is complete, so concurrently starting
+    // processes never read a partially written file.
+    QSaveFile file(path);
+    if (!file.open(QFile::WriteOnly)) {
+        qDebug() << "Cannot write equipment cache" << path << ":" << file.errorString();
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_11);
+
+    stream << MAGIC << FORMAT_VERSION << checksum;
+    stream << static_cast<qint32>(items.size());
+    for (const auto& item : items)
+        write_item(stream, item);
+
+    QMap<QString, QMap<int, QPair<qint32, quint32>>> stored_set_bonus_effects;
+    for (auto set_it = set_bonus_effects.constBegin(); set_it != set_bonus_effects.constEnd(); ++set_it) {
+        for (auto bonus_it = set_it.value().constBegin(); bonus_it != set_it.value().constEnd(); ++bonus_it)
+            stored_set_bonus_effects[set_it.key()][bonus_it.key()] = {static_cast<qint32>(bonus_it.value().first), bonus_it.value().second};
+    }
+
+    stream << possible_set_items << set_bonus_tooltips << stored_set_bonus_effects;
+
+    if (stream.status() != QDataStream::Ok) {
+        file.cancelWriting();
+        return false;
+    }
+
+    return file.commit();
+}
+
+void EquipmentDbCache::write_item(QDataStream& stream, const Item* item) const {
+    auto weapon = dynamic_cast<const Weapon*>(item);
+    auto projectile = dynamic_cast<const Projectile*>(item);
+
+    ItemKind kind = ItemKind::Item;
+    if (weapon != nullptr)
+        kind = ItemKind::Weapon;
+    else if (projectile != nullptr)
+        kind = ItemKind::Projectile;
+
+    stream << static_cast<quint8>(kind) << item->base_name << static_cast<qint32>(item->item_id) << static_cast<qint32>(item->phase) << item->info
+           << item->stats_key_value_pairs << item->procs_map << item->use_map << item->item_modifications << item->special_equip_effects
+           << item->mutex_item_ids << item->possible_random_affixes;
+
+    if (weapon != nullptr)
+        stream << static_cast<qint32>(weapon->get_weapon_type()) << static_cast<qint32>(weapon->get_weapon_slot())
+               << static_cast<quint32>(weapon->get_min_dmg()) << static_cast<quint32>(weapon->get_max_dmg()) << weapon->get_base_weapon_speed();
+    else if (projectile != nullptr)
+        stream << static_cast<qint32>(projectile->get_projectile_type()) << projectile->get_projectile_dps();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+class EnchantInfo;
+class Item;
+
+enum class ItemStats : int;
+
+// Binary snapshot of the parsed equipment and set bonus XML files. The snapshot stores the checksum of the XML
+// files it was compiled from; a snapshot with a different checksum or format version is ignored and rewritten
+// after the XML files have been parsed.
+class EquipmentDbCache {
+public:
+    EquipmentDbCache(QString path, EnchantInfo* enchant_info);
+
+    static const quint32 MAGIC = 0x43534551;
+    static const quint32 FORMAT_VERSION = 1;
+
+    static QByteArray get_checksum(const QVector<QString>& source_paths);
+
+    bool read(const QByteArray& checksum,
+              QVector<Item*>& items,
+              QMap<int, QString>& possible_set_items,
+              QMap<QString, QVector<QPair<int, QString>>>& set_bonus_tooltips,
+              QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& set_bonus_effects) const;
+
+    bool write(const QByteArray& checksum,
+               const QVector<Item*>& items,
+               const QMap<int, QString>& possible_set_items,
+               const QMap<QString, QVector<QPair<int, QString>>>& set_bonus_tooltips,
+               const QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& set_bonus_effects) const;
+
+private:
+    enum class ItemKind : quint8
+    {
+        Item,
+        Weapon,
+        Projectile,
+    };
+
+    const QString path;
+    EnchantInfo* enchant_info;
+
+    bool read_stream(QDataStream& stream,
+                     const QByteArray& checksum,
+                     QVector<Item*>& items,
+                     QMap<int, QString>& possible_set_items,
+                     QMap<QString, QVector<QPair<int, QString>>>& set_bonus_tooltips,
+                     QMap<QString, QMap<int, QPair<ItemStats, unsigned>>>& set_bonus_effects) const;
+    Item* read_item(QDataStream& stream) const;
+    void write_item(QDataStream& stream, const Item* item) const;
+};
@@ -30,6 +30,7 @@
 #include "JomGabbar.h"
 #include "Nightfall.h"
 #include "NoEffectSelfBuff.h"
+#include "Random.h"
 #include "RandomAffix.h"
 #include "ResourceGainProc.h"
 #include "SanctifiedOrb.h"
@@ -87,24 +88,28 @@ Item::Item(const Item* item) :
     name(item->name),
     item_id(item->item_id),
     pchar(item->pchar),
+    icon(item->icon),
+    valid_faction(item->valid_faction),
+    class_restrictions(item->class_restrictions),
     info(item->info),
+    base_tooltip_stats(item->base_tooltip_stats),
+    equip_effects_tooltip_stats(item->equip_effects_tooltip_stats),
     special_equip_effects(item->special_equip_effects),
     procs_map(item->procs_map),
     use_map(item->use_map),
     stats_key_value_pairs(item->stats_key_value_pairs),
     item_modifications(item->item_modifications),
     mutex_item_ids(item->mutex_item_ids),
-    stats(new Stats()),
+    item_stat_values(item->item_stat_values),
+    stats(new Stats(*item->stats)),
     enchant_info(item->enchant_info),
     enchant(nullptr),
     random_affix(nullptr),
-    possible_random_affixes(item->possible_random_affixes) {
-    set_stats(stats_key_value_pairs);
-    set_item_slot(info);
-    set_item_type(info);
-    set_class_restrictions(info);
-    set_faction();
-    this->icon = QString("Assets/items/%1").arg(info["icon"]);
+    possible_random_affixes(item->possible_random_affixes),
+    slot(item->slot),
+    item_type(item->item_type) {
+    // The stats parsed from the item's key-value pairs are copied as is, which would include any affix stats.
+    check((item->random_affix == nullptr), "Items can only be copied before a random affix is applied");
 }
 
 Item::~Item() {
@@ -179,6 +184,7 @@ void Item::apply_equip_effect(Character* pchar, const int eq_slot) {
 
     this->pchar = pchar;
 
+    RandomStreamScope stream_scope(pchar->get_party(), pchar->get_party_member(), QString("Equip effect %1").arg(eq_slot));
     set_uses();
     set_procs(eq_slot);
     call_item_modifications();
@@ -83,6 +83,8 @@ public:
     const int item_id;
 
 protected:
+    friend class EquipmentDbCache;
+
     Character* pchar;
     QString source;
     QString quality;
@@ -99,6 +99,7 @@ void Weapon::apply_enchant(EnchantName::Name enchant_name, Character* pchar, con
 
     delete enchant;
 
+    RandomStreamScope stream_scope(pchar->get_party(), pchar->get_party_member(), QString("Enchant %1").arg(weapon_slot));
     QSet<int> melee_weapon_slots = {WeaponSlots::ONEHAND, WeaponSlots::MAINHAND, WeaponSlots::OFFHAND, WeaponSlots::TWOHAND};
     if (melee_weapon_slots.contains(weapon_slot)) {
         int enchant_slot = weapon_slot == WeaponSlots::OFFHAND ? EnchantSlot::OFFHAND : EnchantSlot::MAINHAND;
@@ -123,6 +124,7 @@ void Weapon::apply_temporary_enchant(EnchantName::Name enchant_name, Character*
 
     clear_temporary_enchant();
 
+    RandomStreamScope stream_scope(pchar->get_party(), pchar->get_party_member(), QString("Temporary enchant %1").arg(enchant_slot));
     QSet<int> melee_enchant_slots = {EnchantSlot::MAINHAND, EnchantSlot::OFFHAND};
     if (!melee_enchant_slots.contains(enchant_slot))
         check(false, QString("Tried to apply temporary weapon enchant on unsupported slot %1").arg(enchant_slot).toStdString());
@@ -8,14 +8,16 @@
 
 class RandomAffix;
 
+// Read-only after construction. A single instance is owned by EquipmentDb and shared by every Equipment and
+// simulation thread.
 class RandomAffixes {
 public:
     RandomAffixes();
     ~RandomAffixes();
-    bool read_random_affixes(const QString& xml_file_path);
     RandomAffix* get_affix(unsigned id) const;
 
 private:
+    bool read_random_affixes(const QString& xml_file_path);
     bool random_affixes_file_handler(QXmlStreamReader& reader);
     void add_stat_to_map(const QString& type, const QString& value, QMap<ItemStats, unsigned>& map);
 
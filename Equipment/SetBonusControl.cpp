@@ -20,19 +20,24 @@
 #include "MageSpells.h"
 #include "MultiShot.h"
 #include "Pet.h"
+#include "Random.h"
 #include "RapidFire.h"
 #include "RapidFireBuff.h"
 #include "ResourceGainProc.h"
 #include "Rogue.h"
 #include "RogueSpells.h"
-#include "SetBonusFileReader.h"
 #include "SinisterStrike.h"
 #include "SliceAndDice.h"
 #include "SpellRankGroup.h"
 #include "Utils/Check.h"
 
 SetBonusControl::SetBonusControl(EquipmentDb* equipment_db, Character* pchar) : equipment_db(equipment_db), pchar(pchar) {
-    SetBonusFileReader().read_set_bonuses("set_bonuses.xml", possible_set_items, set_bonus_tooltips, set_bonus_effects);
+    if (equipment_db == nullptr)
+        return;
+
+    possible_set_items = equipment_db->get_possible_set_items();
+    set_bonus_tooltips = equipment_db->get_set_bonus_tooltips();
+    set_bonus_effects = equipment_db->get_set_bonus_effects();
 }
 
 SetBonusControl::~SetBonusControl() {
@@ -50,6 +55,7 @@ void SetBonusControl::equip_item(const int item_id) {
     const QString set_name = possible_set_items[item_id];
     current_set_items[item_id] = set_name;
     const int num_pieces = get_num_equipped_pieces_for_set(set_name);
+    RandomStreamScope stream_scope(pchar->get_party(), pchar->get_party_member(), QString("%1 %2").arg(set_name).arg(num_pieces));
 
     if (set_bonus_effects.contains(set_name) && set_bonus_effects[set_name].contains(num_pieces))
         pchar->get_stats()->increase_stat(set_bonus_effects[set_name][num_pieces].first, set_bonus_effects[set_name][num_pieces].second);
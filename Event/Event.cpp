@@ -1,8 +1,19 @@
 #include "Event.h"
 
-bool Compare::operator()(Event*& l, Event*& r) {
-    return *l > *r;
-}
+#include <new>
+
+#include "EventHandle.h"
+#include "EventPool.h"
+
+namespace {
+    // Every event is prefixed with the pool that owns it (nullptr for heap
+    // allocated events) so delete works the same regardless of origin.
+    const std::size_t HEADER_SIZE = alignof(std::max_align_t);
+
+    EventPool*& owning_pool(void* block) {
+        return *static_cast<EventPool**>(block);
+    }
+} // namespace
 
 bool operator<(const Event& l, const Event& r) {
     return l.priority < r.priority;
@@ -22,6 +33,55 @@ bool operator>=(const Event& l, const Event& r) {
 
 Event::Event(EventType event_type, const double priority) : event_type(event_type), priority(priority) {}
 
+Event::~Event() {
+    release_handle();
+}
+
+void Event::cancel() {
+    release_handle();
+    this->cancelled = true;
+}
+
+bool Event::is_cancelled() const {
+    return this->cancelled;
+}
+
+void Event::release_handle() {
+    if (handle != nullptr)
+        handle->event = nullptr;
+
+    handle = nullptr;
+}
+
+void* Event::operator new(std::size_t size) {
+    void* block = ::operator new(size + HEADER_SIZE);
+    owning_pool(block) = nullptr;
+    return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+void* Event::operator new(std::size_t size, EventPool* pool) {
+    void* block = pool->allocate(size + HEADER_SIZE);
+    owning_pool(block) = pool;
+    return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+void Event::operator delete(void* ptr) {
+    if (ptr == nullptr)
+        return;
+
+    void* block = static_cast<char*>(ptr) - HEADER_SIZE;
+    EventPool* pool = owning_pool(block);
+
+    if (pool == nullptr)
+        ::operator delete(block);
+    else
+        pool->release(block);
+}
+
+void Event::operator delete(void* ptr, EventPool*) {
+    Event::operator delete(ptr);
+}
+
 QString Event::get_name_for_event_type(const EventType event_type) {
     switch (event_type) {
     case EventType::BuffRemoval:
@@ -34,6 +94,8 @@ QString Event::get_name_for_event_type(const EventType event_type) {
         return "EncounterEnd";
     case EventType::EncounterStart:
         return "EncounterStart";
+    case EventType::IncomingDamage:
+        return "IncomingDamage";
     case EventType::MainhandMeleeHit:
         return "MainhandMeleeHit";
     case EventType::OffhandMeleeHit:
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <QHash>
 #include <QString>
 
@@ -21,6 +23,11 @@ enum class EventType : int
     SpellCallback,
 };
 
+static const int NUM_EVENT_TYPES = static_cast<int>(EventType::SpellCallback) + 1;
+
+class EventHandle;
+class EventPool;
+
 inline uint qHash(const EventType event_type) {
     return qHash(static_cast<int>(event_type), 0xF0F0F);
 }
@@ -33,18 +40,28 @@ public:
     friend bool operator>=(const Event&, const Event&);
 
     Event(EventType event_type, const double priority);
-    virtual ~Event() = default;
+    virtual ~Event();
+
+    static void* operator new(std::size_t size);
+    static void* operator new(std::size_t size, EventPool* pool);
+    static void operator delete(void* ptr);
+    static void operator delete(void* ptr, EventPool* pool);
 
     virtual void act() = 0;
 
     static QString get_name_for_event_type(const EventType event_type);
     static QString get_name_for_event(const Event* event);
 
+    void cancel();
+    bool is_cancelled() const;
+    void release_handle();
+
     const EventType event_type;
     const double priority;
-};
 
-class Compare {
-public:
-    bool operator()(Event*&, Event*&);
+private:
+    friend class EventHandle;
+
+    EventHandle* handle {nullptr};
+    bool cancelled {false};
 };
@@ -0,0 +1,28 @@
+#include "EventHandle.h"
+
+#include "Event.h"
+
+EventHandle::~EventHandle() {
+    release();
+}
+
+void EventHandle::bind(Event* event) {
+    release();
+
+    event->release_handle();
+    event->handle = this;
+    this->event = event;
+}
+
+Event* EventHandle::release() {
+    Event* pending = this->event;
+    if (pending != nullptr)
+        pending->handle = nullptr;
+
+    this->event = nullptr;
+    return pending;
+}
+
+bool EventHandle::is_pending() const {
+    return this->event != nullptr;
+}
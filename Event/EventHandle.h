@@ -0,0 +1,28 @@
+#pragma once
+
+class Event;
+
+/*
+ * Refers to the pending event that a spell or buff has scheduled, e.g. the
+ * next swing or the removal of a buff. The link is cleared from either side:
+ * when the event is popped from the queue or destroyed, or when the handle
+ * itself is destroyed. Use Engine::reschedule_event/cancel_event to replace
+ * or drop the pending event instead of leaving a stale one in the queue.
+ */
+class EventHandle {
+public:
+    EventHandle() = default;
+    ~EventHandle();
+
+    EventHandle(const EventHandle&) = delete;
+    EventHandle& operator=(const EventHandle&) = delete;
+
+    void bind(Event* event);
+    Event* release();
+    bool is_pending() const;
+
+private:
+    friend class Event;
+
+    Event* event {nullptr};
+};
@@ -0,0 +1,62 @@
+#include "EventPool.h"
+
+#include <QString>
+
+#include "Utils/Check.h"
+
+EventPool::EventPool() = default;
+
+EventPool::~EventPool() {
+    for (const auto& slab : slabs)
+        delete[] slab;
+}
+
+void* EventPool::allocate(const std::size_t size) {
+    hot_check((size <= BLOCK_SIZE), QString("Event of size %1 does not fit in pool block of size %2").arg(size).arg(BLOCK_SIZE).toStdString());
+
+    if (free_list == nullptr)
+        add_slab();
+
+    FreeBlock* block = free_list;
+    free_list = block->next;
+
+    if (++num_live_events > high_water_mark)
+        high_water_mark = num_live_events;
+
+    return block;
+}
+
+void EventPool::release(void* block) {
+    auto free_block = static_cast<FreeBlock*>(block);
+    free_block->next = free_list;
+    free_list = free_block;
+
+    --num_live_events;
+}
+
+unsigned EventPool::get_num_live_events() const {
+    return this->num_live_events;
+}
+
+unsigned EventPool::get_high_water_mark() const {
+    return this->high_water_mark;
+}
+
+unsigned EventPool::get_num_slabs() const {
+    return static_cast<unsigned>(this->slabs.size());
+}
+
+void EventPool::reset_high_water_mark() {
+    this->high_water_mark = num_live_events;
+}
+
+void EventPool::add_slab() {
+    char* slab = new char[BLOCK_SIZE * BLOCKS_PER_SLAB];
+    slabs.append(slab);
+
+    for (unsigned i = BLOCKS_PER_SLAB; i > 0; --i) {
+        auto block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * BLOCK_SIZE);
+        block->next = free_list;
+        free_list = block;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+#include <QVector>
+
+/*
+ * Fixed-size block allocator for Event subclasses. Each Engine owns one pool
+ * and events are created with placement syntax, e.g.
+ *
+ *     engine->add_event(new (engine->get_event_pool()) PlayerAction(spells, timestamp));
+ *
+ * Released blocks go back onto an intrusive free list and slabs are only
+ * returned to the heap when the pool is destroyed, so after the first few
+ * iterations the simulation loop no longer touches the global heap.
+ */
+class EventPool {
+public:
+    EventPool();
+    ~EventPool();
+
+    void* allocate(const std::size_t size);
+    void release(void* block);
+
+    unsigned get_num_live_events() const;
+    unsigned get_high_water_mark() const;
+    unsigned get_num_slabs() const;
+    void reset_high_water_mark();
+
+    static const std::size_t BLOCK_SIZE = 96;
+    static const unsigned BLOCKS_PER_SLAB = 512;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    QVector<char*> slabs;
+    FreeBlock* free_list {nullptr};
+    unsigned num_live_events {0};
+    unsigned high_water_mark {0};
+
+    void add_slab();
+};
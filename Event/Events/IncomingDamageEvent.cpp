@@ -10,10 +10,10 @@
 #include "PhysicalAttackResult.h"
 
 IncomingDamageEvent::IncomingDamageEvent(Character* character, Engine* engine, const int timestamp) :
-    character(character), roll(new CombatRoll(character)), Event(EventType::IncomingDamage, static_cast<double>(timestamp)), engine(engine) {}
+    character(character), roll(character->get_combat_roll()), Event(EventType::IncomingDamage, static_cast<double>(timestamp)), engine(engine) {}
 
 void IncomingDamageEvent::act() {
-    engine->add_event(new IncomingDamageEvent(character, engine, engine->get_current_priority() + 1.5));
+    engine->add_event(new (engine->get_event_pool()) IncomingDamageEvent(character, engine, engine->get_current_priority() + 1.5));
 
     auto result = roll->get_melee_hit_result(300, 500);
 
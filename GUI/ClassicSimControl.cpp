@@ -89,7 +89,7 @@
 ClassicSimControl::ClassicSimControl(QObject* parent) :
     QObject(parent),
     equipment_db(new EquipmentDb()),
-    random_affixes_db(new RandomAffixes()),
+    random_affixes_db(equipment_db->get_random_affixes()),
     character_encoder(new CharacterEncoder()),
     character_decoder(new CharacterDecoder()),
     sim_settings(new SimSettings()),
@@ -119,6 +119,7 @@ ClassicSimControl::ClassicSimControl(QObject* parent) :
     thread_pool = new SimulationThreadPool(equipment_db, random_affixes_db, sim_settings, number_cruncher);
     QObject::connect(thread_pool, &SimulationThreadPool::threads_finished, this, &ClassicSimControl::compile_thread_results);
     QObject::connect(thread_pool, &SimulationThreadPool::update_progress, this, &ClassicSimControl::update_progress);
+    QObject::connect(thread_pool, &SimulationThreadPool::simulation_error, [](const QString& error) { qDebug() << "Simulation error:" << error; });
 
     this->sim_control = new SimControl(sim_settings, number_cruncher);
     this->sim_scale_model = new SimScaleModel(sim_settings);
@@ -186,7 +187,6 @@ ClassicSimControl::~ClassicSimControl() {
         delete race;
 
     delete equipment_db;
-    delete random_affixes_db;
     delete item_model;
     delete item_type_filter_model;
     delete active_stat_filter_model;
@@ -841,6 +841,9 @@ void ClassicSimControl::resetDefaultSettings() {
     setCombatIterationsQuickSim(1000);
     setCombatLength(300);
     setNumThreads(sim_settings->get_num_threads_max());
+    if (sim_settings->get_common_random_numbers())
+        toggleCommonRandomNumbers();
+    setTargetConfidenceInterval(0);
     setTargetBaseArmor(Mechanics::get_boss_base_armor());
 }
 
@@ -976,6 +979,7 @@ void ClassicSimControl::compile_thread_results() {
     rotation_executor_list_model->update_statistics();
     damage_meters_model->update_statistics();
     last_engine_handled_events_per_second = engine_breakdown_model->events_handled_per_second();
+    last_engine_event_pool_high_water_mark = engine_breakdown_model->event_pool_high_water_mark();
     update_displayed_dps_value(number_cruncher->get_personal_dps(SimOption::Name::NoScale),
                                number_cruncher->get_personal_tps(SimOption::Name::NoScale));
     update_displayed_raid_dps_value(number_cruncher->get_raid_dps());
@@ -992,6 +996,10 @@ QString ClassicSimControl::get_handled_events_per_second() const {
     return QString::number(last_engine_handled_events_per_second, 'f', 0);
 }
 
+QString ClassicSimControl::get_event_pool_high_water_mark() const {
+    return QString::number(last_engine_event_pool_high_water_mark);
+}
+
 QString ClassicSimControl::get_min_dps() const {
     if (dps_distribution == nullptr)
         return "0.0";
@@ -1040,6 +1048,14 @@ int ClassicSimControl::get_max_threads() const {
     return sim_settings->get_num_threads_max();
 }
 
+bool ClassicSimControl::get_common_random_numbers() const {
+    return sim_settings->get_common_random_numbers();
+}
+
+int ClassicSimControl::get_target_confidence_interval() const {
+    return static_cast<int>(sim_settings->get_target_confidence_interval());
+}
+
 void ClassicSimControl::setCombatIterationsFullSim(const int iterations) {
     sim_settings->set_combat_iterations_full_sim(iterations);
     emit combatIterationsChanged();
@@ -1065,6 +1081,16 @@ void ClassicSimControl::setNumThreads(const int threads) {
     emit numThreadsChanged();
 }
 
+void ClassicSimControl::toggleCommonRandomNumbers() {
+    sim_settings->set_common_random_numbers(!sim_settings->get_common_random_numbers());
+    emit commonRandomNumbersChanged();
+}
+
+void ClassicSimControl::setTargetConfidenceInterval(const int target_dps) {
+    sim_settings->set_target_confidence_interval(target_dps);
+    emit targetConfidenceIntervalChanged();
+}
+
 void ClassicSimControl::selectRuleset(const int ruleset) {
     sim_settings->use_ruleset(static_cast<Ruleset>(ruleset), current_char);
     emit statsChanged();
@@ -1652,6 +1678,9 @@ void ClassicSimControl::save_configuration() {
         stream.writeTextElement("ruleset", QString("%1").arg(sim_settings->get_ruleset()));
         stream.writeTextElement("target_creature_type", current_char->get_target()->get_creature_type_string());
         stream.writeTextElement("threads", QString("%1").arg(sim_settings->get_num_threads_current()));
+        stream.writeTextElement("target_confidence_interval", QString::number(sim_settings->get_target_confidence_interval()));
+        stream.writeTextElement("common_random_numbers", QString::number(static_cast<int>(sim_settings->get_common_random_numbers())));
+        stream.writeTextElement("fast_forward_pet_swings", QString::number(static_cast<int>(sim_settings->get_fast_forward_pet_swings())));
 
         QSet<SimOption::Name> options = sim_settings->get_active_options();
         for (const auto& option : options)
@@ -1708,6 +1737,12 @@ void ClassicSimControl::activate_configuration(const QStringRef& name, const QSt
         current_char->get_target()->set_creature_type(value);
     else if (name == "threads")
         sim_settings->set_num_threads(value.toInt());
+    else if (name == "target_confidence_interval")
+        sim_settings->set_target_confidence_interval(value.toDouble());
+    else if (name == "common_random_numbers")
+        sim_settings->set_common_random_numbers(value.toInt() != 0);
+    else if (name == "fast_forward_pet_swings")
+        sim_settings->set_fast_forward_pet_swings(value.toInt() != 0);
     else if (name == "sim_option")
         sim_settings->add_sim_option(static_cast<SimOption::Name>(value.toInt()));
 }
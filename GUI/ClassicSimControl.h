@@ -249,7 +249,9 @@ public:
     Q_PROPERTY(QString dpsStdDev READ get_standard_deviation NOTIFY statisticsReady)
     Q_PROPERTY(QString dpsConfInterval READ get_confidence_interval NOTIFY statisticsReady)
     Q_PROPERTY(QString engineHandledEventsPerSecond READ get_handled_events_per_second NOTIFY statisticsReady)
+    Q_PROPERTY(QString engineEventPoolHighWaterMark READ get_event_pool_high_water_mark NOTIFY statisticsReady)
     QString get_handled_events_per_second() const;
+    QString get_event_pool_high_water_mark() const;
     /* End of Statistics */
 
     /* Target */
@@ -285,13 +287,19 @@ public:
     Q_PROPERTY(int combatIterationsQuickSim READ get_combat_iterations_quick_sim NOTIFY combatIterationsChanged)
     Q_PROPERTY(int numThreads READ get_num_threads NOTIFY numThreadsChanged)
     Q_PROPERTY(int maxThreads READ get_max_threads NOTIFY numThreadsChanged)
+    Q_PROPERTY(bool commonRandomNumbers READ get_common_random_numbers NOTIFY commonRandomNumbersChanged)
+    Q_PROPERTY(int targetConfidenceInterval READ get_target_confidence_interval NOTIFY targetConfidenceIntervalChanged)
     Q_INVOKABLE void setCombatLength(const int);
     Q_INVOKABLE void setCombatIterationsFullSim(const int);
     Q_INVOKABLE void setCombatIterationsQuickSim(const int);
     Q_INVOKABLE void setNumThreads(const int);
+    Q_INVOKABLE void toggleCommonRandomNumbers();
+    Q_INVOKABLE void setTargetConfidenceInterval(const int);
     Q_SIGNAL void combatLengthChanged();
     Q_SIGNAL void combatIterationsChanged();
     Q_SIGNAL void numThreadsChanged();
+    Q_SIGNAL void commonRandomNumbersChanged();
+    Q_SIGNAL void targetConfidenceIntervalChanged();
     Q_INVOKABLE void selectRuleset(const int);
     Q_PROPERTY(QString simProgressString READ get_sim_progress_string NOTIFY simProgressChanged)
     Q_SIGNAL void simProgressChanged();
@@ -387,6 +395,8 @@ protected:
     int get_combat_length() const;
     int get_num_threads() const;
     int get_max_threads() const;
+    bool get_common_random_numbers() const;
+    int get_target_confidence_interval() const;
 
     QString get_mainhand_icon() const;
     QString get_offhand_icon() const;
@@ -485,6 +495,7 @@ protected:
     double last_personal_sim_result_tps {0.0};
     double last_raid_sim_result {0.0};
     double last_engine_handled_events_per_second {0.0};
+    unsigned last_engine_event_pool_high_water_mark {0};
     bool sim_in_progress;
     double sim_percent_completed {0.0};
     int current_party {1};
@@ -12,6 +12,7 @@ EngineBreakdownModel::EngineBreakdownModel(NumberCruncher* statistics_source, QO
     this->sorting_methods.insert(EngineBreakdownSorting::Methods::ByPercentage, SortDirection::Forward);
     this->sorting_methods.insert(EngineBreakdownSorting::Methods::ByTotal, SortDirection::Forward);
     this->sorting_methods.insert(EngineBreakdownSorting::Methods::ByHandledPerMin, SortDirection::Forward);
+    this->sorting_methods.insert(EngineBreakdownSorting::Methods::ByCancelled, SortDirection::Forward);
 }
 
 EngineBreakdownModel::~EngineBreakdownModel() {
@@ -33,6 +34,12 @@ void EngineBreakdownModel::selectSort(const int method) {
         std::sort(event_statistics.begin(), event_statistics.end(), total);
         select_new_method(sorting_method);
         break;
+    case EngineBreakdownSorting::Methods::ByCancelled:
+        std::sort(event_statistics.begin(), event_statistics.end(), [this](QPair<EventType, unsigned> lhs, QPair<EventType, unsigned> rhs) {
+            return engine_stats->get_cancelled_events(lhs.first) > engine_stats->get_cancelled_events(rhs.first);
+        });
+        select_new_method(sorting_method);
+        break;
     }
 
     emit layoutChanged();
@@ -86,6 +93,10 @@ double EngineBreakdownModel::events_handled_per_second() const {
     return static_cast<double>(total_events) / engine_stats->get_elapsed() * 1000;
 }
 
+unsigned EngineBreakdownModel::event_pool_high_water_mark() const {
+    return engine_stats->get_event_pool_high_water_mark();
+}
+
 int EngineBreakdownModel::rowCount(const QModelIndex& parent) const {
     Q_UNUSED(parent);
     return event_statistics.count();
@@ -105,6 +116,8 @@ QVariant EngineBreakdownModel::data(const QModelIndex& index, int role) const {
         return event_to_num_handled.second;
     if (role == EngineBreakdownSorting::ByHandledPerMin)
         return QString::number(static_cast<double>(event_to_num_handled.second) / time_in_combat * 60, 'f', 1);
+    if (role == EngineBreakdownSorting::ByCancelled)
+        return engine_stats->get_cancelled_events(event_to_num_handled.first);
 
     return QVariant();
 }
@@ -115,6 +128,7 @@ QHash<int, QByteArray> EngineBreakdownModel::roleNames() const {
     roles[EngineBreakdownSorting::ByPercentage] = "_percentage";
     roles[EngineBreakdownSorting::ByTotal] = "_total";
     roles[EngineBreakdownSorting::ByHandledPerMin] = "_permin";
+    roles[EngineBreakdownSorting::ByCancelled] = "_cancelled";
 
     return roles;
 }
@@ -17,6 +17,7 @@ public:
         ByPercentage,
         ByTotal,
         ByHandledPerMin,
+        ByCancelled,
     };
     Q_ENUM(Methods)
 };
@@ -31,6 +32,7 @@ public:
 
     void update_statistics();
     double events_handled_per_second() const;
+    unsigned event_pool_high_water_mark() const;
 
     int rowCount(const QModelIndex& parent = QModelIndex()) const;
     QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const;
@@ -25,6 +25,10 @@ bool confidence_interval(ScaleResult* lhs, ScaleResult* rhs) {
     return lhs->confidence_interval > rhs->confidence_interval;
 }
 
+bool paired_confidence_interval(ScaleResult* lhs, ScaleResult* rhs) {
+    return lhs->paired_confidence_interval > rhs->paired_confidence_interval;
+}
+
 ScaleResultModel::ScaleResultModel(NumberCruncher* statistics_source, bool for_dps, QObject* parent) :
     QAbstractListModel(parent), statistics_source(statistics_source), for_dps{for_dps} {
     this->current_sorting_method = ScaleResultSorting::Methods::ByAbsoluteValue;
@@ -63,6 +67,10 @@ void ScaleResultModel::selectSort(const int method) {
         std::sort(scale_results.begin(), scale_results.end(), confidence_interval);
         select_new_method(sorting_method);
         break;
+    case ScaleResultSorting::Methods::ByPairedConfidenceInterval:
+        std::sort(scale_results.begin(), scale_results.end(), paired_confidence_interval);
+        select_new_method(sorting_method);
+        break;
     }
 
     emit layoutChanged();
@@ -132,6 +140,8 @@ QVariant ScaleResultModel::data(const QModelIndex& index, int role) const {
         return QString::number(scale_result->standard_deviation, 'f', 2);
     if (role == ScaleResultSorting::ByConfidenceInterval)
         return QString::number(scale_result->confidence_interval, 'f', 2);
+    if (role == ScaleResultSorting::ByPairedConfidenceInterval)
+        return QString::number(scale_result->paired_confidence_interval, 'f', 2);
 
     return QVariant();
 }
@@ -143,6 +153,7 @@ QHash<int, QByteArray> ScaleResultModel::roleNames() const {
     roles[ScaleResultSorting::ByRelativeValue] = "_relvalue";
     roles[ScaleResultSorting::ByStandardDeviation] = "_standarddev";
     roles[ScaleResultSorting::ByConfidenceInterval] = "_confidenceinterval";
+    roles[ScaleResultSorting::ByPairedConfidenceInterval] = "_pairedconfidenceinterval";
 
     return roles;
 }
@@ -17,7 +17,8 @@ public:
         ByAbsoluteValue,
         ByRelativeValue,
         ByStandardDeviation,
-        ByConfidenceInterval
+        ByConfidenceInterval,
+        ByPairedConfidenceInterval
     };
     Q_ENUM(Methods)
 };
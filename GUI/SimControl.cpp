@@ -2,8 +2,6 @@
 
 #include <random>
 
-#include <QDebug>
-
 #include "CastingTimeRequirer.h"
 #include "Character.h"
 #include "CharacterSpells.h"
@@ -15,47 +13,60 @@
 #include "Engine.h"
 #include "IncomingDamageEvent.h"
 #include "ItemNamespace.h"
+#include "IterationScheduler.h"
 #include "NumberCruncher.h"
 #include "RaidControl.h"
+#include "Random.h"
 #include "Rotation.h"
+#include "RunningStatistics.h"
 #include "Spell.h"
 
-SimControl::SimControl(SimSettings* sim_settings, NumberCruncher* scaler) : sim_settings(sim_settings), scaler(scaler) {}
+SimControl::SimControl(SimSettings* sim_settings, NumberCruncher* scaler, IterationScheduler* scheduler) :
+    sim_settings(sim_settings), scaler(scaler), scheduler(scheduler) {}
 
 void SimControl::run_quick_sim(QVector<Character*> raid, RaidControl* raid_control) {
-    run_sim(raid, raid_control, sim_settings->get_combat_length(), sim_settings->get_combat_iterations_quick_sim());
-
-    for (int i = 0; i < raid.size(); ++i)
-        raid[0]->get_statistics()->add_player_result(raid[i]->get_statistics()->get_personal_result());
+    const int iterations_completed = run_sim(raid, raid_control, SimOption::Name::NoScale, sim_settings->get_combat_length(),
+                                             sim_settings->get_combat_iterations_quick_sim());
+    add_statistics(raid, SimOption::Name::NoScale, iterations_completed);
+}
 
-    scaler->add_class_statistic(SimOption::Name::NoScale, raid[0]->relinquish_ownership_of_statistics());
-    scaler->add_class_statistic(SimOption::Name::NoScale, raid[0]->get_raid_control()->relinquish_ownership_of_statistics());
+void SimControl::run_option(QVector<Character*> raid, RaidControl* raid_control, SimOption::Name option) {
+    const int iterations_completed = run_sim_with_option(raid, raid_control, option, sim_settings->get_combat_length(),
+                                                         sim_settings->get_combat_iterations_full_sim());
+    add_statistics(raid, option, iterations_completed);
 }
 
-void SimControl::run_full_sim(QVector<Character*> raid, RaidControl* raid_control) {
-    run_sim(raid, raid_control, sim_settings->get_combat_length(), sim_settings->get_combat_iterations_full_sim());
+void SimControl::add_statistics(QVector<Character*> raid, SimOption::Name option, const int iterations_completed) {
+    // Other threads may have claimed every batch for this option; there is nothing to report in that case.
+    if (iterations_completed == 0) {
+        delete raid[0]->relinquish_ownership_of_statistics();
+        delete raid[0]->get_raid_control()->relinquish_ownership_of_statistics();
+        return;
+    }
 
     for (int i = 0; i < raid.size(); ++i)
         raid[0]->get_statistics()->add_player_result(raid[i]->get_statistics()->get_personal_result());
-    scaler->add_class_statistic(SimOption::Name::NoScale, raid[0]->relinquish_ownership_of_statistics());
-    scaler->add_class_statistic(SimOption::Name::NoScale, raid[0]->get_raid_control()->relinquish_ownership_of_statistics());
-
-    QSet<SimOption::Name> options = sim_settings->get_active_options();
-    for (const auto& option : options) {
-        qDebug() << "Running sim with option" << option;
-        run_sim_with_option(raid, raid_control, option, sim_settings->get_combat_length(), sim_settings->get_combat_iterations_full_sim());
-
-        for (int i = 0; i < raid.size(); ++i)
-            raid[0]->get_statistics()->add_player_result(raid[i]->get_statistics()->get_personal_result());
-        scaler->add_class_statistic(option, raid[0]->relinquish_ownership_of_statistics());
-        scaler->add_class_statistic(option, raid[0]->get_raid_control()->relinquish_ownership_of_statistics());
-    }
+    scaler->add_class_statistic(option, raid[0]->relinquish_ownership_of_statistics());
+    scaler->add_class_statistic(option, raid[0]->get_raid_control()->relinquish_ownership_of_statistics());
+}
+
+int SimControl::claim_iterations(const SimOption::Name option, const int iterations_completed, const int iterations, int& first_iteration) const {
+    if (scheduler != nullptr)
+        return scheduler->claim_batch(option, first_iteration);
+
+    first_iteration = iterations_completed;
+    return iterations - iterations_completed;
 }
 
 static std::random_device rng;
 static std::mt19937 urng(rng());
 
-void SimControl::run_sim(QVector<Character*> raid, RaidControl* raid_control, const int combat_length, const int iterations) {
+int SimControl::run_sim(QVector<Character*> raid, RaidControl* raid_control, SimOption::Name option, const int combat_length, const int iterations) {
+    int first_iteration = 0;
+    int batch = claim_iterations(option, 0, iterations, first_iteration);
+    if (batch == 0)
+        return 0;
+
     raid_control->prepare_set_of_combat_iterations();
 
     for (const auto& pchar : raid) {
@@ -70,60 +81,86 @@ void SimControl::run_sim(QVector<Character*> raid, RaidControl* raid_control, co
             start_at = time_for_precombat;
     }
 
-    int reported_iterations = 0;
-    for (int i = 0; i < iterations; ++i) {
-        raid_control->get_engine()->prepare_iteration(-start_at);
-
-        std::shuffle(raid.begin(), raid.end(), urng);
+    // The raid is shuffled every iteration; results are reported for the character that was first in the raid.
+    Character* reported_pchar = raid[0];
 
-        for (const auto& pchar : raid) {
-            Rotation* rotation = pchar->get_spells()->get_rotation();
-            rotation->run_precombat_actions();
-            if (rotation->precast_spell != nullptr && rotation->precast_spell->is_enabled())
-                rotation->precast_spell->perform();
+    int iterations_completed = 0;
+    while (batch > 0) {
+        RunningStatistics batch_dps;
+        for (int i = 0; i < batch; ++i) {
+            run_iteration(raid, raid_control, first_iteration + i, start_at, combat_length);
+            batch_dps.add(reported_pchar->get_statistics()->get_dps_for_last_iteration());
         }
 
-        for (const auto& pchar : raid) {
-            if (pchar->is_tanking())
-                raid_control->get_engine()->add_event(new IncomingDamageEvent(pchar, raid_control->get_engine(), 0));
-            raid_control->get_engine()->add_event(new EncounterStart(pchar->get_spells(), pchar->get_enabled_buffs()));
-        }
+        iterations_completed += batch;
+        emit update_progress(batch);
 
-        raid_control->get_engine()->add_event(new EncounterEnd(raid_control->get_engine(), combat_length));
-        raid_control->get_engine()->run();
+        if (scheduler != nullptr)
+            scheduler->add_batch_result(option, batch_dps);
 
-        raid_control->reset();
-        raid_control->get_statistics()->finish_combat_iteration();
+        batch = claim_iterations(option, iterations_completed, iterations, first_iteration);
+    }
 
-        for (const auto& pchar : raid) {
-            pchar->reset();
-            pchar->get_statistics()->finish_combat_iteration();
-        }
+    for (const auto& pchar : raid)
+        pchar->finish_set_of_combat_iterations();
 
-        raid_control->get_target()->check_clean();
+    raid_control->get_engine()->reset();
 
-        ++reported_iterations;
-        if (reported_iterations % 10 == 0) {
-            emit update_progress(reported_iterations);
-            reported_iterations = 0;
-        }
+    return iterations_completed;
+}
+
+void SimControl::run_iteration(
+    QVector<Character*>& raid, RaidControl* raid_control, const int iteration, const double start_at, const int combat_length) {
+    raid_control->get_engine()->prepare_iteration(-start_at);
+
+    if (sim_settings->get_common_random_numbers()) {
+        // Every option replays the same random streams for a given iteration, which makes the per-iteration
+        // differences between options far less noisy than the difference between independent runs.
+        const unsigned long long seed = (scheduler != nullptr ? scheduler->get_seed() : 0) + static_cast<unsigned long long>(iteration);
+        Random::reseed_generators_on_current_thread(seed);
+        std::mt19937 iteration_urng(static_cast<std::mt19937::result_type>(seed));
+        std::shuffle(raid.begin(), raid.end(), iteration_urng);
+    } else
+        std::shuffle(raid.begin(), raid.end(), urng);
+
+    for (const auto& pchar : raid) {
+        Rotation* rotation = pchar->get_spells()->get_rotation();
+        rotation->run_precombat_actions();
+        if (rotation->precast_spell != nullptr && rotation->precast_spell->is_enabled())
+            rotation->precast_spell->perform();
     }
 
-    for (const auto& pchar : raid)
-        pchar->get_spells()->get_rotation()->finish_set_of_combat_iterations();
+    for (const auto& pchar : raid) {
+        if (pchar->is_tanking())
+            raid_control->get_engine()->add_event(new (raid_control->get_engine()->get_event_pool()) IncomingDamageEvent(pchar, raid_control->get_engine(), 0));
+        raid_control->get_engine()->add_event(new (raid_control->get_engine()->get_event_pool()) EncounterStart(pchar->get_spells(), pchar->get_enabled_buffs()));
+    }
 
-    raid_control->get_engine()->reset();
+    raid_control->get_engine()->add_event(new (raid_control->get_engine()->get_event_pool()) EncounterEnd(raid_control->get_engine(), combat_length));
+    raid_control->get_engine()->run();
+
+    raid_control->reset();
+    raid_control->get_statistics()->finish_combat_iteration(iteration);
+
+    for (const auto& pchar : raid) {
+        pchar->reset();
+        pchar->get_statistics()->finish_combat_iteration(iteration);
+    }
+
+    raid_control->get_target()->check_clean();
 }
 
-void SimControl::run_sim_with_option(
+int SimControl::run_sim_with_option(
     QVector<Character*> raid, RaidControl* raid_control, SimOption::Name option, const int combat_length, const int iterations) {
     for (const auto& pchar : raid)
         add_option(pchar, option);
 
-    run_sim(raid, raid_control, combat_length, iterations);
+    const int iterations_completed = run_sim(raid, raid_control, option, combat_length, iterations);
 
     for (const auto& pchar : raid)
         remove_option(pchar, option);
+
+    return iterations_completed;
 }
 
 void SimControl::add_option(Character* pchar, SimOption::Name option) {
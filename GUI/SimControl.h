@@ -3,16 +3,17 @@
 #include "SimSettings.h"
 
 class Character;
+class IterationScheduler;
 class NumberCruncher;
 class RaidControl;
 
 class SimControl : public QObject {
     Q_OBJECT
 public:
-    SimControl(SimSettings* sim_settings, NumberCruncher* scaler);
+    SimControl(SimSettings* sim_settings, NumberCruncher* scaler, IterationScheduler* scheduler = nullptr);
 
     void run_quick_sim(QVector<Character*> raid, RaidControl* raid_control);
-    void run_full_sim(QVector<Character*> raid, RaidControl* raid_control);
+    void run_option(QVector<Character*> raid, RaidControl* raid_control, SimOption::Name option);
 
 signals:
     void update_progress(int iterations_completed);
@@ -20,11 +21,15 @@ signals:
 private:
     SimSettings* sim_settings;
     NumberCruncher* scaler;
+    IterationScheduler* scheduler;
 
     void add_option(Character*, SimOption::Name);
     void remove_option(Character*, SimOption::Name);
-    void run_sim_with_option(
+    int run_sim_with_option(
         QVector<Character*> raid, RaidControl* raid_control, SimOption::Name option, const int combat_length, const int iterations);
 
-    void run_sim(QVector<Character*> raid, RaidControl* raid_control, const int combat_length, const int iterations);
+    int run_sim(QVector<Character*> raid, RaidControl* raid_control, SimOption::Name option, const int combat_length, const int iterations);
+    void run_iteration(QVector<Character*>& raid, RaidControl* raid_control, const int iteration, const double start_at, const int combat_length);
+    int claim_iterations(const SimOption::Name option, const int iterations_completed, const int iterations, int& first_iteration) const;
+    void add_statistics(QVector<Character*> raid, SimOption::Name option, const int iterations_completed);
 };
@@ -11,6 +11,9 @@ SimSettings::SimSettings() :
     combat_iterations_quick_sim(1000),
     combat_iterations_full_sim(10000),
     num_threads(QThread::idealThreadCount()),
+    target_confidence_interval(0.0),
+    common_random_numbers(false),
+    fast_forward_pet_swings(false),
     execute_threshold(0.2),
     ruleset_control(new RulesetControl()) {}
 
@@ -88,6 +91,31 @@ QSet<SimOption::Name> SimSettings::get_active_options() const {
     return sim_options;
 }
 
+double SimSettings::get_target_confidence_interval() const {
+    return this->target_confidence_interval;
+}
+
+void SimSettings::set_target_confidence_interval(const double target_confidence_interval) {
+    check((target_confidence_interval >= 0.0), "Target confidence interval must be non-negative");
+    this->target_confidence_interval = target_confidence_interval;
+}
+
+bool SimSettings::get_common_random_numbers() const {
+    return this->common_random_numbers;
+}
+
+void SimSettings::set_common_random_numbers(const bool common_random_numbers) {
+    this->common_random_numbers = common_random_numbers;
+}
+
+bool SimSettings::get_fast_forward_pet_swings() const {
+    return this->fast_forward_pet_swings;
+}
+
+void SimSettings::set_fast_forward_pet_swings(const bool fast_forward_pet_swings) {
+    this->fast_forward_pet_swings = fast_forward_pet_swings;
+}
+
 void SimSettings::use_ruleset(const Ruleset ruleset, Character* pchar) {
     ruleset_control->use_ruleset(ruleset, pchar, this);
 }
@@ -37,6 +37,15 @@ public:
     bool option_active(SimOption::Name) const;
     QSet<SimOption::Name> get_active_options() const;
 
+    double get_target_confidence_interval() const;
+    void set_target_confidence_interval(const double);
+
+    bool get_common_random_numbers() const;
+    void set_common_random_numbers(const bool);
+
+    bool get_fast_forward_pet_swings() const;
+    void set_fast_forward_pet_swings(const bool);
+
     void use_ruleset(const Ruleset, Character*);
     Ruleset get_ruleset() const;
 
@@ -50,6 +59,9 @@ private:
     int combat_iterations_quick_sim;
     int combat_iterations_full_sim;
     int num_threads;
+    double target_confidence_interval;
+    bool common_random_numbers;
+    bool fast_forward_pet_swings;
     double execute_threshold;
     RulesetControl* ruleset_control;
 
@@ -167,8 +167,8 @@ double Mechanics::get_full_resist_chance(const unsigned t_resistance) {
 
 double Mechanics::get_linear_increase_in_range(
     const unsigned x_min, const double y_min, const unsigned x_max, const double y_max, const unsigned x_curr) {
-    check((x_curr >= x_min), "x_curr < x_min");
-    check((x_curr <= x_max), "x_curr > x_max");
+    hot_check((x_curr >= x_min), "x_curr < x_min");
+    hot_check((x_curr <= x_max), "x_curr > x_max");
 
     int x_delta = static_cast<int>(x_max) - static_cast<int>(x_min);
 
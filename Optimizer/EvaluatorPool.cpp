@@ -0,0 +1,115 @@
+#include "EvaluatorPool.h"
+
+#include <stdexcept>
+
+#include "SetupEvaluator.h"
+
+EvaluatorPool::EvaluatorPool(
+    EquipmentDb* equipment_db, RandomAffixes* random_affixes, SimSettings* sim_settings, const QString& setup_string, const int num_threads) {
+    const int pool_size = num_threads > 0 ? num_threads : 1;
+    for (int i = 0; i < pool_size; ++i)
+        threads.emplace_back(&EvaluatorPool::work, this, equipment_db, random_affixes, sim_settings, setup_string);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    work_done.wait(lock, [this, pool_size] { return threads_ready == pool_size; });
+}
+
+EvaluatorPool::~EvaluatorPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_available.notify_all();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+bool EvaluatorPool::successful() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return error.isEmpty();
+}
+
+QString EvaluatorPool::get_error() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return error;
+}
+
+int EvaluatorPool::get_num_threads() const {
+    return static_cast<int>(threads.size());
+}
+
+bool EvaluatorPool::run(const int num_tasks, const Task& task) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!error.isEmpty())
+        return false;
+    if (num_tasks <= 0)
+        return true;
+
+    this->task = &task;
+    this->num_tasks = num_tasks;
+    this->next_task = 0;
+    this->tasks_done = 0;
+    ++batch;
+    work_available.notify_all();
+
+    work_done.wait(lock, [this] { return tasks_done == this->num_tasks; });
+    this->task = nullptr;
+
+    return error.isEmpty();
+}
+
+void EvaluatorPool::work(EquipmentDb* equipment_db, RandomAffixes* random_affixes, SimSettings* sim_settings, const QString setup_string) {
+    SetupEvaluator* evaluator = nullptr;
+    try {
+        evaluator = new SetupEvaluator(equipment_db, random_affixes, sim_settings, setup_string);
+        if (!evaluator->successful())
+            set_error(evaluator->get_error());
+    } catch (const std::exception& e) {
+        set_error(QString("Failed to load setup: %1").arg(e.what()));
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    ++threads_ready;
+    work_done.notify_all();
+
+    unsigned finished_batch = 0;
+    while (true) {
+        work_available.wait(lock, [this, finished_batch] { return stopping || batch != finished_batch; });
+        if (stopping)
+            break;
+
+        finished_batch = batch;
+        while (next_task < num_tasks) {
+            const int task_index = next_task++;
+            const Task* current_task = task;
+            lock.unlock();
+
+            QString task_error;
+            if (evaluator == nullptr || !evaluator->successful())
+                task_error = "Evaluator failed to load setup";
+            else {
+                try {
+                    (*current_task)(*evaluator, task_index);
+                } catch (const std::exception& e) {
+                    task_error = e.what();
+                }
+            }
+
+            lock.lock();
+            if (!task_error.isEmpty() && error.isEmpty())
+                error = task_error;
+            if (++tasks_done == num_tasks)
+                work_done.notify_all();
+        }
+    }
+
+    lock.unlock();
+    delete evaluator;
+}
+
+void EvaluatorPool::set_error(const QString& error) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (this->error.isEmpty())
+        this->error = error;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <QString>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class EquipmentDb;
+class RandomAffixes;
+class SetupEvaluator;
+class SimSettings;
+
+// Worker threads that each own a SetupEvaluator loaded from the same setup string. A character must stay on the
+// thread that loaded it, so the threads live as long as the pool and pick up every batch of work given to run().
+class EvaluatorPool {
+public:
+    using Task = std::function<void(SetupEvaluator& evaluator, const int task_index)>;
+
+    EvaluatorPool(EquipmentDb* equipment_db, RandomAffixes* random_affixes, SimSettings* sim_settings, const QString& setup_string, const int num_threads);
+    ~EvaluatorPool();
+
+    bool successful() const;
+    QString get_error() const;
+    int get_num_threads() const;
+
+    // Calls task once for every index in [0, num_tasks) and returns when all calls are done. Threads claim one
+    // index at a time, so calls run concurrently and in no particular order, and a task may leave its evaluator's
+    // character in any state. Returns false if an evaluator failed to load or a call threw.
+    bool run(const int num_tasks, const Task& task);
+
+private:
+    std::vector<std::thread> threads;
+    mutable std::mutex mutex;
+    std::condition_variable work_available;
+    std::condition_variable work_done;
+
+    const Task* task {nullptr};
+    int num_tasks {0};
+    int next_task {0};
+    int tasks_done {0};
+    unsigned batch {0};
+    int threads_ready {0};
+    bool stopping {false};
+    QString error;
+
+    void work(EquipmentDb* equipment_db, RandomAffixes* random_affixes, SimSettings* sim_settings, const QString setup_string);
+    void set_error(const QString& error);
+};
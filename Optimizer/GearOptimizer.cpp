@@ -0,0 +1,552 @@
+#include "GearOptimizer.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "Character.h"
+#include "Equipment.h"
+#include "EquipmentDb.h"
+#include "EvaluatorPool.h"
+#include "Faction.h"
+#include "Item.h"
+#include "MagicSchools.h"
+#include "SetupEvaluator.h"
+#include "Stats.h"
+#include "Utils/Check.h"
+#include "Weapon.h"
+
+namespace {
+const int NO_ITEM = -1;
+
+int get_item_slot(const int equipment_slot) {
+    switch (equipment_slot) {
+    case EquipmentSlot::RING1:
+    case EquipmentSlot::RING2:
+        return ItemSlots::RING;
+    case EquipmentSlot::TRINKET1:
+    case EquipmentSlot::TRINKET2:
+        return ItemSlots::TRINKET;
+    default:
+        // The remaining equipment slots share their numbering with ItemSlots.
+        return equipment_slot;
+    }
+}
+
+// The other slot that can hold the same item, which must not be equipped twice.
+int get_paired_slot(const int equipment_slot) {
+    switch (equipment_slot) {
+    case EquipmentSlot::MAINHAND:
+        return EquipmentSlot::OFFHAND;
+    case EquipmentSlot::OFFHAND:
+        return EquipmentSlot::MAINHAND;
+    case EquipmentSlot::RING1:
+        return EquipmentSlot::RING2;
+    case EquipmentSlot::RING2:
+        return EquipmentSlot::RING1;
+    case EquipmentSlot::TRINKET1:
+        return EquipmentSlot::TRINKET2;
+    case EquipmentSlot::TRINKET2:
+        return EquipmentSlot::TRINKET1;
+    default:
+        return NO_ITEM;
+    }
+}
+
+Item* get_item(const Equipment* equipment, const int equipment_slot) {
+    switch (equipment_slot) {
+    case EquipmentSlot::MAINHAND:
+        return equipment->get_mainhand();
+    case EquipmentSlot::OFFHAND:
+        return equipment->get_offhand();
+    case EquipmentSlot::RANGED:
+        return equipment->get_ranged();
+    case EquipmentSlot::HEAD:
+        return equipment->get_head();
+    case EquipmentSlot::NECK:
+        return equipment->get_neck();
+    case EquipmentSlot::SHOULDERS:
+        return equipment->get_shoulders();
+    case EquipmentSlot::BACK:
+        return equipment->get_back();
+    case EquipmentSlot::CHEST:
+        return equipment->get_chest();
+    case EquipmentSlot::WRIST:
+        return equipment->get_wrist();
+    case EquipmentSlot::GLOVES:
+        return equipment->get_gloves();
+    case EquipmentSlot::BELT:
+        return equipment->get_belt();
+    case EquipmentSlot::LEGS:
+        return equipment->get_legs();
+    case EquipmentSlot::BOOTS:
+        return equipment->get_boots();
+    case EquipmentSlot::RING1:
+        return equipment->get_ring1();
+    case EquipmentSlot::RING2:
+        return equipment->get_ring2();
+    case EquipmentSlot::TRINKET1:
+        return equipment->get_trinket1();
+    case EquipmentSlot::TRINKET2:
+        return equipment->get_trinket2();
+    default:
+        check(false, "get_item reached end of switch");
+        return nullptr;
+    }
+}
+
+void set_item(Equipment* equipment, const int equipment_slot, const EquippedItem& item) {
+    switch (equipment_slot) {
+    case EquipmentSlot::MAINHAND:
+        equipment->set_mainhand(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::OFFHAND:
+        equipment->set_offhand(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::RANGED:
+        equipment->set_ranged(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::HEAD:
+        equipment->set_head(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::NECK:
+        equipment->set_neck(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::SHOULDERS:
+        equipment->set_shoulders(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::BACK:
+        equipment->set_back(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::CHEST:
+        equipment->set_chest(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::WRIST:
+        equipment->set_wrist(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::GLOVES:
+        equipment->set_gloves(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::BELT:
+        equipment->set_belt(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::LEGS:
+        equipment->set_legs(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::BOOTS:
+        equipment->set_boots(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::RING1:
+        equipment->set_ring1(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::RING2:
+        equipment->set_ring2(item.item_id, item.random_affix);
+        break;
+    case EquipmentSlot::TRINKET1:
+        equipment->set_trinket1(item.item_id);
+        break;
+    case EquipmentSlot::TRINKET2:
+        equipment->set_trinket2(item.item_id);
+        break;
+    default:
+        check(false, "set_item reached end of switch");
+    }
+}
+
+void clear_item(Equipment* equipment, const int equipment_slot) {
+    switch (equipment_slot) {
+    case EquipmentSlot::MAINHAND:
+        equipment->clear_mainhand();
+        break;
+    case EquipmentSlot::OFFHAND:
+        equipment->clear_offhand();
+        break;
+    case EquipmentSlot::RANGED:
+        equipment->clear_ranged();
+        break;
+    case EquipmentSlot::HEAD:
+        equipment->clear_head();
+        break;
+    case EquipmentSlot::NECK:
+        equipment->clear_neck();
+        break;
+    case EquipmentSlot::SHOULDERS:
+        equipment->clear_shoulders();
+        break;
+    case EquipmentSlot::BACK:
+        equipment->clear_back();
+        break;
+    case EquipmentSlot::CHEST:
+        equipment->clear_chest();
+        break;
+    case EquipmentSlot::WRIST:
+        equipment->clear_wrist();
+        break;
+    case EquipmentSlot::GLOVES:
+        equipment->clear_gloves();
+        break;
+    case EquipmentSlot::BELT:
+        equipment->clear_belt();
+        break;
+    case EquipmentSlot::LEGS:
+        equipment->clear_legs();
+        break;
+    case EquipmentSlot::BOOTS:
+        equipment->clear_boots();
+        break;
+    case EquipmentSlot::RING1:
+        equipment->clear_ring1();
+        break;
+    case EquipmentSlot::RING2:
+        equipment->clear_ring2();
+        break;
+    case EquipmentSlot::TRINKET1:
+        equipment->clear_trinket1();
+        break;
+    case EquipmentSlot::TRINKET2:
+        equipment->clear_trinket2();
+        break;
+    default:
+        check(false, "clear_item reached end of switch");
+    }
+}
+
+bool can_use_item(const Character* pchar, const int equipment_slot, const Item* item) {
+    if (!item->available_for_faction(static_cast<AvailableFactions::Name>(pchar->get_faction()->get_faction())))
+        return false;
+
+    if (!item->available_for_class(pchar->class_name))
+        return false;
+
+    // Items that only exist with a random affix have no fixed stats to equip them with.
+    if (item->can_have_random_affix())
+        return false;
+
+    switch (equipment_slot) {
+    case EquipmentSlot::MAINHAND:
+    case EquipmentSlot::OFFHAND:
+    case EquipmentSlot::RANGED:
+        return pchar->get_weapon_proficiencies_for_slot(equipment_slot).contains(item->get_item_type());
+    default:
+        if (item->get_item_type() >= ArmorTypes::CLOTH && item->get_item_type() <= ArmorTypes::PLATE)
+            return item->get_item_type() <= pchar->get_highest_possible_armor_type();
+        return true;
+    }
+}
+
+// The number of SimOption increments (as applied by SimControl::add_option) found in the given stats.
+double get_option_increments(const Stats* stats, const SimOption::Name option) {
+    switch (option) {
+    case SimOption::Name::NoScale:
+        return 0.0;
+    case SimOption::Name::ScaleAgility:
+        return stats->get_agility() / 10.0;
+    case SimOption::Name::ScaleStrength:
+        return stats->get_strength() / 10.0;
+    case SimOption::Name::ScaleHitChance:
+        return std::max(stats->get_melee_hit_chance(), stats->get_ranged_hit_chance()) / 100.0;
+    case SimOption::Name::ScaleCritChance:
+        return std::max(stats->get_melee_crit_chance(), stats->get_ranged_crit_chance()) / 100.0;
+    case SimOption::Name::ScaleAttackPower:
+        return std::max(stats->get_base_melee_ap(), stats->get_base_ranged_ap()) / 10.0;
+    case SimOption::Name::ScaleAxeSkill:
+        return stats->get_axe_skill();
+    case SimOption::Name::ScaleDaggerSkill:
+        return stats->get_dagger_skill();
+    case SimOption::Name::ScaleMaceSkill:
+        return stats->get_mace_skill();
+    case SimOption::Name::ScaleSwordSkill:
+        return stats->get_sword_skill();
+    case SimOption::Name::ScaleIntellect:
+        return stats->get_intellect() / 10.0;
+    case SimOption::Name::ScaleSpirit:
+        return stats->get_spirit() / 10.0;
+    case SimOption::Name::ScaleMp5:
+        return stats->get_mp5() / 10.0;
+    case SimOption::Name::ScaleSpellDamage:
+        return stats->get_base_spell_damage() / 10.0;
+    case SimOption::Name::ScaleSpellCritChance:
+        return stats->get_spell_crit_chance(MagicSchool::Arcane) / 100.0;
+    case SimOption::Name::ScaleSpellHitChance:
+        return stats->get_spell_hit_chance(MagicSchool::Arcane) / 100.0;
+    case SimOption::Name::ScaleSpellPenetration:
+        return stats->get_spell_penetration(MagicSchool::Arcane) / 10.0;
+    }
+
+    return 0.0;
+}
+
+void append_best(QVector<Item*>& kept, QVector<Item*> items, const int num_items, const std::function<double(const Item*)>& value) {
+    std::stable_sort(items.begin(), items.end(), [&value](const Item* lhs, const Item* rhs) { return value(lhs) > value(rhs); });
+
+    for (int i = 0; i < items.size() && i < num_items; ++i) {
+        if (!kept.contains(items[i]))
+            kept.append(items[i]);
+    }
+}
+} // namespace
+
+GearOptimizer::GearOptimizer(EquipmentDb* equipment_db, EvaluatorPool* pool) : equipment_db(equipment_db), pool(pool) {}
+
+void GearOptimizer::set_candidates(const int equipment_slot, const QVector<int>& item_ids) {
+    check((equipment_slot >= 0 && equipment_slot < NUM_SLOTS), "Gear optimizer candidates given for unsupported slot");
+
+    candidate_ids[equipment_slot] = item_ids;
+}
+
+void GearOptimizer::set_stat_weights(const QMap<SimOption::Name, double>& dps_per_option) {
+    this->stat_weights = dps_per_option;
+}
+
+void GearOptimizer::set_candidates_per_slot(const int candidates_per_slot) {
+    this->candidates_per_slot = candidates_per_slot;
+}
+
+void GearOptimizer::set_iterations(const int iterations) {
+    this->iterations = iterations;
+}
+
+void GearOptimizer::set_verify_iterations(const int verify_iterations) {
+    this->verify_iterations = verify_iterations;
+}
+
+void GearOptimizer::set_max_rounds(const int max_rounds) {
+    this->max_rounds = max_rounds;
+}
+
+double GearOptimizer::get_weighted_score(const Item* item) const {
+    double score = 0.0;
+
+    QMap<SimOption::Name, double>::const_iterator it = stat_weights.constBegin();
+    while (it != stat_weights.constEnd()) {
+        score += it.value() * get_option_increments(item->get_stats(), it.key());
+        ++it;
+    }
+
+    return score;
+}
+
+GearSet GearOptimizer::get_gear(const Equipment* equipment) {
+    GearSet gear(NUM_SLOTS);
+
+    for (int slot = 0; slot < NUM_SLOTS; ++slot) {
+        const Item* item = get_item(equipment, slot);
+        if (item != nullptr)
+            gear[slot] = {item->item_id, item->get_random_affix()};
+    }
+
+    return gear;
+}
+
+void GearOptimizer::equip_gear(Equipment* equipment, const GearSet& gear) {
+    // Slots are set in order, so a mainhand is in place before the offhand it may have cleared is set again.
+    for (int slot = 0; slot < NUM_SLOTS; ++slot) {
+        const Item* current = get_item(equipment, slot);
+        const EquippedItem current_item = current != nullptr ? EquippedItem {current->item_id, current->get_random_affix()} : EquippedItem();
+        if (current_item == gear[slot])
+            continue;
+
+        if (gear[slot].item_id == NO_ITEM)
+            clear_item(equipment, slot);
+        else
+            set_item(equipment, slot, gear[slot]);
+    }
+}
+
+GearOptimizerResult GearOptimizer::run() {
+    GearOptimizerResult result;
+
+    GearSet base_gear;
+    QVector<QVector<Item*>> candidates;
+    QMap<int, double> base_dps;
+
+    auto prepare = [&](SetupEvaluator& evaluator, const int) {
+        base_gear = get_gear(evaluator.get_character()->get_equipment());
+        candidates = get_usable_items(evaluator.get_character());
+        base_dps = evaluator.get_dps_per_iteration(verify_iterations);
+    };
+
+    if (!pool->run(1, prepare)) {
+        result.error = pool->get_error();
+        return result;
+    }
+
+    for (auto& slot_candidates : candidates)
+        slot_candidates = prune(slot_candidates);
+
+    GearSet gear = base_gear;
+    double dps = SetupEvaluator::get_mean_dps(base_dps);
+    result.evaluations = 1;
+
+    while (result.rounds < max_rounds) {
+        const QVector<GearSet> neighbours = get_neighbours(gear, candidates);
+        if (neighbours.empty())
+            break;
+
+        QVector<double> neighbour_dps(neighbours.size());
+        QVector<GearSet> equipped_gear(neighbours.size());
+        // Each task writes its own element, so the vectors must not detach while the tasks run.
+        double* dps_results = neighbour_dps.data();
+        GearSet* gear_results = equipped_gear.data();
+
+        auto evaluate = [&](SetupEvaluator& evaluator, const int index) {
+            Equipment* equipment = evaluator.get_character()->get_equipment();
+            equip_gear(equipment, neighbours[index]);
+            gear_results[index] = get_gear(equipment);
+            dps_results[index] = evaluator.get_dps(iterations);
+        };
+
+        if (!pool->run(neighbours.size(), evaluate)) {
+            result.error = pool->get_error();
+            return result;
+        }
+
+        ++result.rounds;
+        result.evaluations += neighbours.size();
+
+        // The highest of many noisy estimates overstates its DPS. The best swap is simulated again together with the
+        // current gear, with more iterations, and only kept if it still comes out ahead.
+        const int best = static_cast<int>(std::max_element(neighbour_dps.constBegin(), neighbour_dps.constEnd()) - neighbour_dps.constBegin());
+        const QVector<GearSet> verified_gear = {gear, equipped_gear[best]};
+        QVector<QMap<int, double>> verified_dps(verified_gear.size());
+        QMap<int, double>* verified_results = verified_dps.data();
+
+        auto verify = [&](SetupEvaluator& evaluator, const int index) {
+            equip_gear(evaluator.get_character()->get_equipment(), verified_gear[index]);
+            verified_results[index] = evaluator.get_dps_per_iteration(verify_iterations);
+        };
+
+        if (!pool->run(verified_gear.size(), verify)) {
+            result.error = pool->get_error();
+            return result;
+        }
+
+        result.evaluations += verified_gear.size();
+
+        if (!SetupEvaluator::is_improvement(verified_dps[0], verified_dps[1]))
+            break;
+
+        gear = equipped_gear[best];
+        dps = SetupEvaluator::get_mean_dps(verified_dps[1]);
+    }
+
+    auto encode = [&](SetupEvaluator& evaluator, const int) {
+        equip_gear(evaluator.get_character()->get_equipment(), gear);
+        result.best_setup_string = evaluator.get_current_setup_string();
+    };
+
+    if (!pool->run(1, encode)) {
+        result.error = pool->get_error();
+        return result;
+    }
+
+    for (int slot = 0; slot < NUM_SLOTS; ++slot) {
+        if (gear[slot] != base_gear[slot])
+            result.swaps.append({slot, gear[slot].item_id});
+    }
+
+    result.success = true;
+    result.base_dps = SetupEvaluator::get_mean_dps(base_dps);
+    result.best_dps = dps;
+
+    return result;
+}
+
+QVector<QVector<Item*>> GearOptimizer::get_usable_items(const Character* pchar) const {
+    QVector<QVector<Item*>> items(NUM_SLOTS);
+
+    for (int slot = 0; slot < NUM_SLOTS; ++slot) {
+        if (!candidate_ids.empty() && !candidate_ids.contains(slot))
+            continue;
+
+        for (const auto& item : equipment_db->get_slot_items(get_item_slot(slot))) {
+            if (!candidate_ids.empty() && !candidate_ids[slot].contains(item->item_id))
+                continue;
+
+            if (can_use_item(pchar, slot, item))
+                items[slot].append(item);
+        }
+    }
+
+    return items;
+}
+
+QVector<Item*> GearOptimizer::prune(const QVector<Item*>& items) const {
+    if (stat_weights.empty())
+        return items;
+
+    QVector<Item*> set_items;
+    QVector<Item*> weapons;
+    for (const auto& item : items) {
+        if (equipment_db->get_possible_set_items().contains(item->item_id))
+            set_items.append(item);
+        if (dynamic_cast<const Weapon*>(item) != nullptr)
+            weapons.append(item);
+    }
+
+    auto weighted_score = [this](const Item* item) { return get_weighted_score(item); };
+    auto weapon_dps = [](const Item* item) { return static_cast<const Weapon*>(item)->get_wpn_dps(); };
+
+    QVector<Item*> kept;
+    append_best(kept, items, candidates_per_slot, weighted_score);
+    append_best(kept, weapons, candidates_per_slot, weapon_dps);
+    append_best(kept, set_items, candidates_per_slot, weighted_score);
+
+    return kept;
+}
+
+QVector<GearSet> GearOptimizer::get_neighbours(const GearSet& gear, const QVector<QVector<Item*>>& candidates) const {
+    QVector<GearSet> neighbours;
+
+    for (int slot = 0; slot < NUM_SLOTS; ++slot) {
+        const int paired_slot = get_paired_slot(slot);
+
+        for (const auto& item : candidates[slot]) {
+            if (gear[slot].item_id == item->item_id)
+                continue;
+            if (paired_slot != NO_ITEM && gear[paired_slot].item_id == item->item_id)
+                continue;
+
+            GearSet neighbour = gear;
+            neighbour[slot] = {item->item_id, nullptr};
+            neighbours.append(neighbour);
+        }
+    }
+
+    // Set bonuses make pieces worth more together than one at a time, which single swaps never find. For every
+    // set, also try its best candidate piece (candidates are ordered by score) in every slot it has candidates for.
+    const QMap<int, QString>& set_items = equipment_db->get_possible_set_items();
+    QMap<QString, GearSet> set_neighbours;
+    QMap<QString, int> set_swaps;
+
+    for (int slot = 0; slot < NUM_SLOTS; ++slot) {
+        for (const auto& item : candidates[slot]) {
+            if (!set_items.contains(item->item_id))
+                continue;
+
+            const QString& set_name = set_items[item->item_id];
+            if (!set_neighbours.contains(set_name))
+                set_neighbours[set_name] = gear;
+
+            GearSet& neighbour = set_neighbours[set_name];
+            if (set_items.value(neighbour[slot].item_id) == set_name)
+                continue;
+
+            const int paired_slot = get_paired_slot(slot);
+            if (paired_slot != NO_ITEM && neighbour[paired_slot].item_id == item->item_id)
+                continue;
+
+            neighbour[slot] = {item->item_id, nullptr};
+            ++set_swaps[set_name];
+        }
+    }
+
+    QMap<QString, GearSet>::const_iterator it = set_neighbours.constBegin();
+    while (it != set_neighbours.constEnd()) {
+        // A single swap is already among the neighbours above.
+        if (set_swaps.value(it.key()) > 1)
+            neighbours.append(it.value());
+        ++it;
+    }
+
+    return neighbours;
+}
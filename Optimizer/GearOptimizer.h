@@ -0,0 +1,95 @@
+#pragma once
+
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+#include "ItemNamespace.h"
+#include "SimOption.h"
+
+class Character;
+class Equipment;
+class EquipmentDb;
+class EvaluatorPool;
+class Item;
+class RandomAffix;
+
+struct EquippedItem {
+    int item_id {-1};
+    RandomAffix* random_affix {nullptr};
+
+    bool operator==(const EquippedItem& rhs) const {
+        return item_id == rhs.item_id && random_affix == rhs.random_affix;
+    }
+    bool operator!=(const EquippedItem& rhs) const {
+        return !(*this == rhs);
+    }
+};
+
+// The items in EquipmentSlot::MAINHAND through EquipmentSlot::TRINKET2, indexed by equipment slot.
+using GearSet = QVector<EquippedItem>;
+
+struct GearSwap {
+    int equipment_slot;
+    // -1 if the slot ends up empty, e.g. an offhand replaced by a two-hander.
+    int item_id;
+};
+
+struct GearOptimizerResult {
+    bool success {false};
+    QString error;
+    double base_dps {0.0};
+    double best_dps {0.0};
+    QString best_setup_string;
+    QVector<GearSwap> swaps;
+    int rounds {0};
+    int evaluations {0};
+};
+
+// Hill climbs from the gear of the setup loaded in the EvaluatorPool towards the gear with the highest DPS.
+//
+// Each slot draws candidates from EquipmentDb::get_slot_items (or the item ids given with set_candidates), limited
+// to items the character can use. With stat weights set, a slot keeps its candidates_per_slot best items by weighted
+// stats (and by weapon DPS in weapon slots), plus as many of its best set items, since set bonuses do not show up in
+// item stats. Every round simulates all single slot swaps from the current gear, plus one swap per item set that
+// equips its candidate pieces together, on the pool's threads. The best swap and the current gear are then simulated
+// again with verify_iterations, and the swap is kept if the mean of their paired per-iteration DPS difference exceeds
+// its standard error, otherwise the search stops. The reported DPS come from these verifying sims. Evaluators change
+// gear by equipping the difference to each candidate gear set.
+class GearOptimizer {
+public:
+    GearOptimizer(EquipmentDb* equipment_db, EvaluatorPool* pool);
+
+    // Restricts the search to the slots given candidates. All slots are searched when no candidates are set.
+    void set_candidates(const int equipment_slot, const QVector<int>& item_ids);
+    // DPS gained per option increment, i.e. the absolute values of the NumberCruncher's DPS ScaleResults.
+    void set_stat_weights(const QMap<SimOption::Name, double>& dps_per_option);
+    void set_candidates_per_slot(const int candidates_per_slot);
+    void set_iterations(const int iterations);
+    void set_verify_iterations(const int verify_iterations);
+    void set_max_rounds(const int max_rounds);
+
+    GearOptimizerResult run();
+
+    double get_weighted_score(const Item* item) const;
+
+    static GearSet get_gear(const Equipment* equipment);
+    static void equip_gear(Equipment* equipment, const GearSet& gear);
+
+    static const int NUM_SLOTS = EquipmentSlot::TRINKET2 + 1;
+
+private:
+    EquipmentDb* equipment_db;
+    EvaluatorPool* pool;
+
+    QMap<int, QVector<int>> candidate_ids;
+    QMap<SimOption::Name, double> stat_weights;
+    int candidates_per_slot {5};
+    int iterations {1000};
+    int verify_iterations {4000};
+    int max_rounds {10};
+
+    QVector<QVector<Item*>> get_usable_items(const Character* pchar) const;
+    QVector<Item*> prune(const QVector<Item*>& items) const;
+    QVector<GearSet> get_neighbours(const GearSet& gear, const QVector<QVector<Item*>>& candidates) const;
+};
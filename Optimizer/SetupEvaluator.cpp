@@ -0,0 +1,104 @@
+#include "SetupEvaluator.h"
+
+#include "Character.h"
+#include "CharacterDecoder.h"
+#include "CharacterEncoder.h"
+#include "CharacterLoader.h"
+#include "NumberCruncher.h"
+#include "Race.h"
+#include "RaidControl.h"
+#include "RunningStatistics.h"
+#include "SimControl.h"
+#include "SimSettings.h"
+
+SetupEvaluator::SetupEvaluator(EquipmentDb* equipment_db, RandomAffixes* random_affixes, SimSettings* global_sim_settings, const QString& setup_string) :
+    sim_settings(new SimSettings()), raid_control(nullptr), number_cruncher(new NumberCruncher()) {
+    CharacterDecoder decoder(setup_string);
+
+    sim_settings->set_phase(Content::get_phase(decoder.get_value("PHASE").toInt()));
+    sim_settings->set_combat_length(global_sim_settings->get_combat_length());
+    sim_settings->set_common_random_numbers(true);
+    sim_settings->set_fast_forward_pet_swings(global_sim_settings->get_fast_forward_pet_swings());
+
+    raid_control = new RaidControl(sim_settings);
+
+    CharacterLoader loader(equipment_db, random_affixes, sim_settings, raid_control, decoder);
+    Character* loaded = loader.initialize_new();
+
+    if (!loader.successful()) {
+        error = loader.get_error();
+        delete loaded;
+        return;
+    }
+
+    pchar = loaded;
+    race = loader.relinquish_ownership_of_race();
+}
+
+SetupEvaluator::~SetupEvaluator() {
+    delete pchar;
+    delete race;
+    delete raid_control;
+    delete number_cruncher;
+    delete sim_settings;
+}
+
+bool SetupEvaluator::successful() const {
+    return pchar != nullptr;
+}
+
+QString SetupEvaluator::get_error() const {
+    return error;
+}
+
+Character* SetupEvaluator::get_character() const {
+    return pchar;
+}
+
+QString SetupEvaluator::get_current_setup_string() const {
+    return CharacterEncoder(pchar).get_current_setup_string();
+}
+
+double SetupEvaluator::get_dps(const int iterations) {
+    sim_settings->set_combat_iterations_quick_sim(iterations);
+
+    SimControl sim_control(sim_settings, number_cruncher);
+    sim_control.run_quick_sim({pchar}, raid_control);
+
+    const double dps = number_cruncher->get_personal_dps(SimOption::Name::NoScale);
+    number_cruncher->reset();
+
+    return dps;
+}
+
+QMap<int, double> SetupEvaluator::get_dps_per_iteration(const int iterations) {
+    sim_settings->set_combat_iterations_quick_sim(iterations);
+
+    SimControl sim_control(sim_settings, number_cruncher);
+    sim_control.run_quick_sim({pchar}, raid_control);
+
+    const QMap<int, double> dps_per_iteration = number_cruncher->get_personal_dps_per_iteration(SimOption::Name::NoScale);
+    number_cruncher->reset();
+
+    return dps_per_iteration;
+}
+
+double SetupEvaluator::get_mean_dps(const QMap<int, double>& dps_per_iteration) {
+    RunningStatistics dps;
+    for (const auto& iteration_dps : dps_per_iteration)
+        dps.add(iteration_dps);
+
+    return dps.get_mean();
+}
+
+bool SetupEvaluator::is_improvement(const QMap<int, double>& current_dps, const QMap<int, double>& candidate_dps) {
+    RunningStatistics paired_difference;
+    QMap<int, double>::const_iterator it = candidate_dps.constBegin();
+    while (it != candidate_dps.constEnd()) {
+        if (current_dps.contains(it.key()))
+            paired_difference.add(it.value() - current_dps[it.key()]);
+        ++it;
+    }
+
+    return paired_difference.get_count() > 1 && paired_difference.get_mean() > paired_difference.get_confidence_interval(1.0);
+}
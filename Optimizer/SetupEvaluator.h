@@ -0,0 +1,49 @@
+#pragma once
+
+#include <QMap>
+#include <QString>
+
+class Character;
+class EquipmentDb;
+class NumberCruncher;
+class Race;
+class RaidControl;
+class RandomAffixes;
+class SimSettings;
+
+// A character loaded once from a setup string and quick simmed repeatedly, changing the character in between
+// (equipping items, moving talent points) rather than loading it again for every candidate setup.
+//
+// Sims always use common random numbers. The generators of equipped items, their enchants and set bonuses are
+// keyed by the slot they were equipped in (see RandomStreamScope), so equipping an item only changes the streams
+// of that slot and two evaluations with the same number of iterations are paired iteration by iteration. Random
+// generators are bound to the thread that created them: an evaluator must be created, used and destroyed on one
+// thread.
+class SetupEvaluator {
+public:
+    SetupEvaluator(EquipmentDb* equipment_db, RandomAffixes* random_affixes, SimSettings* global_sim_settings, const QString& setup_string);
+    ~SetupEvaluator();
+
+    bool successful() const;
+    QString get_error() const;
+
+    Character* get_character() const;
+    QString get_current_setup_string() const;
+
+    double get_dps(const int iterations);
+    // The DPS of every iteration keyed by iteration number, for paired comparisons between evaluations.
+    QMap<int, double> get_dps_per_iteration(const int iterations);
+
+    static double get_mean_dps(const QMap<int, double>& dps_per_iteration);
+    // Whether the candidate's DPS exceeds the current DPS by more than the standard error of their difference,
+    // pairing the iterations both evaluations simulated with the same random numbers.
+    static bool is_improvement(const QMap<int, double>& current_dps, const QMap<int, double>& candidate_dps);
+
+private:
+    SimSettings* sim_settings;
+    RaidControl* raid_control;
+    NumberCruncher* number_cruncher;
+    Character* pchar {nullptr};
+    Race* race {nullptr};
+    QString error;
+};
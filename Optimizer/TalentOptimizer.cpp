@@ -0,0 +1,268 @@
+#include "TalentOptimizer.h"
+
+#include <algorithm>
+
+#include "Character.h"
+#include "CharacterSpells.h"
+#include "CharacterTalents.h"
+#include "EvaluatorPool.h"
+#include "SetupEvaluator.h"
+#include "Utils/Check.h"
+
+namespace {
+const QVector<QString> TREE_POSITIONS = {"LEFT", "MID", "RIGHT"};
+const QVector<QString> TALENT_SUFFIXES = {"LL", "ML", "MR", "RR"};
+const int NUM_TIERS = 7;
+
+// Every talent in the trees, ordered by tree, tier and column. Parents thereby come before their children, as
+// children are placed below or to the right of their parent.
+QVector<QPair<QString, QString>> get_talent_positions(const CharacterTalents* talents) {
+    QVector<QPair<QString, QString>> positions;
+
+    for (const auto& tree_position : TREE_POSITIONS) {
+        for (int tier = 1; tier <= NUM_TIERS; ++tier) {
+            for (const auto& suffix : TALENT_SUFFIXES) {
+                const QString talent_position = QString("%1%2").arg(QString::number(tier), suffix);
+                if (talents->get_max_rank(tree_position, talent_position).toInt() > 0)
+                    positions.append({tree_position, talent_position});
+            }
+        }
+    }
+
+    return positions;
+}
+} // namespace
+
+TalentOptimizer::TalentOptimizer(EvaluatorPool* pool) : pool(pool) {}
+
+void TalentOptimizer::set_iterations(const int iterations) {
+    this->iterations = iterations;
+}
+
+void TalentOptimizer::set_max_iterations(const int max_iterations) {
+    this->max_iterations = max_iterations;
+}
+
+void TalentOptimizer::set_max_rounds(const int max_rounds) {
+    this->max_rounds = max_rounds;
+}
+
+TalentBuild TalentOptimizer::get_build(const CharacterTalents* talents) {
+    TalentBuild build;
+
+    for (const auto& position : get_talent_positions(talents)) {
+        const int rank = talents->get_rank(position.first, position.second).toInt();
+        if (rank > 0)
+            build[position] = rank;
+    }
+
+    return build;
+}
+
+bool TalentOptimizer::apply_build(Character* pchar, const TalentBuild& build) {
+    CharacterTalents* talents = pchar->get_talents();
+    for (const auto& tree_position : TREE_POSITIONS)
+        talents->clear_tree(tree_position);
+
+    bool valid = true;
+    for (const auto& position : get_talent_positions(talents)) {
+        for (int rank = 0; rank < build.value(position, 0); ++rank)
+            valid = talents->increment_rank(position.first, position.second) && valid;
+    }
+
+    // Talents enable and disable spells, which the rotation only picks up when it is linked again.
+    pchar->get_spells()->relink_spells();
+
+    return valid;
+}
+
+QVector<TalentBuild> TalentOptimizer::get_neighbours(CharacterTalents* talents) {
+    const QVector<QPair<QString, QString>> positions = get_talent_positions(talents);
+    QVector<TalentBuild> neighbours;
+
+    // Points are moved and taken back one at a time, so CharacterTalents decides which moves the trees allow.
+    auto add_neighbours_with_one_more_point = [&](const QPair<QString, QString>& skipped) {
+        for (const auto& position : positions) {
+            if (position == skipped || !talents->increment_rank(position.first, position.second))
+                continue;
+
+            neighbours.append(get_build(talents));
+            const bool reverted = talents->decrement_rank(position.first, position.second);
+            check(reverted, "Failed to take back talent point moved by the talent optimizer");
+        }
+    };
+
+    if (talents->has_talent_points_remaining())
+        add_neighbours_with_one_more_point({});
+
+    for (const auto& position : positions) {
+        if (!talents->decrement_rank(position.first, position.second))
+            continue;
+
+        add_neighbours_with_one_more_point(position);
+
+        const bool reverted = talents->increment_rank(position.first, position.second);
+        check(reverted, "Failed to take back talent point removed by the talent optimizer");
+    }
+
+    return neighbours;
+}
+
+TalentOptimizerResult TalentOptimizer::run() {
+    TalentOptimizerResult result;
+
+    TalentBuild base_build;
+    QMap<int, double> base_dps;
+
+    auto prepare = [&](SetupEvaluator& evaluator, const int) {
+        base_build = get_build(evaluator.get_character()->get_talents());
+        base_dps = evaluator.get_dps_per_iteration(max_iterations);
+    };
+
+    if (!pool->run(1, prepare)) {
+        result.error = pool->get_error();
+        return result;
+    }
+
+    TalentBuild build = base_build;
+    QMap<int, double> dps = base_dps;
+    result.evaluations = 1;
+
+    while (result.rounds < max_rounds) {
+        QVector<TalentBuild> candidates = {build};
+
+        auto find_neighbours = [&](SetupEvaluator& evaluator, const int) {
+            const bool applied = apply_build(evaluator.get_character(), build);
+            check(applied, "Talent optimizer reached a build that breaks talent tree rules");
+            candidates.append(get_neighbours(evaluator.get_character()->get_talents()));
+        };
+
+        if (!pool->run(1, find_neighbours)) {
+            result.error = pool->get_error();
+            return result;
+        }
+
+        ++result.rounds;
+
+        auto evaluate_candidates = [&](const QVector<int>& indices, const int stage_iterations, QVector<double>& candidate_dps) {
+            return evaluate(candidates, indices, stage_iterations, candidate_dps);
+        };
+        auto evaluate_candidates_per_iteration = [&](const QVector<int>& indices, const int stage_iterations,
+                                                     QVector<QMap<int, double>>& candidate_dps) {
+            return evaluate_per_iteration(candidates, indices, stage_iterations, candidate_dps);
+        };
+
+        QMap<int, double> next_dps;
+        const int next = select_next_build(candidates.size(), evaluate_candidates, evaluate_candidates_per_iteration, next_dps, result.evaluations);
+        if (next == -1) {
+            result.error = pool->get_error();
+            return result;
+        }
+        if (next == 0)
+            break;
+
+        build = candidates[next];
+        dps = next_dps;
+    }
+
+    // Every move beat the build before it, which does not quite guarantee that the last build beats the first.
+    if (SetupEvaluator::get_mean_dps(dps) < SetupEvaluator::get_mean_dps(base_dps)) {
+        build = base_build;
+        dps = base_dps;
+    }
+
+    auto encode = [&](SetupEvaluator& evaluator, const int) {
+        apply_build(evaluator.get_character(), build);
+        result.best_setup_string = evaluator.get_current_setup_string();
+    };
+
+    if (!pool->run(1, encode)) {
+        result.error = pool->get_error();
+        return result;
+    }
+
+    result.success = true;
+    result.base_dps = SetupEvaluator::get_mean_dps(base_dps);
+    result.best_dps = SetupEvaluator::get_mean_dps(dps);
+    result.best_build = build;
+
+    return result;
+}
+
+int TalentOptimizer::select_by_successive_halving(const int num_builds, const Evaluation& evaluate, int& evaluations) const {
+    QVector<int> remaining;
+    for (int i = 0; i < num_builds; ++i)
+        remaining.append(i);
+
+    QVector<double> dps(num_builds);
+    int stage_iterations = std::min(iterations, max_iterations);
+
+    while (remaining.size() > 1) {
+        if (!evaluate(remaining, stage_iterations, dps))
+            return -1;
+
+        evaluations += remaining.size();
+
+        // Ties keep the earlier build, so the current build (index 0) is only replaced by a better one.
+        std::stable_sort(remaining.begin(), remaining.end(), [&dps](const int lhs, const int rhs) { return dps[lhs] > dps[rhs]; });
+        remaining.resize((remaining.size() + 1) / 2);
+
+        stage_iterations = std::min(stage_iterations * 2, max_iterations);
+    }
+
+    return remaining.first();
+}
+
+int TalentOptimizer::select_next_build(const int num_builds,
+                                       const Evaluation& evaluate,
+                                       const PerIterationEvaluation& evaluate_per_iteration,
+                                       QMap<int, double>& next_dps,
+                                       int& evaluations) const {
+    const int best = select_by_successive_halving(num_builds, evaluate, evaluations);
+    if (best <= 0)
+        return best;
+
+    // The last halving may have been decided with few iterations, where noise can put a worse build ahead.
+    QVector<QMap<int, double>> dps(num_builds);
+    if (!evaluate_per_iteration({0, best}, max_iterations, dps))
+        return -1;
+
+    evaluations += 2;
+
+    if (!SetupEvaluator::is_improvement(dps[0], dps[best]))
+        return 0;
+
+    next_dps = dps[best];
+    return best;
+}
+
+bool TalentOptimizer::evaluate(const QVector<TalentBuild>& builds, const QVector<int>& indices, const int stage_iterations, QVector<double>& dps) {
+    // Each task writes its own element, so the vector must not detach while the tasks run.
+    double* dps_results = dps.data();
+
+    auto evaluate_build = [&](SetupEvaluator& evaluator, const int task_index) {
+        const int index = indices[task_index];
+        const bool applied = apply_build(evaluator.get_character(), builds[index]);
+        check(applied, "Talent optimizer evaluated a build that breaks talent tree rules");
+        dps_results[index] = evaluator.get_dps(stage_iterations);
+    };
+
+    return pool->run(indices.size(), evaluate_build);
+}
+
+bool TalentOptimizer::evaluate_per_iteration(const QVector<TalentBuild>& builds,
+                                             const QVector<int>& indices,
+                                             const int stage_iterations,
+                                             QVector<QMap<int, double>>& dps_per_iteration) {
+    // Each task writes its own element, so the vector must not detach while the tasks run.
+    QMap<int, double>* dps_results = dps_per_iteration.data();
+
+    auto evaluate_build = [&](SetupEvaluator& evaluator, const int task_index) {
+        const int index = indices[task_index];
+        const bool applied = apply_build(evaluator.get_character(), builds[index]);
+        check(applied, "Talent optimizer evaluated a build that breaks talent tree rules");
+        dps_results[index] = evaluator.get_dps_per_iteration(stage_iterations);
+    };
+
+    return pool->run(indices.size(), evaluate_build);
+}
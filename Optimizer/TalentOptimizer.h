@@ -0,0 +1,87 @@
+#pragma once
+
+#include <QMap>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+class Character;
+class CharacterTalents;
+class EvaluatorPool;
+
+// Talent ranks by tree position ("LEFT", "MID" or "RIGHT") and talent position (e.g. "3ML"). Talents without
+// points are left out.
+using TalentBuild = QMap<QPair<QString, QString>, int>;
+
+struct TalentOptimizerResult {
+    bool success {false};
+    QString error;
+    double base_dps {0.0};
+    double best_dps {0.0};
+    QString best_setup_string;
+    TalentBuild best_build;
+    int rounds {0};
+    int evaluations {0};
+};
+
+// Hill climbs from the talents of the setup loaded in the EvaluatorPool towards the build with the highest DPS.
+//
+// Every round considers the builds one point away from the current build: a point moved from one talent to
+// another in any tree, or an unspent point invested, as far as the talent trees allow it. These builds are
+// narrowed down by successive halving: all of them are simulated with a few iterations, the better half is
+// simulated again with twice the iterations, and so on until one build is left. The current build competes as
+// well. Early stages use few iterations, so the winner is then simulated again together with the current build
+// with max_iterations and only replaces it if the mean of their paired per-iteration DPS difference exceeds its
+// standard error. The search stops once the current build wins or holds its place. Evaluators change talents on
+// their loaded character rather than loading each build.
+class TalentOptimizer {
+public:
+    TalentOptimizer(EvaluatorPool* pool);
+
+    // Iterations every build is first simulated with.
+    void set_iterations(const int iterations);
+    // Iterations are doubled with every halving, but not beyond this. Moves are confirmed and base and best DPS
+    // are reported at this count.
+    void set_max_iterations(const int max_iterations);
+    void set_max_rounds(const int max_rounds);
+
+    TalentOptimizerResult run();
+
+    // Fills dps for the build indices given, simulated with the given iterations. Returns false on failure.
+    using Evaluation = std::function<bool(const QVector<int>& indices, const int iterations, QVector<double>& dps)>;
+    // Narrows num_builds builds down to one by successive halving and returns its index, or -1 if an evaluation
+    // failed. A tie is won by the build that was ahead before, so build 0 only loses to a better build. Every
+    // simulated build is counted in evaluations.
+    int select_by_successive_halving(const int num_builds, const Evaluation& evaluate, int& evaluations) const;
+
+    // Fills dps_per_iteration for the build indices given, keyed by iteration number. Returns false on failure.
+    using PerIterationEvaluation =
+        std::function<bool(const QVector<int>& indices, const int iterations, QVector<QMap<int, double>>& dps_per_iteration)>;
+    // Picks the build that replaces build 0, the current build: the winner of successive halving, if simulating
+    // it against build 0 with max_iterations confirms it. Returns 0 to keep the current build or -1 if an
+    // evaluation failed. next_dps is set to the confirmed DPS of the returned build when it is not build 0.
+    int select_next_build(const int num_builds,
+                          const Evaluation& evaluate,
+                          const PerIterationEvaluation& evaluate_per_iteration,
+                          QMap<int, double>& next_dps,
+                          int& evaluations) const;
+
+    static TalentBuild get_build(const CharacterTalents* talents);
+    // Replaces the character's talents with the given build. Returns false if the build breaks talent tree rules.
+    static bool apply_build(Character* pchar, const TalentBuild& build);
+    static QVector<TalentBuild> get_neighbours(CharacterTalents* talents);
+
+private:
+    EvaluatorPool* pool;
+
+    int iterations {100};
+    int max_iterations {10000};
+    int max_rounds {20};
+
+    bool evaluate(const QVector<TalentBuild>& builds, const QVector<int>& indices, const int stage_iterations, QVector<double>& dps);
+    bool evaluate_per_iteration(const QVector<TalentBuild>& builds,
+                                const QVector<int>& indices,
+                                const int stage_iterations,
+                                QVector<QMap<int, double>>& dps_per_iteration);
+};
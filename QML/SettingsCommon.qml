@@ -77,6 +77,17 @@ RectangleBorders {
             onAcceptedInput: settings.setCombatIterationsQuickSim(value)
         }
 
+        SettingsTextFieldEntry {
+            description: "Target precision (95% CI)"
+            minVal: 0
+            maxVal: 1000
+            valueText: settings.targetConfidenceInterval
+            placeholderText: settings.targetConfidenceInterval
+            unitText: "± DPS (0 = run all iterations)"
+
+            onAcceptedInput: settings.setTargetConfidenceInterval(value)
+        }
+
         SettingsTextFieldEntry {
             description: "Combat length"
             minVal: 30
@@ -109,5 +120,22 @@ RectangleBorders {
 
             onAcceptedInput: settings.setTargetBaseArmor(value)
         }
+
+        GradientSelectedButton {
+            selected: settings.commonRandomNumbers
+            gradientSelectedFrom: "#1b7500"
+            gradientSelectedTo: "#134f00"
+
+            anchors.left: parent.left
+            anchors.leftMargin: 10
+
+            height: 30
+            width: 250
+            TextSmall {
+                text: "Common random numbers (stat weights)"
+            }
+
+            onSelectButtonClicked: settings.toggleCommonRandomNumbers()
+        }
     }
 }
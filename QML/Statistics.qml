@@ -308,6 +308,7 @@ Rectangle {
                 relvalue: _relvalue
                 standarddev: _standarddev
                 confidenceinterval: _confidenceinterval
+                pairedconfidenceinterval: _pairedconfidenceinterval
             }
         }
 
@@ -343,6 +344,7 @@ Rectangle {
                 relvalue: _relvalue
                 standarddev: _standarddev
                 confidenceinterval: _confidenceinterval
+                pairedconfidenceinterval: _pairedconfidenceinterval
             }
         }
     }
@@ -866,9 +868,23 @@ Rectangle {
             text: statistics.engineHandledEventsPerSecond + " events handled / second"
         }
 
+        TextSmall {
+            id: eventPoolHighWaterMarkText
+            anchorParent: false
+            pointSize: 15
+
+            anchors {
+                top: eventsHandledPerSecondText.bottom
+                topMargin: 5
+                left: parent.left
+            }
+
+            text: statistics.engineEventPoolHighWaterMark + " peak live events in event pool"
+        }
+
         StatisticsEngineBreakdownSorting {
             id: engineBreakdownSorting
-            anchors.top: eventsHandledPerSecondText.bottom
+            anchors.top: eventPoolHighWaterMarkText.bottom
             anchors.topMargin: 10
         }
 
@@ -890,6 +906,7 @@ Rectangle {
                 percentage: _percentage
                 total: _total
                 permin: _permin
+                cancelled: _cancelled
             }
         }
     }
@@ -77,5 +77,22 @@ RectangleBorders {
                 text: "Handled per minute"
             }
         }
+
+        RectangleBorders {
+            height: parent.height
+            width: parent.percentageWidth
+
+            property int method: EngineBreakdownSorting.ByCancelled
+
+            onRectangleClicked: engineBreakdownModel.selectSort(method)
+            onRectangleRightClicked: engineBreakdownModel.selectSort(method)
+
+            rectColor: engineBreakdownModel.currentSortingMethod === method ? root.darkGray :
+                                                                              root.darkDarkGray
+
+            TextSmall {
+                text: "Cancelled"
+            }
+        }
     }
 }
@@ -1,7 +1,7 @@
 import QtQuick 2.0
 
 Rectangle {
-    width: 600
+    width: 720
     height: 30
 
     color: "transparent"
@@ -10,6 +10,7 @@ Rectangle {
     property string percentage
     property int total
     property string permin
+    property int cancelled
 
     Row {
         anchors.fill: parent
@@ -56,5 +57,14 @@ Rectangle {
                 text: permin
             }
         }
+
+        RectangleBorders {
+            height: parent.height
+            width: parent.percentageWidth
+
+            TextSmall {
+                text: cancelled
+            }
+        }
     }
 }
@@ -1,7 +1,7 @@
 import QtQuick 2.0
 
 Rectangle {
-    width: 600
+    width: 720
     height: 30
 
     color: "transparent"
@@ -11,6 +11,7 @@ Rectangle {
     property string relvalue
     property string standarddev
     property string confidenceinterval
+    property string pairedconfidenceinterval
 
     Row {
         anchors.fill: parent
@@ -49,6 +50,15 @@ Rectangle {
             }
         }
 
+        RectangleBorders {
+            height: parent.height
+            width: parent.percentageWidth
+
+            TextSmall {
+                text: pairedconfidenceinterval
+            }
+        }
+
         RectangleBorders {
             height: parent.height
             width: parent.percentageWidth
@@ -61,6 +61,23 @@ RectangleBorders {
             }
         }
 
+        RectangleBorders {
+            height: parent.height
+            width: parent.percentageWidth
+
+            property int method: ScaleResultSorting.ByPairedConfidenceInterval
+
+            onRectangleClicked: scaleResultModel.selectSort(method)
+            onRectangleRightClicked: scaleResultModel.selectSort(method)
+
+            rectColor: scaleResultModel.currentSortingMethod === method ? root.darkGray :
+                                                                          root.darkDarkGray
+
+            TextSmall {
+                text: "± (95% CI, paired)"
+            }
+        }
+
         RectangleBorders {
             height: parent.height
             width: parent.percentageWidth
@@ -0,0 +1,177 @@
+#include "CalendarQueue.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtAlgorithms>
+
+CalendarQueue::~CalendarQueue() {
+    this->clear();
+}
+
+bool CalendarQueue::later(const Entry& lhs, const Entry& rhs) {
+    if (lhs.priority != rhs.priority)
+        return lhs.priority > rhs.priority;
+
+    return lhs.sequence > rhs.sequence;
+}
+
+qint64 CalendarQueue::bucket_for(const double priority) {
+    return static_cast<qint64>(std::floor(priority / BUCKET_WIDTH));
+}
+
+Event* CalendarQueue::get_next() {
+    std::vector<Entry>& bucket = bucket_of_next_event();
+    Event* next = bucket.back().event;
+
+    bucket.pop_back();
+    --size_in_wheel;
+    if (bucket.empty()) {
+        const int index = static_cast<int>(first_bucket & (NUM_BUCKETS - 1));
+        occupied[index / 64] &= ~(Q_UINT64_C(1) << (index % 64));
+    }
+
+    if (next->is_cancelled())
+        --num_cancelled;
+    else
+        next->release_handle();
+
+    return next;
+}
+
+Event* CalendarQueue::peek() {
+    return bucket_of_next_event().back().event;
+}
+
+void CalendarQueue::push(Event* event) {
+    const Entry entry {event->priority, next_sequence++, event};
+    const qint64 bucket = bucket_for(entry.priority);
+
+    if (empty())
+        first_bucket = bucket;
+    else if (bucket < first_bucket)
+        rebase_wheel(bucket);
+
+    if (bucket >= first_bucket + NUM_BUCKETS) {
+        overflow.push_back(entry);
+        std::push_heap(overflow.begin(), overflow.end(), later);
+        return;
+    }
+
+    insert_into_wheel(entry);
+}
+
+bool CalendarQueue::empty() {
+    return size_in_wheel == 0 && overflow.empty();
+}
+
+void CalendarQueue::clear() {
+    for (auto& bucket : buckets) {
+        for (const auto& entry : bucket)
+            delete entry.event;
+        bucket.clear();
+    }
+
+    for (const auto& entry : overflow)
+        delete entry.event;
+    overflow.clear();
+
+    std::fill(std::begin(occupied), std::end(occupied), 0);
+    size_in_wheel = 0;
+    first_bucket = 0;
+    num_cancelled = 0;
+}
+
+unsigned CalendarQueue::size() const {
+    return size_in_wheel + static_cast<unsigned>(overflow.size());
+}
+
+void CalendarQueue::compact() {
+    auto delete_if_cancelled = [](const Entry& entry) {
+        if (!entry.event->is_cancelled())
+            return false;
+
+        delete entry.event;
+        return true;
+    };
+
+    for (int index = 0; index < NUM_BUCKETS; ++index) {
+        std::vector<Entry>& bucket = buckets[index];
+        if (bucket.empty())
+            continue;
+
+        const auto size_before = bucket.size();
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(), delete_if_cancelled), bucket.end());
+        size_in_wheel -= static_cast<unsigned>(size_before - bucket.size());
+
+        if (bucket.empty())
+            occupied[index / 64] &= ~(Q_UINT64_C(1) << (index % 64));
+    }
+
+    overflow.erase(std::remove_if(overflow.begin(), overflow.end(), delete_if_cancelled), overflow.end());
+    std::make_heap(overflow.begin(), overflow.end(), later);
+    num_cancelled = 0;
+}
+
+void CalendarQueue::insert_into_wheel(const Entry& entry) {
+    const int index = static_cast<int>(bucket_for(entry.priority) & (NUM_BUCKETS - 1));
+    std::vector<Entry>& bucket = buckets[index];
+
+    bucket.insert(std::upper_bound(bucket.begin(), bucket.end(), entry, later), entry);
+    occupied[index / 64] |= Q_UINT64_C(1) << (index % 64);
+    ++size_in_wheel;
+}
+
+void CalendarQueue::move_overflow_into_wheel() {
+    while (!overflow.empty() && bucket_for(overflow.front().priority) < first_bucket + NUM_BUCKETS) {
+        std::pop_heap(overflow.begin(), overflow.end(), later);
+        insert_into_wheel(overflow.back());
+        overflow.pop_back();
+    }
+}
+
+void CalendarQueue::rebase_wheel(const qint64 new_first_bucket) {
+    // Only reached when an event is scheduled before the earliest pending one,
+    // e.g. when tests rewind the engine. Everything in the wheel goes through
+    // the overflow heap so the wheel can be rebuilt around the new start.
+    for (auto& bucket : buckets) {
+        for (const auto& entry : bucket) {
+            overflow.push_back(entry);
+            std::push_heap(overflow.begin(), overflow.end(), later);
+        }
+        bucket.clear();
+    }
+
+    std::fill(std::begin(occupied), std::end(occupied), 0);
+    size_in_wheel = 0;
+    first_bucket = new_first_bucket;
+    move_overflow_into_wheel();
+}
+
+std::vector<CalendarQueue::Entry>& CalendarQueue::bucket_of_next_event() {
+    if (size_in_wheel == 0) {
+        first_bucket = bucket_for(overflow.front().priority);
+        move_overflow_into_wheel();
+    }
+
+    const int start = static_cast<int>(first_bucket & (NUM_BUCKETS - 1));
+    int offset = 0;
+    for (int i = 0; i <= NUM_BUCKETS / 64; ++i) {
+        const int index = (start + offset) & (NUM_BUCKETS - 1);
+        const quint64 remaining = occupied[index / 64] >> (index % 64);
+
+        if (remaining != 0) {
+            offset += static_cast<int>(qCountTrailingZeroBits(remaining));
+            break;
+        }
+
+        offset += 64 - index % 64;
+    }
+
+    if (offset > 0) {
+        first_bucket += offset;
+        move_overflow_into_wheel();
+    }
+
+    return buckets[first_bucket & (NUM_BUCKETS - 1)];
+}
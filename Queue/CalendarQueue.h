@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+#include <QtGlobal>
+
+#include "Queue.h"
+
+/*
+ * Timing wheel ("calendar queue") for events scheduled close to the current
+ * time. The wheel covers NUM_BUCKETS consecutive buckets of BUCKET_WIDTH
+ * seconds starting at the bucket of the earliest pending event; each bucket
+ * is a small vector kept sorted latest-first so the next event is popped from
+ * the back. Events beyond the wheel (e.g. EncounterEnd) wait in an overflow
+ * heap and are moved into the wheel as it advances. Simultaneous events are
+ * dispatched in insertion order.
+ */
+class CalendarQueue : public Queue {
+public:
+    ~CalendarQueue() override;
+
+    Event* get_next() override;
+    Event* peek() override;
+    void push(Event*) override;
+    bool empty() override;
+    void clear() override;
+    unsigned size() const override;
+
+    static constexpr double BUCKET_WIDTH = 0.25;
+    static const int NUM_BUCKETS = 256;
+
+protected:
+    void compact() override;
+
+private:
+    struct Entry {
+        double priority;
+        quint64 sequence;
+        Event* event;
+    };
+
+    std::vector<Entry> buckets[NUM_BUCKETS];
+    quint64 occupied[NUM_BUCKETS / 64] {};
+    std::vector<Entry> overflow;
+
+    qint64 first_bucket {0};
+    quint64 next_sequence {0};
+    unsigned size_in_wheel {0};
+
+    static bool later(const Entry& lhs, const Entry& rhs);
+    static qint64 bucket_for(const double priority);
+
+    void insert_into_wheel(const Entry& entry);
+    void move_overflow_into_wheel();
+    void rebase_wheel(const qint64 new_first_bucket);
+    std::vector<Entry>& bucket_of_next_event();
+};
@@ -0,0 +1,63 @@
+#include "HeapQueue.h"
+
+#include <algorithm>
+
+HeapQueue::~HeapQueue() {
+    this->clear();
+}
+
+bool HeapQueue::later(const Entry& lhs, const Entry& rhs) {
+    return lhs.priority > rhs.priority;
+}
+
+Event* HeapQueue::get_next() {
+    Event* top = heap.front().event;
+    std::pop_heap(heap.begin(), heap.end(), later);
+    heap.pop_back();
+
+    if (top->is_cancelled())
+        --num_cancelled;
+    else
+        top->release_handle();
+
+    return top;
+}
+
+Event* HeapQueue::peek() {
+    return heap.front().event;
+}
+
+void HeapQueue::push(Event* event) {
+    heap.push_back({event->priority, event});
+    std::push_heap(heap.begin(), heap.end(), later);
+}
+
+bool HeapQueue::empty() {
+    return heap.empty();
+}
+
+void HeapQueue::clear() {
+    for (const auto& entry : heap)
+        delete entry.event;
+
+    heap.clear();
+    num_cancelled = 0;
+}
+
+unsigned HeapQueue::size() const {
+    return static_cast<unsigned>(heap.size());
+}
+
+void HeapQueue::compact() {
+    auto cancelled = std::remove_if(heap.begin(), heap.end(), [](const Entry& entry) {
+        if (!entry.event->is_cancelled())
+            return false;
+
+        delete entry.event;
+        return true;
+    });
+
+    heap.erase(cancelled, heap.end());
+    std::make_heap(heap.begin(), heap.end(), later);
+    num_cancelled = 0;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "Queue.h"
+
+/*
+ * Binary min-heap with the priority stored next to the event pointer, so
+ * sifting never dereferences an Event. Uses the same heap algorithm as the
+ * previous std::priority_queue<Event*> which keeps the dispatch order of
+ * simultaneous events unchanged.
+ */
+class HeapQueue : public Queue {
+public:
+    ~HeapQueue() override;
+
+    Event* get_next() override;
+    Event* peek() override;
+    void push(Event*) override;
+    bool empty() override;
+    void clear() override;
+    unsigned size() const override;
+
+protected:
+    void compact() override;
+
+private:
+    struct Entry {
+        double priority;
+        Event* event;
+    };
+
+    std::vector<Entry> heap;
+
+    static bool later(const Entry& lhs, const Entry& rhs);
+};
@@ -1,30 +1,16 @@
 #include "Queue.h"
 
-Queue::~Queue() {
-    this->clear();
-}
-
-Event* Queue::get_next() {
-    Event* top = this->queue.top();
-    this->queue.pop();
-    return top;
-}
+void Queue::cancel(Event* event) {
+    if (event->is_cancelled())
+        return;
 
-Event* Queue::peek() {
-    return this->queue.top();
-}
-
-void Queue::push(Event* event) {
-    this->queue.push(event);
-}
+    event->cancel();
+    ++num_cancelled;
 
-bool Queue::empty() {
-    return this->queue.empty();
+    if (num_cancelled >= COMPACTION_THRESHOLD && num_cancelled * 2 > size())
+        compact();
 }
 
-void Queue::clear() {
-    while (!this->queue.empty()) {
-        Event* top = get_next();
-        delete top;
-    }
+unsigned Queue::get_num_cancelled() const {
+    return this->num_cancelled;
 }
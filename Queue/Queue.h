@@ -1,20 +1,37 @@
 #pragma once
 
-#include <queue>
-
 #include "Event.h"
 
+enum class QueueType : int
+{
+    Heap,
+    Calendar,
+};
+
+/*
+ * Cancelled events are left in the queue as tombstones and returned by
+ * get_next() like any other event; Engine::run discards them without
+ * dispatching. Once tombstones make up more than half of a sizeable queue
+ * they are compacted away in one pass.
+ */
 class Queue {
 public:
-    ~Queue();
+    virtual ~Queue() = default;
+
+    virtual Event* get_next() = 0;
+    virtual Event* peek() = 0;
+    virtual void push(Event*) = 0;
+    virtual bool empty() = 0;
+    virtual void clear() = 0;
+    virtual unsigned size() const = 0;
+
+    void cancel(Event* event);
+    unsigned get_num_cancelled() const;
+
+    static const unsigned COMPACTION_THRESHOLD = 64;
 
-    Event* get_next();
-    Event* peek();
-    void push(Event*);
-    bool empty();
-    void pop();
-    void clear();
+protected:
+    unsigned num_cancelled {0};
 
-private:
-    std::priority_queue<Event*, std::vector<Event*>, Compare> queue;
+    virtual void compact() = 0;
 };
@@ -16,7 +16,7 @@ void Mana::set_base_mana(const unsigned base_mana) {
 }
 
 unsigned Mana::get_max_resource() const {
-    return static_cast<unsigned>(round((base_mana + pchar->get_stats()->get_intellect() * 15) * max_mana_mod));
+    return static_cast<unsigned>(round((base_mana + pchar->get_stats()->get_intellect() * 15) * max_mana_mod.get_modifier()));
 }
 
 unsigned Mana::get_resource_per_tick() {
@@ -44,11 +44,11 @@ double Mana::get_tick_rate() const {
 }
 
 void Mana::increase_max_mana_mod(const unsigned change) {
-    CharacterStats::add_multiplicative_effect(max_mana_mod_changes, static_cast<int>(change), max_mana_mod);
+    max_mana_mod.add(static_cast<int>(change));
 }
 
 void Mana::decrease_max_mana_mod(const unsigned change) {
-    CharacterStats::remove_multiplicative_effect(max_mana_mod_changes, static_cast<int>(change), max_mana_mod);
+    max_mana_mod.remove(static_cast<int>(change));
 }
 
 void Mana::lose_resource_effect() {
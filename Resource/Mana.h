@@ -1,8 +1,7 @@
 #pragma once
 
-#include <QVector>
-
 #include "RegeneratingResource.h"
+#include "Utils/ModifierStack.h"
 
 class Character;
 
@@ -37,8 +36,7 @@ private:
     bool ignore_5sr {false};
     double bonus_regen_modifier {1.0};
 
-    double max_mana_mod {1.0};
-    QVector<int> max_mana_mod_changes;
+    ModifierStack max_mana_mod;
 
     void add_next_tick();
 
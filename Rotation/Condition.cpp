@@ -2,6 +2,8 @@
 
 #include <QDebug>
 
+#include "ConditionProgram.h"
+
 QString Sentence::logical_connective_as_string() const {
     switch (logical_connective) {
     case LogicalConnective::AND:
@@ -71,6 +73,10 @@ void Sentence::dump() const {
 
 Condition::Condition(const Comparator comparator) : comparator(comparator) {}
 
+bool Condition::condition_fulfilled() const {
+    return compile().is_fulfilled();
+}
+
 QString Condition::comparator_as_string() const {
     switch (comparator) {
     case Comparator::Eq:
@@ -2,6 +2,8 @@
 
 #include <QString>
 
+struct ConditionInstruction;
+
 enum class Comparator : int
 {
     Less,
@@ -62,9 +64,12 @@ public:
     Condition(const Comparator comparator);
     virtual ~Condition() = default;
 
-    virtual bool condition_fulfilled() const = 0;
+    // Resolves the condition into an instruction for the executor's ConditionProgram.
+    virtual ConditionInstruction compile() const = 0;
     virtual QString condition_description() const = 0;
 
+    bool condition_fulfilled() const;
+
     const Comparator comparator;
 
 protected:
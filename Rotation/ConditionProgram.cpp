@@ -0,0 +1,179 @@
+#include "ConditionProgram.h"
+
+#include <algorithm>
+
+#include "AutoShot.h"
+#include "Buff.h"
+#include "Character.h"
+#include "CharacterSpells.h"
+#include "CharacterStats.h"
+#include "Druid.h"
+#include "Engine.h"
+#include "MainhandAttack.h"
+#include "Rogue.h"
+#include "SimSettings.h"
+#include "Spell.h"
+#include "Utils/Check.h"
+#include "Utils/CompareDouble.h"
+
+namespace {
+// Buff durations and spell cooldowns treat Leq as Less and Geq as Greater.
+bool compare_time(const double lhs_value, const Comparator comparator, const double rhs_value) {
+    switch (comparator) {
+    case Comparator::Less:
+    case Comparator::Leq:
+        return lhs_value < rhs_value;
+    case Comparator::Eq:
+        return (lhs_value - rhs_value) < 0.000001;
+    case Comparator::Geq:
+    case Comparator::Greater:
+        return lhs_value > rhs_value;
+    default:
+        check(false, "compare_time reached end of switch");
+        return false;
+    }
+}
+
+bool compare_with_tolerance(const double lhs_value, const Comparator comparator, const double rhs_value) {
+    switch (comparator) {
+    case Comparator::Less:
+        return lhs_value < rhs_value;
+    case Comparator::Leq:
+        return lhs_value < rhs_value || almost_equal(lhs_value, rhs_value);
+    case Comparator::Eq:
+        return almost_equal(lhs_value, rhs_value);
+    case Comparator::Geq:
+        return lhs_value > rhs_value || almost_equal(lhs_value, rhs_value);
+    case Comparator::Greater:
+        return lhs_value > rhs_value;
+    default:
+        check(false, "compare_with_tolerance reached end of switch");
+        return false;
+    }
+}
+
+bool compare_stacks(const int stacks, const Comparator comparator, const double rhs_value) {
+    switch (comparator) {
+    case Comparator::Less:
+        return stacks < rhs_value;
+    case Comparator::Leq:
+        return stacks <= rhs_value;
+    case Comparator::Eq:
+        return stacks == rhs_value;
+    case Comparator::Geq:
+        return stacks >= rhs_value;
+    case Comparator::Greater:
+        return stacks > rhs_value;
+    case Comparator::False:
+        return stacks == 0;
+    case Comparator::True:
+        return stacks > 0;
+    }
+
+    return false;
+}
+} // namespace
+
+bool ConditionInstruction::is_fulfilled() const {
+    switch (opcode) {
+    case ConditionOpcode::BuffDuration:
+        if (comparator == Comparator::False)
+            return !buff->is_active();
+        if (comparator == Comparator::True)
+            return buff->is_active();
+        return compare_time(buff->time_left(), comparator, rhs_value);
+    case ConditionOpcode::BuffStacks:
+        return compare_stacks(buff->get_stacks(), comparator, rhs_value);
+    case ConditionOpcode::SpellCooldown:
+        return compare_time(spell->get_cooldown_remaining(), comparator, rhs_value);
+    case ConditionOpcode::Resource:
+        return compare_with_tolerance(pchar->get_resource_level(resource_type), comparator, rhs_value);
+    case ConditionOpcode::TargetHealth: {
+        int combat_length = sim_settings->get_combat_length();
+        double remaining_health = (combat_length - engine->get_current_priority()) / combat_length;
+        return compare_with_tolerance(remaining_health, comparator, rhs_value);
+    }
+    case ConditionOpcode::TimeRemainingEncounter: {
+        int combat_length = sim_settings->get_combat_length();
+        double remaining_encounter_time = combat_length - engine->get_current_priority();
+        return compare_with_tolerance(remaining_encounter_time, comparator, rhs_value);
+    }
+    case ConditionOpcode::TimeRemainingExecute: {
+        int combat_length = sim_settings->get_combat_length();
+        double execute_threshold = sim_settings->get_execute_threshold();
+        double remaining_execute_time = combat_length * (1 - execute_threshold) - engine->get_current_priority();
+        return compare_with_tolerance(remaining_execute_time, comparator, rhs_value);
+    }
+    case ConditionOpcode::SwingTimer: {
+        double delta = engine->get_current_priority() - std::max(spells->get_mh_attack()->get_last_used(), 0.0);
+        return compare_with_tolerance(delta, comparator, rhs_value);
+    }
+    case ConditionOpcode::AutoShotTimer: {
+        double delta = engine->get_current_priority() - std::max(spells->get_auto_shot()->get_last_used(), 0.0);
+        return compare_with_tolerance(delta, comparator, rhs_value);
+    }
+    case ConditionOpcode::MeleeAP:
+        return compare_with_tolerance(pchar->get_stats()->get_melee_ap(), comparator, rhs_value);
+    case ConditionOpcode::RogueComboPoints:
+        return compare_with_tolerance(static_cast<const Rogue*>(pchar)->get_combo_points(), comparator, rhs_value);
+    case ConditionOpcode::DruidComboPoints:
+        return compare_with_tolerance(static_cast<const Druid*>(pchar)->get_combo_points(), comparator, rhs_value);
+    case ConditionOpcode::TimeRemainingGCD:
+        return compare_with_tolerance(pchar->time_until_action_ready(), comparator, rhs_value);
+    case ConditionOpcode::AlwaysFalse:
+        return false;
+    }
+
+    return false;
+}
+
+void ConditionProgram::compile(const QVector<QVector<Condition*>>& condition_groups) {
+    instructions.clear();
+
+    for (const auto& group : condition_groups) {
+        if (group.empty()) {
+            // Failing the earlier groups now ends in this group, which holds. Later groups are never reached.
+            for (auto& instruction : instructions) {
+                if (instruction.next_if_false == instructions.size())
+                    instruction.next_if_false = ACCEPT;
+            }
+            break;
+        }
+
+        const int first_in_group = instructions.size();
+        const int first_in_next_group = first_in_group + group.size();
+
+        for (int i = 0; i < group.size(); ++i) {
+            // A condition that could not be created (e.g. an unknown builtin variable) never holds.
+            ConditionInstruction instruction = group[i] != nullptr ? group[i]->compile() : ConditionInstruction();
+            instruction.next_if_true = i + 1 < group.size() ? first_in_group + i + 1 : ACCEPT;
+            instruction.next_if_false = first_in_next_group;
+            instructions.append(instruction);
+        }
+    }
+}
+
+void ConditionProgram::clear() {
+    instructions.clear();
+}
+
+bool ConditionProgram::empty() const {
+    return instructions.empty();
+}
+
+int ConditionProgram::size() const {
+    return instructions.size();
+}
+
+bool ConditionProgram::is_fulfilled() const {
+    if (instructions.empty())
+        return true;
+
+    int index = 0;
+    while (index != ACCEPT && index < instructions.size()) {
+        const ConditionInstruction& instruction = instructions[index];
+        index = instruction.is_fulfilled() ? instruction.next_if_true : instruction.next_if_false;
+    }
+
+    return index == ACCEPT;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <QVector>
+
+#include "Condition.h"
+#include "Resource.h"
+
+class Buff;
+class Character;
+class CharacterSpells;
+class Engine;
+class SimSettings;
+class Spell;
+
+enum class ConditionOpcode : int
+{
+    BuffDuration,
+    BuffStacks,
+    SpellCooldown,
+    Resource,
+    TargetHealth,
+    TimeRemainingEncounter,
+    TimeRemainingExecute,
+    SwingTimer,
+    AutoShotTimer,
+    MeleeAP,
+    RogueComboPoints,
+    DruidComboPoints,
+    TimeRemainingGCD,
+    AlwaysFalse,
+};
+
+// A single condition with everything it reads resolved when the rotation is linked to a character.
+struct ConditionInstruction {
+    ConditionOpcode opcode {ConditionOpcode::AlwaysFalse};
+    Comparator comparator {Comparator::False};
+    double rhs_value {0.0};
+
+    const Buff* buff {nullptr};
+    const Spell* spell {nullptr};
+    const Character* pchar {nullptr};
+    const CharacterSpells* spells {nullptr};
+    const Engine* engine {nullptr};
+    const SimSettings* sim_settings {nullptr};
+    ResourceType resource_type {ResourceType::Mana};
+
+    // Index of the instruction to run next; ACCEPT ends the program as fulfilled and any index past the last
+    // instruction ends it as not fulfilled.
+    int next_if_true {0};
+    int next_if_false {0};
+
+    bool is_fulfilled() const;
+};
+
+// The condition groups of a RotationExecutor flattened into one instruction array. The conditions of a group
+// are chained by next_if_true, and a failing condition jumps straight to the first condition of the next group.
+// A group without conditions always holds, so a program without instructions is fulfilled.
+class ConditionProgram {
+public:
+    void compile(const QVector<QVector<Condition*>>& condition_groups);
+    void clear();
+
+    bool empty() const;
+    int size() const;
+
+    bool is_fulfilled() const;
+
+    static const int ACCEPT = -1;
+
+private:
+    QVector<ConditionInstruction> instructions;
+};
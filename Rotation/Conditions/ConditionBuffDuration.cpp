@@ -1,28 +1,18 @@
 #include "ConditionBuffDuration.h"
 
 #include "Buff.h"
-#include "Utils/Check.h"
+#include "ConditionProgram.h"
 
 ConditionBuffDuration::ConditionBuffDuration(Buff* buff, const Comparator comparator, const double cmp_value) :
     Condition(comparator), buff(buff), cmp_value(cmp_value) {}
 
-bool ConditionBuffDuration::condition_fulfilled() const {
-    switch (comparator) {
-    case Comparator::Less:
-    case Comparator::Leq:
-        return buff->time_left() < cmp_value;
-    case Comparator::Eq:
-        return (buff->time_left() - cmp_value) < 0.000001;
-    case Comparator::Geq:
-    case Comparator::Greater:
-        return buff->time_left() > cmp_value;
-    case Comparator::False:
-        return !buff->is_active();
-    case Comparator::True:
-        return buff->is_active();
-    }
-
-    return false;
+ConditionInstruction ConditionBuffDuration::compile() const {
+    ConditionInstruction instruction;
+    instruction.opcode = ConditionOpcode::BuffDuration;
+    instruction.comparator = comparator;
+    instruction.buff = buff;
+    instruction.rhs_value = cmp_value;
+    return instruction;
 }
 
 QString ConditionBuffDuration::condition_description() const {
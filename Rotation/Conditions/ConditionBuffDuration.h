@@ -8,7 +8,7 @@ class ConditionBuffDuration : public Condition {
 public:
     ConditionBuffDuration(Buff* buff, const Comparator comparator, const double cmp_value);
 
-    bool condition_fulfilled() const override;
+    ConditionInstruction compile() const override;
     QString condition_description() const override;
 
     Buff* buff;
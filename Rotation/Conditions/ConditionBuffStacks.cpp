@@ -1,30 +1,18 @@
 #include "ConditionBuffStacks.h"
 
 #include "Buff.h"
-#include "Utils/Check.h"
+#include "ConditionProgram.h"
 
 ConditionBuffStacks::ConditionBuffStacks(Buff* buff, const Comparator comparator, const int cmp_value) :
     Condition(comparator), buff(buff), cmp_value(cmp_value) {}
 
-bool ConditionBuffStacks::condition_fulfilled() const {
-    switch (comparator) {
-    case Comparator::Less:
-        return buff->get_stacks() < cmp_value;
-    case Comparator::Leq:
-        return buff->get_stacks() <= cmp_value;
-    case Comparator::Eq:
-        return buff->get_stacks() == cmp_value;
-    case Comparator::Geq:
-        return buff->get_stacks() >= cmp_value;
-    case Comparator::Greater:
-        return buff->get_stacks() > cmp_value;
-    case Comparator::False:
-        return buff->get_stacks() == 0;
-    case Comparator::True:
-        return buff->get_stacks() > 0;
-    }
-
-    return false;
+ConditionInstruction ConditionBuffStacks::compile() const {
+    ConditionInstruction instruction;
+    instruction.opcode = ConditionOpcode::BuffStacks;
+    instruction.comparator = comparator;
+    instruction.buff = buff;
+    instruction.rhs_value = cmp_value;
+    return instruction;
 }
 
 QString ConditionBuffStacks::condition_description() const {
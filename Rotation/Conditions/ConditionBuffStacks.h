@@ -8,7 +8,7 @@ class ConditionBuffStacks : public Condition {
 public:
     ConditionBuffStacks(Buff* buff, const Comparator comparator, const int cmp_value);
 
-    bool condition_fulfilled() const override;
+    ConditionInstruction compile() const override;
     QString condition_description() const override;
 
     Buff* buff;
@@ -1,30 +1,18 @@
 #include "ConditionResource.h"
 
-#include "Character.h"
-#include "Utils/Check.h"
-#include "Utils/CompareDouble.h"
+#include "ConditionProgram.h"
 
 ConditionResource::ConditionResource(Character* pchar, const Comparator comparator_, const ResourceType resource_type, const double cmp_value) :
     Condition(comparator_), pchar(pchar), resource_type(resource_type), cmp_value(cmp_value) {}
 
-bool ConditionResource::condition_fulfilled() const {
-    const unsigned resource = pchar->get_resource_level(resource_type);
-
-    switch (comparator) {
-    case Comparator::Less:
-        return resource < cmp_value;
-    case Comparator::Leq:
-        return resource < cmp_value || almost_equal(resource, cmp_value);
-    case Comparator::Eq:
-        return almost_equal(resource, cmp_value);
-    case Comparator::Geq:
-        return resource > cmp_value || almost_equal(resource, cmp_value);
-    case Comparator::Greater:
-        return resource > cmp_value;
-    default:
-        check(false, "ConditionResource::condition_fulfilled reached end of switch");
-        return false;
-    }
+ConditionInstruction ConditionResource::compile() const {
+    ConditionInstruction instruction;
+    instruction.opcode = ConditionOpcode::Resource;
+    instruction.comparator = comparator;
+    instruction.pchar = pchar;
+    instruction.resource_type = resource_type;
+    instruction.rhs_value = cmp_value;
+    return instruction;
 }
 
 QString ConditionResource::condition_description() const {
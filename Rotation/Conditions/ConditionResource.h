@@ -9,7 +9,7 @@ class ConditionResource : public Condition {
 public:
     ConditionResource(Character* pchar, const Comparator comparator, const ResourceType resource_type, const double cmp_value);
 
-    bool condition_fulfilled() const override;
+    ConditionInstruction compile() const override;
     QString condition_description() const override;
 
     const Character* pchar;
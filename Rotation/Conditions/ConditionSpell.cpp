@@ -1,27 +1,18 @@
 #include "ConditionSpell.h"
 
+#include "ConditionProgram.h"
 #include "Spell.h"
-#include "Utils/Check.h"
 
 ConditionSpell::ConditionSpell(Spell* spell, const Comparator comparator, const double cmp_value) :
     Condition(comparator), spell(spell), cmp_value(cmp_value) {}
 
-bool ConditionSpell::condition_fulfilled() const {
-    double cooldown = spell->get_cooldown_remaining();
-
-    switch (comparator) {
-    case Comparator::Less:
-    case Comparator::Leq:
-        return cooldown < cmp_value;
-    case Comparator::Eq:
-        return (cooldown - cmp_value) < 0.000001;
-    case Comparator::Geq:
-    case Comparator::Greater:
-        return cooldown > cmp_value;
-    default:
-        check(false, "ConditionSpell::condition_fulfilled reached end of switch");
-        return false;
-    }
+ConditionInstruction ConditionSpell::compile() const {
+    ConditionInstruction instruction;
+    instruction.opcode = ConditionOpcode::SpellCooldown;
+    instruction.comparator = comparator;
+    instruction.spell = spell;
+    instruction.rhs_value = cmp_value;
+    return instruction;
 }
 
 QString ConditionSpell::condition_description() const {
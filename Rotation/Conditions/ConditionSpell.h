@@ -8,7 +8,7 @@ class ConditionSpell : public Condition {
 public:
     ConditionSpell(Spell* spell, const Comparator comparator, const double cmp_value);
 
-    bool condition_fulfilled() const override;
+    ConditionInstruction compile() const override;
     QString condition_description() const override;
 
 private:
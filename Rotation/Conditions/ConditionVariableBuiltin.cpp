@@ -1,18 +1,10 @@
 #include "ConditionVariableBuiltin.h"
 
-#include <cmath>
-
-#include "AutoShot.h"
 #include "Character.h"
-#include "CharacterSpells.h"
-#include "CharacterStats.h"
+#include "ConditionProgram.h"
 #include "Druid.h"
-#include "Engine.h"
-#include "MainhandAttack.h"
 #include "Rogue.h"
-#include "SimSettings.h"
 #include "Utils/Check.h"
-#include "Utils/CompareDouble.h"
 
 ConditionVariableBuiltin::ConditionVariableBuiltin(Character* pchar,
                                                    const BuiltinVariables builtin,
@@ -20,54 +12,50 @@ ConditionVariableBuiltin::ConditionVariableBuiltin(Character* pchar,
                                                    const double cmp_value) :
     Condition(comparator), pchar(pchar), engine(pchar->get_engine()), builtin(builtin), rhs_value(cmp_value) {}
 
-bool ConditionVariableBuiltin::condition_fulfilled() const {
+ConditionInstruction ConditionVariableBuiltin::compile() const {
+    ConditionInstruction instruction;
+    instruction.comparator = comparator;
+    instruction.rhs_value = rhs_value;
+    instruction.pchar = pchar;
+    instruction.spells = pchar->get_spells();
+    instruction.engine = engine;
+    instruction.sim_settings = pchar->get_sim_settings();
+
     switch (builtin) {
-    case BuiltinVariables::TargetHealth: {
-        int combat_length = pchar->get_sim_settings()->get_combat_length();
-        double remaining_health = (combat_length - engine->get_current_priority()) / combat_length;
-        return cmp_values(remaining_health);
-    }
-    case BuiltinVariables::TimeRemainingEncounter: {
-        int combat_length = pchar->get_sim_settings()->get_combat_length();
-        double remaining_encounter_time = combat_length - engine->get_current_priority();
-        return cmp_values(remaining_encounter_time);
-    }
-    case BuiltinVariables::TimeRemainingExecute: {
-        int combat_length = pchar->get_sim_settings()->get_combat_length();
-        double execute_threshold = pchar->get_sim_settings()->get_execute_threshold();
-        double remaining_execute_time = combat_length * (1 - execute_threshold) - engine->get_current_priority();
-        return cmp_values(remaining_execute_time);
-    }
-    case BuiltinVariables::SwingTimer: {
-        auto mh_attack = pchar->get_spells()->get_mh_attack();
-        double delta = pchar->get_engine()->get_current_priority() - std::max(mh_attack->get_last_used(), 0.0);
-        return cmp_values(delta);
-    }
-    case BuiltinVariables::AutoShotTimer: {
-        auto auto_shot = pchar->get_spells()->get_auto_shot();
-        double delta = pchar->get_engine()->get_current_priority() - std::max(auto_shot->get_last_used(), 0.0);
-        return cmp_values(delta);
-    }
+    case BuiltinVariables::TargetHealth:
+        instruction.opcode = ConditionOpcode::TargetHealth;
+        break;
+    case BuiltinVariables::TimeRemainingEncounter:
+        instruction.opcode = ConditionOpcode::TimeRemainingEncounter;
+        break;
+    case BuiltinVariables::TimeRemainingExecute:
+        instruction.opcode = ConditionOpcode::TimeRemainingExecute;
+        break;
+    case BuiltinVariables::SwingTimer:
+        instruction.opcode = ConditionOpcode::SwingTimer;
+        break;
+    case BuiltinVariables::AutoShotTimer:
+        instruction.opcode = ConditionOpcode::AutoShotTimer;
+        break;
     case BuiltinVariables::MeleeAP:
-        return cmp_values(pchar->get_stats()->get_melee_ap());
-    case BuiltinVariables::ComboPoints: {
-        const auto rogue = dynamic_cast<Rogue*>(pchar);
-        if (rogue != nullptr)
-            return cmp_values(rogue->get_combo_points());
-
-        const auto druid = dynamic_cast<Druid*>(pchar);
-        if (druid != nullptr)
-            return cmp_values(druid->get_combo_points());
-
-        return false;
-    }
+        instruction.opcode = ConditionOpcode::MeleeAP;
+        break;
+    case BuiltinVariables::ComboPoints:
+        if (dynamic_cast<Rogue*>(pchar) != nullptr)
+            instruction.opcode = ConditionOpcode::RogueComboPoints;
+        else if (dynamic_cast<Druid*>(pchar) != nullptr)
+            instruction.opcode = ConditionOpcode::DruidComboPoints;
+        else
+            instruction.opcode = ConditionOpcode::AlwaysFalse;
+        break;
     case BuiltinVariables::TimeRemainingGCD:
-        return cmp_values(pchar->time_until_action_ready());
-
+        instruction.opcode = ConditionOpcode::TimeRemainingGCD;
+        break;
     default:
-        check(false, "ConditionVariableBuiltin::condition_fulfilled reached end of switch");
-        return false;
+        check(false, "ConditionVariableBuiltin::compile reached end of switch");
     }
+
+    return instruction;
 }
 
 QString ConditionVariableBuiltin::condition_description() const {
@@ -91,24 +79,6 @@ QString ConditionVariableBuiltin::condition_description() const {
     return "<builtin variable is missing condition description>";
 }
 
-bool ConditionVariableBuiltin::cmp_values(const double lhs_value) const {
-    switch (comparator) {
-    case Comparator::Less:
-        return lhs_value < rhs_value;
-    case Comparator::Leq:
-        return almost_equal(lhs_value, rhs_value) || lhs_value < rhs_value;
-    case Comparator::Eq:
-        return almost_equal(lhs_value, rhs_value);
-    case Comparator::Geq:
-        return almost_equal(lhs_value, rhs_value) || lhs_value > rhs_value;
-    case Comparator::Greater:
-        return lhs_value > rhs_value;
-    default:
-        check(false, "ConditionVariableBuiltin::cmp_values reached end of switch");
-        return false;
-    }
-}
-
 BuiltinVariables ConditionVariableBuiltin::get_builtin_variable(const QString& var_name) {
     if (var_name == "target_health")
         return BuiltinVariables::TargetHealth;
@@ -22,7 +22,7 @@ class ConditionVariableBuiltin : public Condition {
 public:
     ConditionVariableBuiltin(Character* pchar, const BuiltinVariables builtin, const Comparator comparator, const double rhs_value);
 
-    bool condition_fulfilled() const override;
+    ConditionInstruction compile() const override;
     QString condition_description() const override;
 
     static BuiltinVariables get_builtin_variable(const QString& var_name);
@@ -31,6 +31,4 @@ public:
     Engine* engine;
     const BuiltinVariables builtin;
     const double rhs_value;
-
-    bool cmp_values(const double lhs_value) const;
 };
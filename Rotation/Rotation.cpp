@@ -22,6 +22,18 @@
 
 Rotation::Rotation(QString class_name) : pchar(nullptr), class_name(std::move(class_name)), attack_mode(AttackMode::MeleeAttack) {}
 
+Rotation::Rotation(const Rotation* rotation) :
+    pchar(nullptr),
+    class_name(rotation->class_name),
+    name(rotation->name),
+    description(rotation->description),
+    attack_mode(rotation->attack_mode),
+    precombat_spell_names(rotation->precombat_spell_names),
+    precast_spell_name(rotation->precast_spell_name) {
+    for (const auto& executor : rotation->all_executors)
+        all_executors.append(new RotationExecutor(executor));
+}
+
 Rotation::~Rotation() {
     for (const auto& executor : all_executors) {
         delete executor;
@@ -112,10 +124,7 @@ void Rotation::link_precombat_spells() {
 }
 
 bool Rotation::add_conditionals(RotationExecutor* executor) {
-    for (const auto& group : executor->condition_groups)
-        for (const auto& condition : group)
-            delete condition;
-    executor->condition_groups.clear();
+    executor->clear_conditions();
 
     QVector<Condition*> condition_group_to_add;
 
@@ -168,6 +177,8 @@ bool Rotation::add_conditionals(RotationExecutor* executor) {
     if (!condition_group_to_add.empty())
         executor->add_condition(condition_group_to_add);
 
+    executor->compile_conditions();
+
     return true;
 }
 
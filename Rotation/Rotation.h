@@ -15,6 +15,7 @@ class Spell;
 class Rotation {
 public:
     Rotation(QString class_name);
+    Rotation(const Rotation* rotation);
     ~Rotation();
 
     void run_precombat_actions();
@@ -28,18 +28,18 @@ RotationExecutor::RotationExecutor(QString name, const int spell_rank) : spell_n
     spell_status_statistics.insert(SpellStatus::OvercapResource, 0);
 }
 
+RotationExecutor::RotationExecutor(const RotationExecutor* executor) : RotationExecutor(executor->spell_name, executor->spell_rank) {
+    for (const auto& sentence : executor->sentences)
+        sentences.append(new Sentence(*sentence));
+}
+
 RotationExecutor::~RotationExecutor() {
-    for (const auto& condition_group : condition_groups) {
-        for (const auto& j : condition_group) {
-            delete j;
-        }
-    }
+    clear_conditions();
 
     for (const auto& sentence : sentences) {
         delete sentence;
     }
 
-    condition_groups.clear();
     sentences.clear();
 }
 
@@ -51,32 +51,15 @@ void RotationExecutor::attempt_cast() {
         return;
     }
 
-    if (condition_groups.empty()) {
+    if (condition_program.is_fulfilled()) {
         ++successful_casts;
         spell->perform();
         return;
     }
 
-    for (int i = 0; i < condition_groups.size(); ++i) {
-        if (condition_group_fulfilled(i)) {
-            ++successful_casts;
-            spell->perform();
-            return;
-        }
-    }
     ++no_condition_group_fulfilled;
 }
 
-bool RotationExecutor::condition_group_fulfilled(const int index) const {
-    for (int i = 0; i < condition_groups.at(index).size(); ++i) {
-        if (!condition_groups[index][i]->condition_fulfilled()) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
 QString RotationExecutor::get_spell_name() const {
     return this->spell_name;
 }
@@ -135,6 +118,21 @@ void RotationExecutor::add_condition(const QVector<Condition*>& condition) {
     this->condition_groups.append(condition);
 }
 
+void RotationExecutor::compile_conditions() {
+    condition_program.compile(condition_groups);
+}
+
+void RotationExecutor::clear_conditions() {
+    for (const auto& condition_group : condition_groups) {
+        for (const auto& condition : condition_group) {
+            delete condition;
+        }
+    }
+
+    condition_groups.clear();
+    condition_program.clear();
+}
+
 void RotationExecutor::dump() {
     qDebug() << "\nspell_name" << spell_name;
     qDebug() << "spell ptr" << spell;
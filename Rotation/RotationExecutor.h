@@ -5,6 +5,8 @@
 #include <QMap>
 #include <QVector>
 
+#include "ConditionProgram.h"
+
 class Condition;
 class Sentence;
 class Spell;
@@ -14,10 +16,14 @@ enum class SpellStatus : int;
 class RotationExecutor {
 public:
     RotationExecutor(QString spell_name, const int spell_rank);
+    RotationExecutor(const RotationExecutor* executor);
     ~RotationExecutor();
 
     void add_sentence(Sentence* sentence);
     void add_condition(const QVector<Condition*>& condition);
+    // Flattens the condition groups added so far into the program run by attempt_cast().
+    void compile_conditions();
+    void clear_conditions();
 
     void attempt_cast();
 
@@ -37,6 +43,7 @@ public:
     QVector<QVector<Condition*>> condition_groups;
 
 private:
+    ConditionProgram condition_program;
     Spell* spell {nullptr};
     StatisticsRotationExecutor* rotation_statistics {nullptr};
     const QString spell_name;
@@ -46,6 +53,4 @@ private:
     unsigned no_condition_group_fulfilled {0};
     QMap<SpellStatus, unsigned> spell_status_statistics;
     QMap<QString, QString> variable_assignments;
-
-    bool condition_group_fulfilled(const int index) const;
 };
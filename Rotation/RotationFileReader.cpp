@@ -1,5 +1,7 @@
 #include "RotationFileReader.h"
 
+#include <utility>
+
 #include <QDebug>
 #include <QDir>
 
@@ -9,7 +11,39 @@
 #include "Spell.h"
 #include "Utils/Check.h"
 
+namespace {
+class RotationTemplates {
+public:
+    RotationTemplates(QVector<Rotation*> rotations) : rotations(std::move(rotations)) {}
+    ~RotationTemplates() { qDeleteAll(rotations); }
+
+    const QVector<Rotation*> rotations;
+};
+} // namespace
+
 void RotationFileReader::add_rotations(QVector<Rotation*>& rotations) {
+    for (const auto& rotation : get_rotation_templates())
+        rotations.append(new Rotation(rotation));
+}
+
+Rotation* RotationFileReader::get_rotation(const QString& class_name, const QString& rotation_name) {
+    for (const auto& rotation : get_rotation_templates()) {
+        if (rotation->get_class() == class_name && rotation->get_name() == rotation_name)
+            return new Rotation(rotation);
+    }
+
+    return nullptr;
+}
+
+const QVector<Rotation*>& RotationFileReader::get_rotation_templates() {
+    // Initialization of a function-local static is thread-safe, so runner threads loading characters at the same
+    // time wait for a single parse of the rotation files.
+    static const RotationTemplates templates(parse_rotation_files());
+    return templates.rotations;
+}
+
+QVector<Rotation*> RotationFileReader::parse_rotation_files() {
+    QVector<Rotation*> rotations;
     QFile paths_file("rotation_paths.xml");
 
     if (!paths_file.open(QFile::ReadOnly | QFile::Text)) {
@@ -24,7 +58,7 @@ void RotationFileReader::add_rotations(QVector<Rotation*>& rotations) {
     if (paths_reader.readNextStartElement()) {
         if (paths_reader.name() != "paths") {
             qDebug() << "Expected <paths> root element in rotation_paths.xml.";
-            return;
+            return rotations;
         }
 
         while (paths_reader.readNextStartElement()) {
@@ -52,6 +86,8 @@ void RotationFileReader::add_rotations(QVector<Rotation*>& rotations) {
         if (rotation != nullptr)
             rotations.append(rotation);
     }
+
+    return rotations;
 }
 
 Rotation* RotationFileReader::parse_rotation_file(const QString& path) {
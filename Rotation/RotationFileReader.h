@@ -11,11 +11,16 @@ class Sentence;
 
 enum class Comparator : int;
 
+// Rotation files are parsed once per process into read-only templates. Callers receive their own copies which
+// are bound to a character through Rotation::link_spells().
 class RotationFileReader {
 public:
     static void add_rotations(QVector<Rotation*>&);
+    static Rotation* get_rotation(const QString& class_name, const QString& rotation_name);
 
 private:
+    static const QVector<Rotation*>& get_rotation_templates();
+    static QVector<Rotation*> parse_rotation_files();
     static Rotation* parse_rotation_file(const QString& path);
     static void rotation_file_handler(QXmlStreamReader& reader, Rotation* rotation);
     static bool rotation_executor_handler(QXmlStreamReader& reader, RotationExecutor* executor);
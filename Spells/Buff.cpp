@@ -38,6 +38,8 @@ void Buff::apply_buff() {
     if (!is_enabled())
         return;
 
+    request_reset();
+
     if (!is_active()) {
         if (!apply_buff_to_target())
             return;
@@ -55,8 +57,8 @@ void Buff::apply_buff() {
     this->refreshed = raid_control->get_engine()->get_current_priority();
     this->active = true;
     if (this->duration != BuffDuration::PERMANENT) {
-        auto new_event = new BuffRemoval(this, raid_control->get_engine()->get_current_priority() + duration, ++iteration);
-        raid_control->get_engine()->add_event(new_event);
+        auto new_event = new (raid_control->get_engine()->get_event_pool()) BuffRemoval(this, raid_control->get_engine()->get_current_priority() + duration, ++iteration);
+        raid_control->get_engine()->reschedule_event(&removal_event, new_event);
     }
 }
 
@@ -85,6 +87,8 @@ void Buff::force_remove_buff() {
     if (is_active())
         remove_buff_from_target();
 
+    raid_control->get_engine()->cancel_event(&removal_event);
+
     this->expired = raid_control->get_engine()->get_current_priority();
     this->active = false;
     this->current_stacks = 0;
@@ -143,6 +147,37 @@ void Buff::reset() {
     reset_effect();
 }
 
+void Buff::set_reset_queue(QVector<Buff*>* reset_queue) {
+    if (this->reset_queue != nullptr && reset_requested)
+        this->reset_queue->removeOne(this);
+
+    this->reset_queue = reset_queue;
+    reset_requested = false;
+    encounters_reported = 0;
+
+    // The buff may have been applied before it was queued.
+    request_reset();
+}
+
+void Buff::reset_after_encounter(const int encounter) {
+    report_encounters_without_uptime(encounter - 1);
+    reset_requested = false;
+    reset();
+    encounters_reported = encounter;
+}
+
+void Buff::finish_set_of_combat_iterations(const int num_encounters) {
+    report_encounters_without_uptime(num_encounters);
+    encounters_reported = 0;
+}
+
+void Buff::report_encounters_without_uptime(const int last_encounter) {
+    if (!is_hidden() && statistics_buff != nullptr)
+        statistics_buff->add_encounters_without_uptime(last_encounter - encounters_reported);
+
+    encounters_reported = last_encounter;
+}
+
 void Buff::initialize() {
     current_charges = 0;
     current_stacks = 0;
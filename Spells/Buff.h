@@ -1,6 +1,9 @@
 #pragma once
 
 #include <QString>
+#include <QVector>
+
+#include "EventHandle.h"
 
 class Character;
 class RaidControl;
@@ -59,6 +62,19 @@ public:
     void initialize();
     virtual void prepare_set_of_combat_iterations() = 0;
 
+    // Buffs are queued for reset when applied, so only buffs that were applied are reset between combat
+    // iterations. Encounters in which a buff was never applied are reported to its statistics with zero uptime
+    // when it is next reset after an encounter, or when the set of combat iterations is finished.
+    void request_reset() {
+        if (reset_queue != nullptr && !reset_requested) {
+            reset_requested = true;
+            reset_queue->append(this);
+        }
+    }
+    void set_reset_queue(QVector<Buff*>* reset_queue);
+    void reset_after_encounter(const int encounter);
+    void finish_set_of_combat_iterations(const int num_encounters);
+
     bool is_enabled() const;
     bool is_hidden() const;
     bool is_debuff() const;
@@ -82,6 +98,7 @@ protected:
     int current_stacks {0};
     int max_stacks {1};
     int iteration {};
+    EventHandle removal_event;
     double applied {};
     double refreshed {};
     double expired {};
@@ -104,4 +121,11 @@ protected:
     virtual void reset_effect();
     virtual void charge_change_effect();
     virtual void prepare_set_of_combat_iterations_spell_specific();
+
+private:
+    QVector<Buff*>* reset_queue {nullptr};
+    bool reset_requested {false};
+    int encounters_reported {0};
+
+    void report_encounters_without_uptime(const int last_encounter);
 };
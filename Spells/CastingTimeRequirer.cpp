@@ -20,7 +20,7 @@ void CastingTimeRequirer::start_cast() {
     if (suppressible_cast == SuppressibleCast::Yes && caster->get_stats()->casting_time_suppressed())
         return complete_cast();
 
-    auto new_event = new CastComplete(this, engine->get_current_priority() + get_cast_time());
+    auto new_event = new (engine->get_event_pool()) CastComplete(this, engine->get_current_priority() + get_cast_time());
     this->engine->add_event(new_event);
 }
 
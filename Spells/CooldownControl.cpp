@@ -23,7 +23,7 @@ double CooldownControl::get_cooldown_remaining() const {
 
 void CooldownControl::add_spell_cd_event() const {
     double cooldown_ready = engine->get_current_priority() + base;
-    engine->add_event(new PlayerAction(pchar->get_spells(), cooldown_ready));
+    engine->add_event(new (engine->get_event_pool()) PlayerAction(pchar->get_spells(), cooldown_ready));
 }
 
 void CooldownControl::add_gcd_event() const {
@@ -32,5 +32,5 @@ void CooldownControl::add_gcd_event() const {
 
     pchar->start_global_cooldown();
     double gcd_ready = engine->get_current_priority() + pchar->global_cooldown();
-    engine->add_event(new PlayerAction(pchar->get_spells(), gcd_ready));
+    engine->add_event(new (engine->get_event_pool()) PlayerAction(pchar->get_spells(), gcd_ready));
 }
@@ -10,3 +10,5 @@ enum class MagicSchool : int
     Shadow,
     Holy
 };
+
+static const int NUM_MAGIC_SCHOOLS = static_cast<int>(MagicSchool::Holy) + 1;
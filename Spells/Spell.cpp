@@ -63,7 +63,7 @@ double Spell::get_next_use() const {
 
 double Spell::get_resource_cost() const {
     const unsigned mana_skill_reduction = resource_type == ResourceType::Mana ? pchar->get_stats()->get_mana_skill_reduction() : 0;
-    const unsigned calculated_resource_cost = static_cast<unsigned>(round(resource_cost * resource_cost_mod));
+    const unsigned calculated_resource_cost = static_cast<unsigned>(round(resource_cost * resource_cost_mod.get_modifier()));
     return mana_skill_reduction > calculated_resource_cost ? 0 : calculated_resource_cost - mana_skill_reduction;
 }
 
@@ -130,6 +130,7 @@ void Spell::perform() {
               .arg(pchar->get_resource_level(resource_type))
               .arg(get_resource_cost())
               .toStdString());
+    request_reset();
     cooldown->last_used = engine->get_current_priority();
     this->spell_effect();
 }
@@ -224,6 +225,22 @@ void Spell::reset() {
     reset_effect();
 }
 
+void Spell::set_reset_queue(QVector<Spell*>* reset_queue) {
+    if (this->reset_queue != nullptr && reset_requested)
+        this->reset_queue->removeOne(this);
+
+    this->reset_queue = reset_queue;
+    reset_requested = false;
+
+    // The spell may have been used before it was queued.
+    request_reset();
+}
+
+void Spell::reset_after_encounter() {
+    reset_requested = false;
+    reset();
+}
+
 void Spell::prepare_set_of_combat_iterations() {
     prepare_set_of_combat_iterations_spell_specific();
     this->statistics_spell = pchar->get_statistics()->get_spell_statistics(name, icon, spell_rank);
@@ -238,11 +255,11 @@ void Spell::set_instance_id(const int instance_id) {
 }
 
 void Spell::increase_resource_cost_modifier(const int change) {
-    CharacterStats::add_multiplicative_effect(resource_cost_mod_changes, change, resource_cost_mod);
+    resource_cost_mod.add(change);
 }
 
 void Spell::decrease_resource_cost_modifier(const int change) {
-    CharacterStats::remove_multiplicative_effect(resource_cost_mod_changes, change, resource_cost_mod);
+    resource_cost_mod.remove(change);
 }
 
 void Spell::prepare_set_of_combat_iterations_spell_specific() {}
@@ -8,6 +8,7 @@
 #include "MagicAttackResult.h"
 #include "PhysicalAttackResult.h"
 #include "Resource.h"
+#include "Utils/ModifierStack.h"
 
 class Character;
 class CombatRoll;
@@ -85,6 +86,17 @@ public:
     void reset();
     virtual void prepare_set_of_combat_iterations();
 
+    // Spells are queued for reset when state restored by reset() changes, so only spells that were used are reset
+    // between combat iterations. The owner of the queue calls reset_after_encounter() for every queued spell.
+    void request_reset() {
+        if (reset_queue != nullptr && !reset_requested) {
+            reset_requested = true;
+            reset_queue->append(this);
+        }
+    }
+    void set_reset_queue(QVector<Spell*>* reset_queue);
+    void reset_after_encounter();
+
     int get_instance_id() const;
     void set_instance_id(const int);
 
@@ -110,8 +122,7 @@ protected:
     const RestrictedByGcd restricted_by_gcd;
     const ResourceType resource_type;
     unsigned resource_cost;
-    double resource_cost_mod {1.0};
-    QVector<int> resource_cost_mod_changes;
+    ModifierStack resource_cost_mod;
     const int spell_rank;
     unsigned level_req {60};
     int instance_id;
@@ -135,4 +146,8 @@ protected:
 
     double damage_after_modifiers(const double damage) const;
     double get_partial_resist_dmg_modifier(const int resist_result) const;
+
+private:
+    QVector<Spell*>* reset_queue {nullptr};
+    bool reset_requested {false};
 };
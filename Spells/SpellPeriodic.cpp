@@ -91,11 +91,11 @@ void SpellPeriodic::disable_spell_effect() {
 }
 
 void SpellPeriodic::add_next_tick() {
-    pchar->get_engine()->add_event(new DotTick(this, pchar->get_engine()->get_current_priority() + tick_rate, application_id));
+    pchar->get_engine()->add_event(new (pchar->get_engine()->get_event_pool()) DotTick(this, pchar->get_engine()->get_current_priority() + tick_rate, application_id));
 }
 
 void SpellPeriodic::start_ticking() {
-    pchar->get_engine()->add_event(new DotTick(this, pchar->get_engine()->get_current_priority() + tick_rate, ++application_id));
+    pchar->get_engine()->add_event(new (pchar->get_engine()->get_event_pool()) DotTick(this, pchar->get_engine()->get_current_priority() + tick_rate, ++application_id));
 }
 
 double SpellPeriodic::get_spell_coefficient_from_duration(const double duration) {
@@ -69,12 +69,19 @@ StatisticsEngine* ClassStatistics::get_engine_statistics() {
     return engine_statistics;
 }
 
-void ClassStatistics::finish_combat_iteration() {
+void ClassStatistics::finish_combat_iteration(const int iteration) {
     long long damage_dealt_this_iteration = get_total_personal_damage_dealt() - damage_dealt_previous_iterations;
     check((damage_dealt_this_iteration >= 0), "Damage dealt must be a positive value");
 
     dps_for_iterations.append(static_cast<double>(damage_dealt_this_iteration) / combat_length);
+    iteration_numbers.append(iteration);
     damage_dealt_previous_iterations += damage_dealt_this_iteration;
+    ++combat_iterations;
+}
+
+double ClassStatistics::get_dps_for_last_iteration() const {
+    check(!dps_for_iterations.empty(), "No combat iteration has finished");
+    return dps_for_iterations.last();
 }
 
 long long ClassStatistics::get_total_personal_damage_dealt() const {
@@ -140,7 +147,7 @@ void ClassStatistics::prepare_statistics() {
 
     engine_statistics = new StatisticsEngine();
 
-    combat_iterations = sim_settings->get_combat_iterations_full_sim();
+    combat_iterations = 0;
     combat_length = sim_settings->get_combat_length();
 }
 
@@ -36,7 +36,8 @@ public:
     void add_player_result(RaidMemberResult* result);
 
     void prepare_statistics();
-    void finish_combat_iteration();
+    void finish_combat_iteration(const int iteration);
+    double get_dps_for_last_iteration() const;
 
     void set_sim_option(const SimOption::Name);
 
@@ -61,6 +62,7 @@ private:
     QList<StatisticsRotationExecutor*> rotation_executor_statistics;
 
     QVector<double> dps_for_iterations;
+    QVector<int> iteration_numbers;
     QVector<RaidMemberResult*> player_results;
 
     void delete_objects();
@@ -2,7 +2,10 @@
 
 #include <cmath>
 
+#include <QHash>
+
 #include "ClassStatistics.h"
+#include "RunningStatistics.h"
 #include "StatisticsBuff.h"
 #include "StatisticsEngine.h"
 #include "StatisticsProc.h"
@@ -247,8 +250,10 @@ void NumberCruncher::calculate_stat_weights_for_tps(QList<ScaleResult*>& tps_lis
 
       double standard_deviation = get_standard_deviation_for_option(tps_it.key());
       double confidence_interval = get_confidence_interval_for_option(tps_it.key(), standard_deviation);
+      double paired_confidence_interval = get_paired_confidence_interval_for_option(tps_it.key());
 
-      tps_list.append(new ScaleResult(tps_it.key(), false, 0.0, 0.0, absolute_diff, relative_diff, standard_deviation, confidence_interval));
+      tps_list.append(new ScaleResult(tps_it.key(), false, 0.0, 0.0, absolute_diff, relative_diff, standard_deviation, confidence_interval,
+                                     paired_confidence_interval));
       ++tps_it;
     }
 }
@@ -276,8 +281,10 @@ void NumberCruncher::calculate_stat_weights_for_dps(QList<ScaleResult*>& dps_lis
 
         double standard_deviation = get_standard_deviation_for_option(dps_it.key());
         double confidence_interval = get_confidence_interval_for_option(dps_it.key(), standard_deviation);
+        double paired_confidence_interval = get_paired_confidence_interval_for_option(dps_it.key());
 
-        dps_list.append(new ScaleResult(dps_it.key(), true, 0.0, 0.0, absolute_diff, relative_diff, standard_deviation, confidence_interval));
+        dps_list.append(new ScaleResult(dps_it.key(), true, 0.0, 0.0, absolute_diff, relative_diff, standard_deviation, confidence_interval,
+                                       paired_confidence_interval));
         ++dps_it;
     }
 }
@@ -286,6 +293,21 @@ double NumberCruncher::get_personal_dps(SimOption::Name option) const {
     return get_dps_for_option(option);
 }
 
+QMap<int, double> NumberCruncher::get_personal_dps_per_iteration(SimOption::Name option) const {
+    check(class_stats.contains(option), "Missing option for requested calculation");
+
+    QMap<int, double> dps_per_iteration;
+    for (const auto& class_stat : class_stats[option]) {
+        if (class_stat->ignore_non_buff_statistics)
+            continue;
+
+        for (int i = 0; i < class_stat->dps_for_iterations.size(); ++i)
+            dps_per_iteration.insert(class_stat->iteration_numbers[i], class_stat->dps_for_iterations[i]);
+    }
+
+    return dps_per_iteration;
+}
+
 double NumberCruncher::get_personal_tps(SimOption::Name option) const {
     return get_tps_for_option(option);
 }
@@ -328,39 +350,36 @@ QPair<double, double> NumberCruncher::get_min_max_dps_for_option(SimOption::Name
 double NumberCruncher::get_dps_for_option(SimOption::Name option) const {
     check(class_stats.contains(option), "Missing option for requested calculation");
 
-    QVector<double> dps;
+    // Threads run different numbers of iterations per option, so results are weighted by time in combat.
+    long long damage_dealt = 0;
+    long long time_in_combat = 0;
 
     for (const auto& class_stat : class_stats[option]) {
-        if (!class_stat->ignore_non_buff_statistics)
-            dps.append(class_stat->get_personal_result()->dps);
-    }
-
-    double dps_sum = 0;
-    for (const auto& value : dps)
-        dps_sum += value;
+        if (class_stat->ignore_non_buff_statistics)
+            continue;
 
-    dps_sum /= dps.size();
+        damage_dealt += class_stat->get_total_personal_damage_dealt();
+        time_in_combat += static_cast<long long>(class_stat->combat_iterations) * class_stat->combat_length;
+    }
 
-    return dps_sum;
+    return static_cast<double>(damage_dealt) / time_in_combat;
 }
 
 double NumberCruncher::get_tps_for_option(SimOption::Name option) const {
     check(class_stats.contains(option), "Missing option for requested calculation");
 
-    QVector<double> tps;
+    long long threat_dealt = 0;
+    long long time_in_combat = 0;
 
     for (const auto& class_stat : class_stats[option]) {
-        if (!class_stat->ignore_non_buff_statistics)
-            tps.append(class_stat->get_personal_result()->tps);
-    }
-
-    double tps_sum = 0;
-    for (const auto& value : tps)
-        tps_sum += value;
+        if (class_stat->ignore_non_buff_statistics)
+            continue;
 
-    tps_sum /= tps.size();
+        threat_dealt += class_stat->get_total_personal_threat_dealt();
+        time_in_combat += static_cast<long long>(class_stat->combat_iterations) * class_stat->combat_length;
+    }
 
-    return tps_sum;
+    return static_cast<double>(threat_dealt) / time_in_combat;
 }
 
 ScaleResult* NumberCruncher::get_dps_distribution() const {
@@ -368,7 +387,7 @@ ScaleResult* NumberCruncher::get_dps_distribution() const {
     double confidence_interval = get_confidence_interval_for_option(SimOption::Name::NoScale, standard_deviation);
     QPair<double, double> dps = get_min_max_dps_for_option(SimOption::Name::NoScale);
 
-    return new ScaleResult(SimOption::Name::NoScale, true, dps.first, dps.second, 0.0, 0.0, standard_deviation, confidence_interval);
+    return new ScaleResult(SimOption::Name::NoScale, true, dps.first, dps.second, 0.0, 0.0, standard_deviation, confidence_interval, 0.0);
 }
 
 void NumberCruncher::merge_player_results(ClassStatistics* cstat) {
@@ -430,6 +449,33 @@ double NumberCruncher::get_confidence_interval_for_option(SimOption::Name option
     return z_value * (standard_deviation / std::sqrt(population));
 }
 
+double NumberCruncher::get_paired_confidence_interval_for_option(SimOption::Name option) const {
+    check(class_stats.contains(option), "Missing option for requested calculation");
+    check(class_stats.contains(SimOption::Name::NoScale), "Missing baseline NoScale statistics");
+
+    QHash<int, double> baseline_dps;
+    for (const auto& class_stat : class_stats[SimOption::Name::NoScale]) {
+        if (class_stat->ignore_non_buff_statistics)
+            continue;
+
+        for (int i = 0; i < class_stat->dps_for_iterations.size(); ++i)
+            baseline_dps.insert(class_stat->iteration_numbers[i], class_stat->dps_for_iterations[i]);
+    }
+
+    RunningStatistics paired_difference;
+    for (const auto& class_stat : class_stats[option]) {
+        if (class_stat->ignore_non_buff_statistics)
+            continue;
+
+        for (int i = 0; i < class_stat->dps_for_iterations.size(); ++i) {
+            if (baseline_dps.contains(class_stat->iteration_numbers[i]))
+                paired_difference.add(class_stat->dps_for_iterations[i] - baseline_dps[class_stat->iteration_numbers[i]]);
+        }
+    }
+
+    return paired_difference.get_confidence_interval();
+}
+
 QString get_name_for_option(const SimOption::Name option) {
     if (option == SimOption::Name::ScaleAgility)
         return "+10 Agility";
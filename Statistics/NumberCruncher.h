@@ -36,6 +36,8 @@ public:
     void reset();
 
     double get_personal_dps(SimOption::Name) const;
+    // The DPS of every combat iteration, keyed by iteration number.
+    QMap<int, double> get_personal_dps_per_iteration(SimOption::Name) const;
     double get_personal_tps(SimOption::Name) const;
     double get_raid_dps() const;
     double get_raid_tps() const;
@@ -47,6 +49,7 @@ private:
     friend class DamageMetersModel;
     friend class DebuffBreakdownModel;
     friend class EngineBreakdownModel;
+    friend class HeadlessSimControl;
     friend class MeleeDamageAvoidanceBreakdownModel;
     friend class MeleeDamageBreakdownModel;
     friend class ProcBreakdownModel;
@@ -88,6 +91,7 @@ private:
 
     double get_standard_deviation_for_option(SimOption::Name) const;
     double get_confidence_interval_for_option(SimOption::Name, const double) const;
+    double get_paired_confidence_interval_for_option(SimOption::Name) const;
 };
 
 class ScaleResult {
@@ -99,7 +103,8 @@ public:
                 double absolute_value,
                 double relative_value,
                 double standard_deviation,
-                double confidence_interval) :
+                double confidence_interval,
+                double paired_confidence_interval) :
         option(option),
         for_dps(for_dps),
         min_dps(min_dps),
@@ -107,7 +112,8 @@ public:
         absolute_value(absolute_value),
         relative_value(relative_value),
         standard_deviation(standard_deviation),
-        confidence_interval(confidence_interval) {}
+        confidence_interval(confidence_interval),
+        paired_confidence_interval(paired_confidence_interval) {}
 
     const SimOption::Name option;
     const bool for_dps;
@@ -117,4 +123,5 @@ public:
     const double relative_value;
     const double standard_deviation;
     const double confidence_interval;
+    const double paired_confidence_interval;
 };
@@ -0,0 +1,51 @@
+#include "RunningStatistics.h"
+
+#include <cmath>
+
+void RunningStatistics::add(const double value) {
+    // Welford's online update.
+    ++count;
+    const double delta = value - mean;
+    mean += delta / count;
+    sum_of_squares += delta * (value - mean);
+}
+
+void RunningStatistics::merge(const RunningStatistics& other) {
+    if (other.count == 0)
+        return;
+
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+
+    // Chan et al.'s pairwise combination of two partial results.
+    const int total = count + other.count;
+    const double delta = other.mean - mean;
+    mean += delta * other.count / total;
+    sum_of_squares += other.sum_of_squares + delta * delta * count * other.count / total;
+    count = total;
+}
+
+int RunningStatistics::get_count() const {
+    return count;
+}
+
+double RunningStatistics::get_mean() const {
+    return mean;
+}
+
+double RunningStatistics::get_variance() const {
+    return count > 0 ? sum_of_squares / count : 0.0;
+}
+
+double RunningStatistics::get_standard_deviation() const {
+    return std::sqrt(get_variance());
+}
+
+double RunningStatistics::get_confidence_interval(const double z_value) const {
+    if (count == 0)
+        return 0.0;
+
+    return z_value * (get_standard_deviation() / std::sqrt(count));
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+class RunningStatistics {
+public:
+    void add(const double value);
+    void merge(const RunningStatistics& other);
+
+    int get_count() const;
+    double get_mean() const;
+    double get_variance() const;
+    double get_standard_deviation() const;
+    double get_confidence_interval(const double z_value = 1.960) const;
+
+private:
+    int count {0};
+    double mean {0.0};
+    double sum_of_squares {0.0};
+};
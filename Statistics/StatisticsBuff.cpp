@@ -65,6 +65,14 @@ void StatisticsBuff::add_uptime_for_encounter(const double uptime) {
     avg_uptime = avg_uptime + (uptime - avg_uptime) / counter;
 }
 
+void StatisticsBuff::add_encounters_without_uptime(const int num_encounters) {
+    if (num_encounters <= 0)
+        return;
+
+    counter += num_encounters;
+    avg_uptime = avg_uptime * (counter - num_encounters) / counter;
+}
+
 double StatisticsBuff::get_min_uptime() const {
     return min_uptime_set ? this->min_uptime : 0.0;
 }
@@ -21,6 +21,7 @@ public:
 
     void add_uptime(const double);
     void add_uptime_for_encounter(const double);
+    void add_encounters_without_uptime(const int num_encounters);
 
     double get_min_uptime() const;
     double get_max_uptime() const;
@@ -1,6 +1,5 @@
 #include "StatisticsEngine.h"
 
-#include "Event.h"
 #include "Utils/Check.h"
 
 bool event_type(QPair<EventType, unsigned> lhs, QPair<EventType, unsigned> rhs) {
@@ -11,15 +10,26 @@ bool total(QPair<EventType, unsigned> lhs, QPair<EventType, unsigned> rhs) {
     return lhs.second > rhs.second;
 }
 
+StatisticsEngine::StatisticsEngine() {
+    reset();
+}
+
 void StatisticsEngine::reset() {
-    event_map.clear();
+    events.fill(0);
+    cancelled_events.fill(0);
+    event_pool_high_water_mark = 0;
 }
 
 void StatisticsEngine::increment_event(EventType event) {
-    if (!event_map.contains(event))
-        event_map[event] = 0;
+    ++events[static_cast<int>(event)];
+}
 
-    ++event_map[event];
+void StatisticsEngine::increment_cancelled_event(EventType event) {
+    ++cancelled_events[static_cast<int>(event)];
+}
+
+unsigned StatisticsEngine::get_cancelled_events(EventType event) const {
+    return cancelled_events[static_cast<int>(event)];
 }
 
 void StatisticsEngine::set_elapsed(const unsigned elapsed) {
@@ -31,29 +41,32 @@ unsigned StatisticsEngine::get_elapsed() const {
     return this->elapsed;
 }
 
+void StatisticsEngine::set_event_pool_high_water_mark(const unsigned high_water_mark) {
+    if (high_water_mark > this->event_pool_high_water_mark)
+        this->event_pool_high_water_mark = high_water_mark;
+}
+
+unsigned StatisticsEngine::get_event_pool_high_water_mark() const {
+    return this->event_pool_high_water_mark;
+}
+
 void StatisticsEngine::add(const StatisticsEngine* other) {
     this->elapsed += other->elapsed;
+    set_event_pool_high_water_mark(other->event_pool_high_water_mark);
 
-    QMap<EventType, unsigned>::const_iterator it = other->event_map.constBegin();
-    while (it != other->event_map.constEnd()) {
-        if (!this->event_map.contains(it.key()))
-            this->event_map[it.key()] = 0;
-
-        this->event_map[it.key()] += other->event_map[it.key()];
-        ++it;
+    for (int i = 0; i < NUM_EVENT_TYPES; ++i) {
+        this->events[i] += other->events[i];
+        this->cancelled_events[i] += other->cancelled_events[i];
     }
 }
 
 QList<QPair<EventType, unsigned>> StatisticsEngine::get_list_of_event_pairs() const {
-    QMap<EventType, unsigned>::const_iterator it = event_map.constBegin();
-
     QList<QPair<EventType, unsigned>> event_list;
-    while (it != event_map.constEnd()) {
-        if (it.value() == 0)
+    for (int i = 0; i < NUM_EVENT_TYPES; ++i) {
+        if (events[i] == 0)
             continue;
 
-        event_list.append({it.key(), it.value()});
-        ++it;
+        event_list.append({static_cast<EventType>(i), events[i]});
     }
 
     return event_list;
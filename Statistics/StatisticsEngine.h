@@ -1,26 +1,37 @@
 #pragma once
 
-#include <QMap>
+#include <QList>
+#include <QPair>
+#include <array>
+
+#include "Event.h"
 
 class StatisticsEngine;
-enum class EventType : int;
 
 bool event_type(QPair<EventType, unsigned> lhs, QPair<EventType, unsigned> rhs);
 bool total(QPair<EventType, unsigned> lhs, QPair<EventType, unsigned> rhs);
 
 class StatisticsEngine {
 public:
+    StatisticsEngine();
+
     void reset();
 
     void increment_event(EventType event);
+    void increment_cancelled_event(EventType event);
+    unsigned get_cancelled_events(EventType event) const;
 
     void set_elapsed(const unsigned elapsed);
     unsigned get_elapsed() const;
+    void set_event_pool_high_water_mark(const unsigned high_water_mark);
+    unsigned get_event_pool_high_water_mark() const;
     void add(const StatisticsEngine*);
 
     QList<QPair<EventType, unsigned>> get_list_of_event_pairs() const;
 
 private:
     unsigned elapsed {0};
-    QMap<EventType, unsigned> event_map;
+    unsigned event_pool_high_water_mark {0};
+    std::array<unsigned, NUM_EVENT_TYPES> events;
+    std::array<unsigned, NUM_EVENT_TYPES> cancelled_events;
 };
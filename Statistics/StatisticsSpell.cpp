@@ -1,5 +1,7 @@
 #include "StatisticsSpell.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 #include "MagicAttackResult.h"
@@ -300,22 +302,22 @@ StatisticsSpell::StatisticsSpell(QString name, QString icon) :
     min_tpet(std::numeric_limits<double>::max()),
     max_tpet(std::numeric_limits<double>::min()),
     avg_tpet(0),
-    tpet_set(false),
-    possible_attempt_outcomes(QSet<Outcome>({Outcome::Miss, Outcome::FullResist, Outcome::Dodge, Outcome::Parry, Outcome::FullBlock,
-                                             Outcome::PartialResist25, Outcome::PartialResist50, Outcome::PartialResist75,
-                                             Outcome::PartialResistCrit25, Outcome::PartialResistCrit50, Outcome::PartialResistCrit75,
-                                             Outcome::PartialBlock, Outcome::PartialBlockCrit, Outcome::Glancing, Outcome::Hit, Outcome::Crit})),
-    possible_success_outcomes(QSet<Outcome>({Outcome::PartialResist25, Outcome::PartialResist50, Outcome::PartialResist75,
-                                             Outcome::PartialResistCrit25, Outcome::PartialResistCrit50, Outcome::PartialResistCrit75,
-                                             Outcome::PartialBlock, Outcome::PartialBlockCrit, Outcome::Glancing, Outcome::Hit, Outcome::Crit})) {}
-
-StatisticsSpell::~StatisticsSpell() {
+    tpet_set(false) {
     reset();
 }
 
+StatisticsSpell::~StatisticsSpell() = default;
+
 void StatisticsSpell::reset() {
-    attempts.clear();
-    damage.clear();
+    attempts.fill(0);
+
+    damage.fill(0);
+    min_damage.fill(std::numeric_limits<int>::max());
+    max_damage.fill(std::numeric_limits<int>::min());
+
+    threat.fill(0);
+    min_threat.fill(std::numeric_limits<int>::max());
+    max_threat.fill(std::numeric_limits<int>::min());
 }
 
 QString StatisticsSpell::get_name() const {
@@ -327,10 +329,7 @@ QString StatisticsSpell::get_icon() const {
 }
 
 void StatisticsSpell::increment(const Outcome outcome) {
-    if (!attempts.contains(outcome))
-        attempts[outcome] = 0;
-
-    attempts[outcome]++;
+    ++attempts[outcome];
 }
 
 void StatisticsSpell::increment_miss() {
@@ -386,13 +385,10 @@ void StatisticsSpell::increment_crit() {
 }
 
 void StatisticsSpell::add_dmg(const Outcome outcome, const int dmg, const double resource_cost, const double execution_time) {
-    if (!damage.contains(outcome))
-        damage[outcome] = 0;
-
-    if (!min_damage.contains(outcome) || min_damage[outcome] > dmg)
+    if (min_damage[outcome] > dmg)
         min_damage[outcome] = dmg;
 
-    if (!max_damage.contains(outcome) || max_damage[outcome] < dmg)
+    if (max_damage[outcome] < dmg)
         max_damage[outcome] = dmg;
 
     damage[outcome] += dmg;
@@ -403,13 +399,10 @@ void StatisticsSpell::add_dmg(const Outcome outcome, const int dmg, const double
 }
 
 void StatisticsSpell::add_thrt(const Outcome outcome, const int thrt, const double resource_cost, const double execution_time) {
-    if (!threat.contains(outcome))
-        threat[outcome] = 0;
-
-    if (!min_threat.contains(outcome) || min_threat[outcome] > thrt)
+    if (min_threat[outcome] > thrt)
         min_threat[outcome] = thrt;
 
-    if (!max_threat.contains(outcome) || max_threat[outcome] < thrt)
+    if (max_threat[outcome] < thrt)
         max_threat[outcome] = thrt;
 
     threat[outcome] += thrt;
@@ -621,7 +614,7 @@ int StatisticsSpell::get_attempts(const Outcome outcome) const {
     return attempts[outcome];
 }
 
-int StatisticsSpell::get_attempts(const QSet<Outcome>& outcomes) const {
+int StatisticsSpell::get_attempts(std::initializer_list<Outcome> outcomes) const {
     int sum = 0;
 
     for (const auto& outcome : outcomes)
@@ -691,42 +684,36 @@ int StatisticsSpell::get_crits_including_partial_resists() const {
 }
 
 long long StatisticsSpell::get_dmg(const Outcome outcome) const {
-    if (!damage.contains(outcome))
-        return 0;
-
     return damage[outcome];
 }
 
 int StatisticsSpell::get_min_dmg(const Outcome outcome) const {
-    if (!min_damage.contains(outcome))
+    if (min_damage[outcome] == std::numeric_limits<int>::max())
         return 0;
 
     return min_damage[outcome];
 }
 
 int StatisticsSpell::get_max_dmg(const Outcome outcome) const {
-    if (!max_damage.contains(outcome))
+    if (max_damage[outcome] == std::numeric_limits<int>::min())
         return 0;
 
     return max_damage[outcome];
 }
 
 long long StatisticsSpell::get_thrt(const Outcome outcome) const {
-    if (!threat.contains(outcome))
-        return 0;
-
     return threat[outcome];
 }
 
 int StatisticsSpell::get_min_thrt(const Outcome outcome) const {
-    if (!min_threat.contains(outcome))
+    if (min_threat[outcome] == std::numeric_limits<int>::max())
         return 0;
 
     return min_threat[outcome];
 }
 
 int StatisticsSpell::get_max_thrt(const Outcome outcome) const {
-    if (!max_threat.contains(outcome))
+    if (max_threat[outcome] == std::numeric_limits<int>::min())
         return 0;
 
     return max_threat[outcome];
@@ -815,8 +802,8 @@ double StatisticsSpell::get_max_dpet() const {
 int StatisticsSpell::get_num_attempt_columns() const {
     int columns = 0;
 
-    for (const auto& outcome : possible_attempt_outcomes) {
-        if (get_attempts(outcome) > 0)
+    for (const auto& outcome_attempts : attempts) {
+        if (outcome_attempts > 0)
             ++columns;
     }
 
@@ -826,8 +813,8 @@ int StatisticsSpell::get_num_attempt_columns() const {
 int StatisticsSpell::get_num_dmg_columns() const {
     int columns = 0;
 
-    for (const auto& outcome : possible_success_outcomes) {
-        if (get_dmg(outcome) > 0)
+    for (int outcome = FIRST_SUCCESS_OUTCOME; outcome < NUM_OUTCOMES; ++outcome) {
+        if (damage[outcome] > 0)
             ++columns;
     }
 
@@ -837,9 +824,8 @@ int StatisticsSpell::get_num_dmg_columns() const {
 long long StatisticsSpell::get_total_dmg_dealt() const {
     long long sum = 0;
 
-    for (const auto& outcome : possible_success_outcomes) {
-        sum += get_dmg(outcome);
-    }
+    for (int outcome = FIRST_SUCCESS_OUTCOME; outcome < NUM_OUTCOMES; ++outcome)
+        sum += damage[outcome];
 
     return sum;
 }
@@ -847,9 +833,8 @@ long long StatisticsSpell::get_total_dmg_dealt() const {
 int StatisticsSpell::get_total_attempts_made() const {
     int sum = 0;
 
-    for (const auto& outcome : possible_attempt_outcomes) {
-        sum += get_attempts(outcome);
-    }
+    for (const auto& outcome_attempts : attempts)
+        sum += outcome_attempts;
 
     return sum;
 }
@@ -945,8 +930,8 @@ double StatisticsSpell::get_max_tpet() const {
 int StatisticsSpell::get_num_thrt_columns() const {
     int columns = 0;
 
-    for (const auto& outcome : possible_success_outcomes) {
-        if (get_thrt(outcome) > 0)
+    for (int outcome = FIRST_SUCCESS_OUTCOME; outcome < NUM_OUTCOMES; ++outcome) {
+        if (threat[outcome] > 0)
             ++columns;
     }
 
@@ -956,9 +941,8 @@ int StatisticsSpell::get_num_thrt_columns() const {
 long long StatisticsSpell::get_total_thrt_dealt() const {
     long long sum = 0;
 
-    for (const auto& outcome : possible_success_outcomes) {
-        sum += get_thrt(outcome);
-    }
+    for (int outcome = FIRST_SUCCESS_OUTCOME; outcome < NUM_OUTCOMES; ++outcome)
+        sum += threat[outcome];
 
     return sum;
 }
@@ -972,58 +956,16 @@ void StatisticsSpell::set_percentage_of_threat_dealt(long long int total_threat_
 }
 
 void StatisticsSpell::add(const StatisticsSpell* other) {
-    for (const auto& outcome : possible_attempt_outcomes) {
-        if (!other->attempts.contains(outcome))
-            continue;
-
-        if (!this->attempts.contains(outcome))
-            this->attempts.insert(outcome, 0);
-
+    for (int outcome = 0; outcome < NUM_OUTCOMES; ++outcome) {
         this->attempts[outcome] += other->attempts[outcome];
-    }
-
-    for (const auto& outcome : possible_success_outcomes) {
-        if (!other->damage.contains(outcome))
-            continue;
-
-        if (!this->damage.contains(outcome))
-            this->damage.insert(outcome, 0);
 
         this->damage[outcome] += other->damage[outcome];
-
-        if (!this->min_damage.contains(outcome) && other->min_damage.contains(outcome))
-            this->min_damage[outcome] = other->min_damage[outcome];
-        else if (this->min_damage.contains(outcome) && other->min_damage.contains(outcome))
-            this->min_damage[outcome] = other->min_damage[outcome] < this->min_damage[outcome] ? other->min_damage[outcome] :
-                                                                                                 this->min_damage[outcome];
-
-        if (!this->max_damage.contains(outcome) && other->max_damage.contains(outcome))
-            this->max_damage[outcome] = other->max_damage[outcome];
-        else if (this->max_damage.contains(outcome) && other->max_damage.contains(outcome))
-            this->max_damage[outcome] = other->max_damage[outcome] < this->max_damage[outcome] ? other->max_damage[outcome] :
-                                                                                                 this->max_damage[outcome];
-    }
-
-    for (const auto& outcome : possible_success_outcomes) {
-        if (!other->threat.contains(outcome))
-            continue;
-
-        if (!this->threat.contains(outcome))
-            this->threat.insert(outcome, 0);
+        this->min_damage[outcome] = std::min(this->min_damage[outcome], other->min_damage[outcome]);
+        this->max_damage[outcome] = std::max(this->max_damage[outcome], other->max_damage[outcome]);
 
         this->threat[outcome] += other->threat[outcome];
-
-        if (!this->min_threat.contains(outcome) && other->min_threat.contains(outcome))
-            this->min_threat[outcome] = other->min_threat[outcome];
-        else if (this->min_threat.contains(outcome) && other->min_threat.contains(outcome))
-            this->min_threat[outcome] = other->min_threat[outcome] < this->min_threat[outcome] ? other->min_threat[outcome] :
-                                                                                                 this->min_threat[outcome];
-
-        if (!this->max_threat.contains(outcome) && other->max_threat.contains(outcome))
-            this->max_threat[outcome] = other->max_threat[outcome];
-        else if (this->max_threat.contains(outcome) && other->max_threat.contains(outcome))
-            this->max_threat[outcome] = other->max_threat[outcome] < this->max_threat[outcome] ? other->max_threat[outcome] :
-                                                                                                 this->max_threat[outcome];
+        this->min_threat[outcome] = std::min(this->min_threat[outcome], other->min_threat[outcome]);
+        this->max_threat[outcome] = std::max(this->max_threat[outcome], other->max_threat[outcome]);
     }
 
     if (this->min_dpr > other->min_dpr)
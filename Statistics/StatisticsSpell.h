@@ -1,9 +1,9 @@
 #pragma once
 
-#include <QMap>
-#include <QSet>
 #include <QString>
 #include <QVector>
+#include <array>
+#include <initializer_list>
 
 #include <math.h>
 
@@ -240,8 +240,13 @@ private:
     double avg_tpet;
     bool tpet_set;
 
+    // Outcome is a small dense enum, so each counter is a fixed-size array indexed by outcome.
+    // Outcomes from PartialResist25 and onwards deal damage and threat.
+    static const int NUM_OUTCOMES = Outcome::Crit + 1;
+    static const int FIRST_SUCCESS_OUTCOME = Outcome::PartialResist25;
+
     int get_attempts(const Outcome outcome) const;
-    int get_attempts(const QSet<Outcome>& outcomes) const;
+    int get_attempts(std::initializer_list<Outcome> outcomes) const;
 
     long long get_dmg(const Outcome) const;
     int get_min_dmg(const Outcome) const;
@@ -261,16 +266,13 @@ private:
     void add_tpr(const int thrt, const double resource_cost);
     void add_tpet(const int thrt, const double execution_time);
 
-    QSet<Outcome> possible_attempt_outcomes;
-    QSet<Outcome> possible_success_outcomes;
-
-    QMap<Outcome, int> attempts;
+    std::array<int, NUM_OUTCOMES> attempts;
 
-    QMap<Outcome, long long> damage;
-    QMap<Outcome, int> min_damage;
-    QMap<Outcome, int> max_damage;
+    std::array<long long, NUM_OUTCOMES> damage;
+    std::array<int, NUM_OUTCOMES> min_damage;
+    std::array<int, NUM_OUTCOMES> max_damage;
 
-    QMap<Outcome, long long> threat;
-    QMap<Outcome, int> min_threat;
-    QMap<Outcome, int> max_threat;
+    std::array<long long, NUM_OUTCOMES> threat;
+    std::array<int, NUM_OUTCOMES> min_threat;
+    std::array<int, NUM_OUTCOMES> max_threat;
 };
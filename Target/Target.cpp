@@ -3,7 +3,6 @@
 #include <QDebug>
 
 #include "Buff.h"
-#include "CharacterStats.h"
 #include "Mechanics.h"
 #include "Stats.h"
 #include "Utils/Check.h"
@@ -31,21 +30,13 @@ Target::Target(const unsigned target_lvl) :
                            {CreatureType::Undead, "Undead"}}) {
     stats->increase_armor(base_armor);
 
-    this->magic_school_damage_changes.insert(MagicSchool::Arcane, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Fire, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Frost, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Holy, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Nature, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Physical, {});
-    this->magic_school_damage_changes.insert(MagicSchool::Shadow, {});
-
-    this->magic_school_damage_modifiers.insert(MagicSchool::Arcane, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Fire, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Frost, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Holy, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Nature, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Physical, 1.0);
-    this->magic_school_damage_modifiers.insert(MagicSchool::Shadow, 1.0);
+    this->magic_school_damage_modifiers.insert(MagicSchool::Arcane, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Fire, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Frost, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Holy, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Nature, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Physical, {});
+    this->magic_school_damage_modifiers.insert(MagicSchool::Shadow, {});
 
     this->magic_school_modifier_buffs_with_charges.insert(MagicSchool::Arcane, {});
     this->magic_school_modifier_buffs_with_charges.insert(MagicSchool::Fire, {});
@@ -123,7 +114,7 @@ void Target::decrease_resistance(const MagicSchool school, const int value) {
 }
 
 double Target::get_magic_school_damage_mod(const MagicSchool school, const ConsumeCharge consume_charge) const {
-    const double mod = magic_school_damage_modifiers[school];
+    const double mod = magic_school_damage_modifiers.constFind(school)->get_modifier();
 
     if (consume_charge == ConsumeCharge::Yes) {
         for (auto& buff : magic_school_modifier_buffs_with_charges[school])
@@ -134,11 +125,11 @@ double Target::get_magic_school_damage_mod(const MagicSchool school, const Consu
 }
 
 void Target::increase_magic_school_damage_mod(const int increase, const MagicSchool school) {
-    CharacterStats::add_multiplicative_effect(magic_school_damage_changes[school], increase, magic_school_damage_modifiers[school]);
+    magic_school_damage_modifiers[school].add(increase);
 }
 
 void Target::decrease_magic_school_damage_mod(const int decrease, const MagicSchool school) {
-    CharacterStats::remove_multiplicative_effect(magic_school_damage_changes[school], decrease, magic_school_damage_modifiers[school]);
+    magic_school_damage_modifiers[school].remove(decrease);
 }
 
 unsigned Target::get_spell_damage(const MagicSchool school, const ConsumeCharge consume_charge) const {
@@ -5,6 +5,7 @@
 #include <QVector>
 
 #include "MagicSchools.h"
+#include "Utils/ModifierStack.h"
 
 class Buff;
 class Stats;
@@ -88,8 +89,7 @@ private:
     QMap<QString, CreatureType> string_to_creature_type;
     QMap<CreatureType, QString> creature_type_strings;
     QMap<MagicSchool, int> school_resistances;
-    QMap<MagicSchool, QVector<int>> magic_school_damage_changes;
-    QMap<MagicSchool, double> magic_school_damage_modifiers;
+    QMap<MagicSchool, ModifierStack> magic_school_damage_modifiers;
     QMap<MagicSchool, QVector<Buff*>> magic_school_modifier_buffs_with_charges;
     QVector<Buff*> damage_bonus_buffs_with_charges_for_all_magic_schools;
 
@@ -1,5 +1,8 @@
 #include "TestAttackTables.h"
 
+#include <QElapsedTimer>
+#include <QMap>
+
 #include "CharacterStats.h"
 #include "CombatRoll.h"
 #include "Equipment.h"
@@ -10,10 +13,123 @@
 #include "Orc.h"
 #include "Race.h"
 #include "RaidControl.h"
+#include "RangedWhiteHitTable.h"
 #include "SimSettings.h"
 #include "Target.h"
 #include "Warrior.h"
 #include "Weapon.h"
+#include "xoroshiro128plus.h"
+
+namespace {
+struct Ranges {
+    unsigned miss;
+    unsigned dodge;
+    unsigned parry;
+    unsigned glancing;
+    unsigned block;
+};
+
+const QVector<Ranges> reference_ranges = {
+    {0, 0, 0, 0, 0}, {1, 1, 1, 1, 1}, {2719, 650, 0, 4000, 0}, {800, 650, 1400, 4000, 500}, {6000, 3000, 2000, 1000, 500},
+};
+
+const QVector<unsigned> reference_crit_chances = {0, 1, 2500, 9999, 10000};
+
+// The include flag chains the attack tables evaluated on every roll before the thresholds were precomputed.
+int get_reference_white_outcome(Random* random,
+                                const Ranges& ranges,
+                                const unsigned roll,
+                                const unsigned crit_chance,
+                                const bool include_dodge,
+                                const bool include_parry,
+                                const bool include_block,
+                                const bool include_miss) {
+    unsigned range = 0;
+
+    if (include_miss && roll < ranges.miss)
+        return PhysicalAttackResult::MISS;
+    range += include_miss ? ranges.miss : 0;
+
+    if (include_dodge && roll < (range + ranges.dodge))
+        return PhysicalAttackResult::DODGE;
+    range += include_dodge ? ranges.dodge : 0;
+
+    if (include_parry && roll < (range + ranges.parry))
+        return PhysicalAttackResult::PARRY;
+    range += include_parry ? ranges.parry : 0;
+
+    if (roll < (range + ranges.glancing))
+        return PhysicalAttackResult::GLANCING;
+    range += ranges.glancing;
+
+    if (include_block && roll < (range + ranges.block)) {
+        if (random->get_roll() < range + crit_chance)
+            return PhysicalAttackResult::BLOCK_CRITICAL;
+        return PhysicalAttackResult::BLOCK;
+    }
+    range += include_block ? ranges.block : 0;
+
+    if (roll < range + crit_chance)
+        return PhysicalAttackResult::CRITICAL;
+
+    return PhysicalAttackResult::HIT;
+}
+
+int get_reference_special_outcome(Random* random,
+                                  const Ranges& ranges,
+                                  const unsigned roll,
+                                  const unsigned crit_chance,
+                                  const bool include_dodge,
+                                  const bool include_parry,
+                                  const bool include_block,
+                                  const bool include_miss) {
+    unsigned range = 0;
+
+    if (include_miss && roll < ranges.miss)
+        return PhysicalAttackResult::MISS;
+    range += include_miss ? ranges.miss : 0;
+
+    if (include_dodge && roll < (range + ranges.dodge))
+        return PhysicalAttackResult::DODGE;
+    range += include_dodge ? ranges.dodge : 0;
+
+    if (include_parry && roll < (range + ranges.parry))
+        return PhysicalAttackResult::PARRY;
+    range += include_parry ? ranges.parry : 0;
+
+    if (include_block && roll < (range + ranges.block)) {
+        if (random->get_roll() < static_cast<unsigned>((round(crit_chance * 10000))))
+            return PhysicalAttackResult::BLOCK_CRITICAL;
+        return PhysicalAttackResult::BLOCK;
+    }
+
+    if (random->get_roll() < crit_chance)
+        return PhysicalAttackResult::CRITICAL;
+
+    return PhysicalAttackResult::HIT;
+}
+
+int get_reference_ranged_outcome(
+    Random* random, const Ranges& ranges, const unsigned roll, const unsigned crit_chance, const bool include_block, const bool include_miss) {
+    unsigned range = 0;
+
+    if (include_miss && roll < ranges.miss)
+        return PhysicalAttackResult::MISS;
+    range += include_miss ? ranges.miss : 0;
+
+    if (include_block && roll < (range + ranges.block)) {
+        if (random->get_roll() < range + crit_chance)
+            return PhysicalAttackResult::BLOCK_CRITICAL;
+        return PhysicalAttackResult::BLOCK;
+    }
+    range += include_block ? ranges.block : 0;
+
+    if (roll < range + crit_chance)
+        return PhysicalAttackResult::CRITICAL;
+
+    return PhysicalAttackResult::HIT;
+}
+} // namespace
 
 TestAttackTables::TestAttackTables(EquipmentDb* equipment_db) : TestObject(equipment_db) {}
 
@@ -25,6 +141,13 @@ void TestAttackTables::test_all() {
     test_white_hit_table_update();
     test_special_hit_table();
     test_magic_attack_table();
+    test_white_hit_table_matches_reference();
+    test_special_hit_table_matches_reference();
+    test_ranged_hit_table_matches_reference();
+}
+
+void TestAttackTables::benchmark_all() {
+    benchmark_white_hit_table();
 }
 
 void TestAttackTables::test_values_after_initialization() {}
@@ -178,3 +301,127 @@ void TestAttackTables::test_magic_attack_table() {
     delete mechanics;
     delete table;
 }
+
+void TestAttackTables::test_white_hit_table_matches_reference() {
+    Random table_random(0, 9999);
+    Random reference_random(0, 9999);
+
+    for (const auto& ranges : reference_ranges) {
+        MeleeWhiteHitTable table(&table_random, 300, ranges.miss, double(ranges.dodge) / 10000, double(ranges.parry) / 10000,
+                                 double(ranges.glancing) / 10000, double(ranges.block) / 10000);
+
+        for (int mask = 0; mask < NUM_INCLUDE_MASKS; ++mask) {
+            const bool dodge = mask & 1, parry = mask & 2, block = mask & 4, miss = mask & 8;
+            for (const auto& crit_chance : reference_crit_chances) {
+                table_random.set_gen_from_seed(static_cast<unsigned long long>(mask) + crit_chance);
+                reference_random.set_gen_from_seed(static_cast<unsigned long long>(mask) + crit_chance);
+
+                for (unsigned roll = 0; roll < 10000; ++roll)
+                    assert(table.get_outcome(roll, crit_chance, dodge, parry, block, miss)
+                           == get_reference_white_outcome(&reference_random, ranges, roll, crit_chance, dodge, parry, block, miss));
+            }
+        }
+    }
+}
+
+void TestAttackTables::test_special_hit_table_matches_reference() {
+    Random table_random(0, 9999);
+    Random reference_random(0, 9999);
+
+    for (const auto& ranges : reference_ranges) {
+        MeleeSpecialTable table(&table_random, 300, ranges.miss, double(ranges.dodge) / 10000, double(ranges.parry) / 10000,
+                                double(ranges.block) / 10000);
+
+        for (int mask = 0; mask < NUM_INCLUDE_MASKS; ++mask) {
+            const bool dodge = mask & 1, parry = mask & 2, block = mask & 4, miss = mask & 8;
+            for (const auto& crit_chance : reference_crit_chances) {
+                table_random.set_gen_from_seed(static_cast<unsigned long long>(mask) + crit_chance);
+                reference_random.set_gen_from_seed(static_cast<unsigned long long>(mask) + crit_chance);
+
+                for (unsigned roll = 0; roll < 10000; ++roll)
+                    assert(table.get_outcome(roll, crit_chance, dodge, parry, block, miss)
+                           == get_reference_special_outcome(&reference_random, ranges, roll, crit_chance, dodge, parry, block, miss));
+            }
+        }
+    }
+}
+
+void TestAttackTables::test_ranged_hit_table_matches_reference() {
+    Random table_random(0, 9999);
+    Random reference_random(0, 9999);
+
+    for (const auto& ranges : reference_ranges) {
+        RangedWhiteHitTable table(&table_random, 300, ranges.miss, double(ranges.block) / 10000);
+
+        for (int mask = 0; mask < 4; ++mask) {
+            const bool block = mask & 1, miss = mask & 2;
+            for (const auto& crit_chance : reference_crit_chances) {
+                table_random.set_gen_from_seed(static_cast<unsigned long long>(mask) + crit_chance);
+                reference_random.set_gen_from_seed(static_cast<unsigned long long>(mask) + crit_chance);
+
+                for (unsigned roll = 0; roll < 10000; ++roll)
+                    assert(table.get_outcome(roll, crit_chance, block, miss)
+                           == get_reference_ranged_outcome(&reference_random, ranges, roll, crit_chance, block, miss));
+            }
+        }
+    }
+}
+
+void TestAttackTables::benchmark_white_hit_table() {
+    // Compares a white hit roll as it used to be made (QMap lookup of the table followed by the include flag chain)
+    // with the flat table lookup and precomputed thresholds.
+    const int num_rolls = 10000000;
+    const unsigned crit_chance = 2500;
+    const Ranges ranges {800, 650, 1400, 4000, 500};
+
+    Random random(0, 9999);
+    xoroshiro128plus roll_gen;
+    roll_gen.set_state(4242);
+
+    QVector<unsigned> rolls;
+    QVector<unsigned> wpn_skills;
+    for (int i = 0; i < 4096; ++i) {
+        rolls.append(static_cast<unsigned>(roll_gen.next() % 10000));
+        wpn_skills.append(300 + static_cast<unsigned>(roll_gen.next() % 16));
+    }
+
+    QMap<QPair<unsigned, bool>, Ranges> map_tables;
+    QVector<MeleeWhiteHitTable*> flat_tables;
+    for (unsigned wpn_skill = 300; wpn_skill < 316; ++wpn_skill) {
+        map_tables[{wpn_skill, true}] = ranges;
+
+        flat_tables.resize(static_cast<int>(wpn_skill) * 2 + 2);
+        flat_tables[static_cast<int>(wpn_skill) * 2 + 1] = new MeleeWhiteHitTable(
+            &random, wpn_skill, ranges.miss, double(ranges.dodge) / 10000, double(ranges.parry) / 10000, double(ranges.glancing) / 10000,
+            double(ranges.block) / 10000);
+    }
+
+    long long checksum_reference = 0;
+    random.set_gen_from_seed(4242);
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < num_rolls; ++i) {
+        const QPair<unsigned, bool> key {wpn_skills[i & 4095], true};
+        if (!map_tables.contains(key))
+            continue;
+        checksum_reference += get_reference_white_outcome(&random, map_tables[key], rolls[i & 4095], crit_chance, true, true, true, true);
+    }
+    const double reference_s = static_cast<double>(timer.nsecsElapsed()) / 1000000000;
+
+    long long checksum_table = 0;
+    random.set_gen_from_seed(4242);
+    timer.restart();
+    for (int i = 0; i < num_rolls; ++i) {
+        MeleeWhiteHitTable* table = flat_tables.value(static_cast<int>(wpn_skills[i & 4095]) * 2 + 1, nullptr);
+        if (table == nullptr)
+            continue;
+        checksum_table += table->get_outcome(rolls[i & 4095], crit_chance);
+    }
+    const double table_s = static_cast<double>(timer.nsecsElapsed()) / 1000000000;
+
+    assert(checksum_reference == checksum_table);
+    qDeleteAll(flat_tables);
+
+    qDebug() << "White hit rolls with map lookup and include chain:" << static_cast<qint64>(num_rolls / reference_s) << "rolls/s";
+    qDebug() << "White hit rolls with flat lookup and thresholds:" << static_cast<qint64>(num_rolls / table_s) << "rolls/s";
+}
@@ -7,6 +7,7 @@ public:
     TestAttackTables(EquipmentDb* equipment_db);
 
     void test_all() override;
+    void benchmark_all();
 
 private:
     void test_values_after_initialization() override;
@@ -14,4 +15,9 @@ private:
     void test_white_hit_table_update();
     void test_special_hit_table();
     void test_magic_attack_table();
+    void test_white_hit_table_matches_reference();
+    void test_special_hit_table_matches_reference();
+    void test_ranged_hit_table_matches_reference();
+
+    void benchmark_white_hit_table();
 };
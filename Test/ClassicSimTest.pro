@@ -0,0 +1,340 @@
+# Test suites of the simulation core. Run from a directory prepared with DevTools/copy_to_dir.py, like the
+# command-line simulator, since the suites load the same item data.
+
+QT -= gui
+QT += core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = ClassicSimTest
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# The suites check their results with assert, which NDEBUG would compile out.
+DEFINES -= NDEBUG
+msvc: QMAKE_CXXFLAGS += /UNDEBUG
+else: QMAKE_CXXFLAGS += -UNDEBUG
+
+include(../ClassicSimCore.pri)
+
+SOURCES += \
+    main.cpp \
+    TestRunner.cpp \
+    Druid/Spells/TestBearForm.cpp \
+    Druid/Spells/TestCatForm.cpp \
+    Druid/Spells/TestEnrage.cpp \
+    Druid/Spells/TestFerociousBite.cpp \
+    Druid/Spells/TestMaul.cpp \
+    Druid/Spells/TestMoonfire.cpp \
+    Druid/Spells/TestMoonkinForm.cpp \
+    Druid/Spells/TestShred.cpp \
+    Druid/Spells/TestStarfire.cpp \
+    Druid/Spells/TestSwipe.cpp \
+    Druid/Spells/TestWrath.cpp \
+    Druid/Talents/TestBalance.cpp \
+    Druid/Talents/TestFeralCombat.cpp \
+    Druid/Talents/TestRestorationDruid.cpp \
+    Druid/TestDruid.cpp \
+    Druid/TestSpellDruid.cpp \
+    General/Spells/TestEssenceOfTheRed.cpp \
+    Mage/Spells/TestArcaneMissiles.cpp \
+    Mage/Spells/TestEvocation.cpp \
+    Mage/Spells/TestFireball.cpp \
+    Mage/Spells/TestFrostbolt.cpp \
+    Mage/Spells/TestScorch.cpp \
+    Mage/Talents/TestArcane.cpp \
+    Mage/Talents/TestFire.cpp \
+    Mage/Talents/TestFrost.cpp \
+    Mage/Talents/TestMageTalentStatIncrease.cpp \
+    Mage/TestMage.cpp \
+    Mage/TestSpellMage.cpp \
+    Paladin/Spells/TestConsecration.cpp \
+    Paladin/Spells/TestJudgement.cpp \
+    Paladin/Spells/TestMainhandAttackPaladin.cpp \
+    Paladin/Spells/TestSealOfCommand.cpp \
+    Paladin/Spells/TestSealOfTheCrusader.cpp \
+    Paladin/Talents/TestPaladinTalentStatIncrease.cpp \
+    Paladin/TestSpellPaladin.cpp \
+    Rotation/TestConditionProgram.cpp \
+    Rotation/TestConditionResource.cpp \
+    Shaman/Spells/TestLightningBolt.cpp \
+    Shaman/Spells/TestStormstrike.cpp \
+    Shaman/Talents/TestElemental.cpp \
+    Shaman/Talents/TestEnhancement.cpp \
+    Shaman/Talents/TestRestorationShaman.cpp \
+    Shaman/TestShaman.cpp \
+    Shaman/TestSpellShaman.cpp \
+    Target/TestTarget.cpp \
+    Test.cpp \
+    TestBloodFury.cpp \
+    TestCombatRoll.cpp \
+    TestStatistics.cpp \
+    TestStats.cpp \
+    Warlock/Spells/TestLifeTap.cpp \
+    Warlock/Spells/TestShadowBolt.cpp \
+    Warlock/Talents/TestAffliction.cpp \
+    Warlock/Talents/TestDemonology.cpp \
+    Warlock/Talents/TestDestruction.cpp \
+    Warlock/TestSpellWarlock.cpp \
+    Warlock/TestWarlock.cpp \
+    Warrior/Spells/TestBattleShout.cpp \
+    Warrior/TestWarrior.cpp \
+    Warrior/Spells/TestExecute.cpp \
+    TestSpell.cpp \
+    Warrior/TestSpellWarrior.cpp \
+    Warrior/Spells/TestHeroicStrike.cpp \
+    Warrior/Spells/TestBloodthirst.cpp \
+    Warrior/Spells/TestMainhandAttackWarrior.cpp \
+    Warrior/Spells/TestWhirlwind.cpp \
+    Warrior/Spells/TestOverpower.cpp \
+    TestBuff.cpp \
+    Warrior/Buffs/TestFlurryWarrior.cpp \
+    Warrior/TestBuffWarrior.cpp \
+    Warrior/Spells/TestOffhandAttackWarrior.cpp \
+    Warrior/Spells/TestDeepWounds.cpp \
+    Warrior/Spells/TestBloodrage.cpp \
+    Warrior/Procs/TestUnbridledWrath.cpp \
+    Warrior/TestProcWarrior.cpp \
+    TestProc.cpp \
+    TestEquipmentDbCache.cpp \
+    TestIterationScheduler.cpp \
+    TestQueue.cpp \
+    TestRandom.cpp \
+    TestRunningStatistics.cpp \
+    Warrior/Spells/TestRecklessness.cpp \
+    Warrior/Spells/TestBerserkerStance.cpp \
+    TestSpellDamage.cpp \
+    Warrior/Spells/TestDeathWish.cpp \
+    TestCharacterStats.cpp \
+    TestCheck.cpp \
+    TestModifierStack.cpp \
+    TestEnabledProcs.cpp \
+    TestGearOptimizer.cpp \
+    TestTalentOptimizer.cpp \
+    Warrior/Procs/TestSwordSpecialization.cpp \
+    Warrior/Talents/TestTwoHandedWeaponSpecialization.cpp \
+    Warrior/Spells/TestMortalStrike.cpp \
+    Warrior/Spells/TestSlam.cpp \
+    Warrior/Spells/TestRevenge.cpp \
+    Warrior/Talents/TestFury.cpp \
+    Warrior/Talents/TestDefiance.cpp \
+    Warrior/Talents/TestArms.cpp \
+    General/Procs/TestFelstrikerProc.cpp \
+    Warrior/Spells/TestRend.cpp \
+    Rogue/TestRogue.cpp \
+    Rogue/TestEnergy.cpp \
+    Rogue/TestSpellRogue.cpp \
+    Rogue/Spells/TestBackstab.cpp \
+    Rogue/Spells/TestEviscerate.cpp \
+    Rogue/Spells/TestSliceAndDice.cpp \
+    AttackTables/TestAttackTables.cpp \
+    TestTalentTree.cpp \
+    Rogue/Spells/TestAdrenalineRush.cpp \
+    Rogue/Spells/TestBladeFlurry.cpp \
+    Rogue/Spells/TestSinisterStrike.cpp \
+    Rogue/Procs/TestRelentlessStrikes.cpp \
+    Rogue/TestProcRogue.cpp \
+    Rogue/Procs/TestSealFate.cpp \
+    TestMechanics.cpp \
+    Rotation/TestConditionVariableBuiltin.cpp \
+    Rogue/Talents/TestAssassination.cpp \
+    Rogue/Talents/TestCombat.cpp \
+    Rogue/Talents/TestSubtlety.cpp \
+    Rogue/Spells/TestHemorrhage.cpp \
+    Hunter/Talents/TestBeastMastery.cpp \
+    Hunter/Talents/TestMarksmanship.cpp \
+    Hunter/Talents/TestSurvival.cpp \
+    Hunter/TestHunter.cpp \
+    Hunter/TestSpellHunter.cpp \
+    Hunter/Spells/TestMultiShot.cpp \
+    Hunter/Spells/TestAutoShot.cpp \
+    Hunter/Spells/TestAimedShot.cpp \
+    Hunter/Spells/TestPetAutoAttack.cpp \
+    TestObject.cpp \
+    Rotation/TestRotationFileReader.cpp \
+    TestMana.cpp \
+    Hunter/Talents/TestHunterTalentStatIncrease.cpp \
+    Paladin/TestPaladin.cpp \
+    Paladin/Talents/TestHolyPaladin.cpp \
+    Paladin/Talents/TestProtectionPaladin.cpp \
+    Paladin/Talents/TestRetribution.cpp \
+    Mage/Spells/TestMageArmor.cpp
+
+HEADERS += \
+    TestRunner.h \
+    Druid/Spells/TestBearForm.h \
+    Druid/Spells/TestCatForm.h \
+    Druid/Spells/TestEnrage.h \
+    Druid/Spells/TestFerociousBite.h \
+    Druid/Spells/TestMaul.h \
+    Druid/Spells/TestMoonfire.h \
+    Druid/Spells/TestMoonkinForm.h \
+    Druid/Spells/TestShred.h \
+    Druid/Spells/TestStarfire.h \
+    Druid/Spells/TestSwipe.h \
+    Druid/Spells/TestWrath.h \
+    Druid/Talents/TestBalance.h \
+    Druid/Talents/TestFeralCombat.h \
+    Druid/Talents/TestRestorationDruid.h \
+    Druid/TestDruid.h \
+    Druid/TestSpellDruid.h \
+    General/Spells/TestEssenceOfTheRed.h \
+    Mage/Spells/TestArcaneMissiles.h \
+    Mage/Spells/TestEvocation.h \
+    Mage/Spells/TestFireball.h \
+    Mage/Spells/TestFrostbolt.h \
+    Mage/Spells/TestScorch.h \
+    Mage/Talents/TestArcane.h \
+    Mage/Talents/TestFire.h \
+    Mage/Talents/TestFrost.h \
+    Mage/Talents/TestMageTalentStatIncrease.h \
+    Mage/TestMage.h \
+    Mage/TestSpellMage.h \
+    Paladin/Spells/TestConsecration.h \
+    Paladin/Spells/TestJudgement.h \
+    Paladin/Spells/TestMainhandAttackPaladin.h \
+    Paladin/Spells/TestSealOfCommand.h \
+    Paladin/Spells/TestSealOfTheCrusader.h \
+    Paladin/Talents/TestPaladinTalentStatIncrease.h \
+    Paladin/TestSpellPaladin.h \
+    Rotation/TestConditionProgram.h \
+    Rotation/TestConditionResource.h \
+    Shaman/Spells/TestLightningBolt.h \
+    Shaman/Spells/TestStormstrike.h \
+    Shaman/Talents/TestElemental.h \
+    Shaman/Talents/TestEnhancement.h \
+    Shaman/Talents/TestRestorationShaman.h \
+    Shaman/TestShaman.h \
+    Shaman/TestSpellShaman.h \
+    Target/TestTarget.h \
+    Test.h \
+    TestBloodFury.h \
+    TestCombatRoll.h \
+    TestStatistics.h \
+    TestStats.h \
+    Warlock/Spells/TestLifeTap.h \
+    Warlock/Spells/TestShadowBolt.h \
+    Warlock/Talents/TestAffliction.h \
+    Warlock/Talents/TestDemonology.h \
+    Warlock/Talents/TestDestruction.h \
+    Warlock/TestSpellWarlock.h \
+    Warlock/TestWarlock.h \
+    Warrior/Spells/TestBattleShout.h \
+    Warrior/TestWarrior.h \
+    Warrior/Spells/TestExecute.h \
+    TestSpell.h \
+    Warrior/TestSpellWarrior.h \
+    Warrior/Spells/TestHeroicStrike.h \
+    Warrior/Spells/TestBloodthirst.h \
+    Warrior/Spells/TestMainhandAttackWarrior.h \
+    Warrior/Spells/TestWhirlwind.h \
+    Warrior/Spells/TestOverpower.h \
+    TestBuff.h \
+    Warrior/Buffs/TestFlurryWarrior.h \
+    Warrior/TestBuffWarrior.h \
+    Warrior/Spells/TestOffhandAttackWarrior.h \
+    Warrior/Spells/TestDeepWounds.h \
+    Warrior/Spells/TestBloodrage.h \
+    Warrior/Procs/TestUnbridledWrath.h \
+    Warrior/TestProcWarrior.h \
+    TestProc.h \
+    TestEquipmentDbCache.h \
+    TestIterationScheduler.h \
+    TestQueue.h \
+    TestRandom.h \
+    TestRunningStatistics.h \
+    Warrior/Spells/TestRecklessness.h \
+    Warrior/Spells/TestBerserkerStance.h \
+    TestSpellDamage.h \
+    Warrior/Spells/TestDeathWish.h \
+    TestCharacterStats.h \
+    TestCheck.h \
+    TestModifierStack.h \
+    TestEnabledProcs.h \
+    TestGearOptimizer.h \
+    TestTalentOptimizer.h \
+    Warrior/Procs/TestSwordSpecialization.h \
+    Warrior/Talents/TestTwoHandedWeaponSpecialization.h \
+    TestUtils.h \
+    Warrior/Spells/TestMortalStrike.h \
+    Warrior/Spells/TestSlam.h \
+    Warrior/Spells/TestRevenge.h \
+    Warrior/Talents/TestFury.h \
+    Warrior/Talents/TestDefiance.h \
+    Warrior/Talents/TestArms.h \
+    General/Procs/TestFelstrikerProc.h \
+    Warrior/Spells/TestRend.h \
+    Rogue/TestRogue.h \
+    Rogue/TestEnergy.h \
+    Rogue/TestSpellRogue.h \
+    Rogue/Spells/TestBackstab.h \
+    Rogue/Spells/TestEviscerate.h \
+    Rogue/Spells/TestSliceAndDice.h \
+    AttackTables/TestAttackTables.h \
+    TestTalentTree.h \
+    Rogue/Spells/TestAdrenalineRush.h \
+    Rogue/Spells/TestBladeFlurry.h \
+    Rogue/Spells/TestSinisterStrike.h \
+    Rogue/Procs/TestRelentlessStrikes.h \
+    Rogue/TestProcRogue.h \
+    Rogue/Procs/TestSealFate.h \
+    TestMechanics.h \
+    Rotation/TestConditionVariableBuiltin.h \
+    Rogue/Talents/TestAssassination.h \
+    Rogue/Talents/TestCombat.h \
+    Rogue/Talents/TestSubtlety.h \
+    Rogue/Spells/TestHemorrhage.h \
+    Hunter/Talents/TestBeastMastery.h \
+    Hunter/Talents/TestMarksmanship.h \
+    Hunter/Talents/TestSurvival.h \
+    Hunter/TestHunter.h \
+    Hunter/TestSpellHunter.h \
+    Hunter/Spells/TestMultiShot.h \
+    Hunter/Spells/TestAutoShot.h \
+    Hunter/Spells/TestAimedShot.h \
+    Hunter/Spells/TestPetAutoAttack.h \
+    TestObject.h \
+    Rotation/TestRotationFileReader.h \
+    TestMana.h \
+    Hunter/Talents/TestHunterTalentStatIncrease.h \
+    Paladin/TestPaladin.h \
+    Paladin/Talents/TestHolyPaladin.h \
+    Paladin/Talents/TestProtectionPaladin.h \
+    Paladin/Talents/TestRetribution.h \
+    Mage/Spells/TestMageArmor.h
+
+INCLUDEPATH += \
+    $$PWD \
+    $$PWD/AttackTables \
+    $$PWD/General/Procs \
+    $$PWD/Warrior \
+    $$PWD/Warrior/Spells \
+    $$PWD/Warrior/Buffs \
+    $$PWD/Warrior/Procs \
+    $$PWD/Warrior/Talents \
+    $$PWD/Rogue \
+    $$PWD/Rogue/Procs \
+    $$PWD/Rogue/Spells \
+    $$PWD/Rogue/Talents \
+    $$PWD/Hunter \
+    $$PWD/Hunter/Spells \
+    $$PWD/Hunter/Talents \
+    $$PWD/Paladin \
+    $$PWD/Paladin/Procs \
+    $$PWD/Paladin/Spells \
+    $$PWD/Paladin/Talents \
+    $$PWD/Shaman \
+    $$PWD/Shaman/Procs \
+    $$PWD/Shaman/Spells \
+    $$PWD/Shaman/Talents \
+    $$PWD/Mage \
+    $$PWD/Mage/Spells \
+    $$PWD/Mage/Talents \
+    $$PWD/Druid \
+    $$PWD/Druid/Spells \
+    $$PWD/Druid/Talents \
+    $$PWD/Warlock \
+    $$PWD/Warlock/Spells \
+    $$PWD/Warlock/Talents \
+    $$PWD/Rotation
@@ -0,0 +1,104 @@
+#include "TestPetAutoAttack.h"
+
+#include <cassert>
+
+#include "BeastMastery.h"
+#include "ClassStatistics.h"
+#include "EncounterEnd.h"
+#include "Engine.h"
+#include "EventPool.h"
+#include "Hunter.h"
+#include "Pet.h"
+#include "RaidControl.h"
+#include "Random.h"
+#include "SimSettings.h"
+#include "StatisticsEngine.h"
+
+TestPetAutoAttack::TestPetAutoAttack(EquipmentDb* equipment_db) : TestSpell(equipment_db, "Pet Auto Attack") {}
+
+void TestPetAutoAttack::test_all() {
+    qDebug() << spell_under_test;
+
+    test_fast_forward_matches_event_by_event();
+    test_fast_forward_matches_event_by_event_with_frenzy();
+}
+
+void TestPetAutoAttack::set_up() {
+    set_up_general();
+    hunter = new Hunter(race, equipment_db, sim_settings, raid_control);
+    hunter->set_clvl(60);
+    pchar = hunter;
+}
+
+void TestPetAutoAttack::tear_down() {
+    delete hunter;
+    tear_down_general();
+}
+
+void TestPetAutoAttack::test_fast_forward_matches_event_by_event() {
+    set_up();
+    const EncounterResult event_by_event = when_running_encounter(false);
+    tear_down();
+
+    set_up();
+    const EncounterResult fast_forwarded = when_running_encounter(true);
+    tear_down();
+
+    then_results_match(event_by_event, fast_forwarded);
+}
+
+void TestPetAutoAttack::test_fast_forward_matches_event_by_event_with_frenzy() {
+    set_up();
+    given_5_of_5_frenzy();
+    const EncounterResult event_by_event = when_running_encounter(false);
+    tear_down();
+
+    set_up();
+    given_5_of_5_frenzy();
+    const EncounterResult fast_forwarded = when_running_encounter(true);
+    tear_down();
+
+    then_results_match(event_by_event, fast_forwarded);
+}
+
+void TestPetAutoAttack::given_5_of_5_frenzy() {
+    given_talent_ranks(BeastMastery(hunter), {{"Endurance Training", 5},
+                                              {"Improved Aspect of the Monkey", 5},
+                                              {"Unleashed Fury", 5},
+                                              {"Pathfinding", 2},
+                                              {"Bestial Swiftness", 1},
+                                              {"Improved Mend Pet", 2},
+                                              {"Spirit Bond", 2},
+                                              {"Bestial Discipline", 2},
+                                              {"Improved Revive Pet", 1},
+                                              {"Ferocity", 5},
+                                              {"Frenzy", 5}});
+}
+
+TestPetAutoAttack::EncounterResult TestPetAutoAttack::when_running_encounter(const bool fast_forward_pet_swings) {
+    sim_settings->set_fast_forward_pet_swings(fast_forward_pet_swings);
+    raid_control->prepare_set_of_combat_iterations();
+    pchar->prepare_set_of_combat_iterations();
+
+    // Both runs replay the same random streams, so any divergence comes from the order events were handled in.
+    Random::reseed_generators_on_current_thread(1);
+
+    Engine* engine = pchar->get_engine();
+    engine->prepare_iteration(0);
+    hunter->get_pet()->start_attack();
+    engine->add_event(new (engine->get_event_pool()) EncounterEnd(engine, 300));
+    engine->run();
+
+    return {pchar->get_statistics()->get_total_personal_damage_dealt(), pchar->get_statistics()->get_engine_statistics()->get_list_of_event_pairs()};
+}
+
+void TestPetAutoAttack::then_results_match(const EncounterResult& event_by_event, const EncounterResult& fast_forwarded) {
+    assert(event_by_event.damage_dealt > 0);
+    assert(event_by_event.damage_dealt == fast_forwarded.damage_dealt);
+
+    assert(event_by_event.events.size() == fast_forwarded.events.size());
+    for (int i = 0; i < event_by_event.events.size(); ++i) {
+        assert(event_by_event.events[i].first == fast_forwarded.events[i].first);
+        assert(event_by_event.events[i].second == fast_forwarded.events[i].second);
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <QList>
+#include <QPair>
+
+#include "TestSpell.h"
+
+class Hunter;
+
+class TestPetAutoAttack : public TestSpell {
+public:
+    TestPetAutoAttack(EquipmentDb* equipment_db);
+
+    void test_all();
+
+private:
+    struct EncounterResult {
+        long long damage_dealt;
+        QList<QPair<EventType, unsigned>> events;
+    };
+
+    Hunter* hunter {nullptr};
+
+    void set_up();
+    void tear_down();
+
+    void test_fast_forward_matches_event_by_event();
+    void test_fast_forward_matches_event_by_event_with_frenzy();
+
+    void given_5_of_5_frenzy();
+
+    EncounterResult when_running_encounter(const bool fast_forward_pet_swings);
+
+    void then_results_match(const EncounterResult& event_by_event, const EncounterResult& fast_forwarded);
+};
@@ -14,6 +14,7 @@
 #include "TestHunterTalentStatIncrease.h"
 #include "TestMarksmanship.h"
 #include "TestMultiShot.h"
+#include "TestPetAutoAttack.h"
 #include "TestSurvival.h"
 #include "Weapon.h"
 
@@ -27,6 +28,7 @@ void TestHunter::test_all() {
     TestAimedShot(equipment_db).test_all();
     TestAutoShot(equipment_db).test_all();
     TestMultiShot(equipment_db).test_all();
+    TestPetAutoAttack(equipment_db).test_all();
     TestHunterTalentStatIncrease(equipment_db).test_all();
 
     TestBeastMastery(equipment_db).test_all();
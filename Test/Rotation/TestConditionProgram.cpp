@@ -0,0 +1,198 @@
+#include "TestConditionProgram.h"
+
+#include "ConditionProgram.h"
+#include "ConditionResource.h"
+#include "Orc.h"
+#include "RaidControl.h"
+#include "SimSettings.h"
+#include "Warrior.h"
+
+TestConditionProgram::TestConditionProgram(EquipmentDb* equipment_db) : TestObject(equipment_db) {}
+
+void TestConditionProgram::set_up() {
+    race = new Orc();
+    sim_settings = new SimSettings();
+    raid_control = new RaidControl(sim_settings);
+    pchar = new Warrior(race, equipment_db, sim_settings, raid_control);
+}
+
+void TestConditionProgram::tear_down() {
+    delete pchar;
+    delete race;
+    delete sim_settings;
+    delete raid_control;
+}
+
+void TestConditionProgram::test_all() {
+    qDebug() << "TestConditionProgram";
+    set_up();
+    test_values_after_initialization();
+    tear_down();
+
+    set_up();
+    test_conditions_in_group_must_all_hold();
+    tear_down();
+
+    set_up();
+    test_any_group_fulfills_program();
+    tear_down();
+
+    set_up();
+    test_failing_condition_jumps_to_next_group();
+    tear_down();
+
+    set_up();
+    test_missing_condition_never_holds();
+    tear_down();
+
+    set_up();
+    test_program_matches_condition_groups();
+    tear_down();
+
+    set_up();
+    test_empty_group_is_fulfilled();
+    tear_down();
+}
+
+void TestConditionProgram::test_values_after_initialization() {
+    ConditionProgram program;
+    assert(program.empty());
+    assert(program.size() == 0);
+
+    program.compile({});
+    assert(program.empty());
+    assert(program.is_fulfilled());
+}
+
+void TestConditionProgram::test_conditions_in_group_must_all_hold() {
+    ConditionResource at_least_20(pchar, Comparator::Geq, ResourceType::Rage, 20);
+    ConditionResource at_most_50(pchar, Comparator::Leq, ResourceType::Rage, 50);
+
+    ConditionProgram program;
+    program.compile({{&at_least_20, &at_most_50}});
+    assert(program.size() == 2);
+
+    given_rage(10);
+    assert(!program.is_fulfilled());
+
+    given_rage(20);
+    assert(program.is_fulfilled());
+
+    given_rage(50);
+    assert(program.is_fulfilled());
+
+    given_rage(60);
+    assert(!program.is_fulfilled());
+}
+
+void TestConditionProgram::test_any_group_fulfills_program() {
+    ConditionResource below_10(pchar, Comparator::Less, ResourceType::Rage, 10);
+    ConditionResource above_90(pchar, Comparator::Greater, ResourceType::Rage, 90);
+
+    ConditionProgram program;
+    program.compile({{&below_10}, {&above_90}});
+
+    given_rage(5);
+    assert(program.is_fulfilled());
+
+    given_rage(50);
+    assert(!program.is_fulfilled());
+
+    given_rage(95);
+    assert(program.is_fulfilled());
+}
+
+void TestConditionProgram::test_failing_condition_jumps_to_next_group() {
+    ConditionResource above_90(pchar, Comparator::Greater, ResourceType::Rage, 90);
+    ConditionResource below_10(pchar, Comparator::Less, ResourceType::Rage, 10);
+    ConditionResource exactly_50(pchar, Comparator::Eq, ResourceType::Rage, 50);
+
+    ConditionProgram program;
+    program.compile({{&above_90, &below_10}, {&exactly_50}});
+    assert(program.size() == 3);
+
+    given_rage(95);
+    assert(!program.is_fulfilled());
+
+    given_rage(5);
+    assert(!program.is_fulfilled());
+
+    given_rage(50);
+    assert(program.is_fulfilled());
+}
+
+void TestConditionProgram::test_missing_condition_never_holds() {
+    ConditionResource any_rage(pchar, Comparator::Geq, ResourceType::Rage, 0);
+
+    ConditionProgram program;
+    program.compile({{nullptr}});
+    assert(!program.is_fulfilled());
+
+    program.compile({{&any_rage, nullptr}, {&any_rage}});
+    assert(program.is_fulfilled());
+}
+
+void TestConditionProgram::test_program_matches_condition_groups() {
+    ConditionResource below_30(pchar, Comparator::Less, ResourceType::Rage, 30);
+    ConditionResource at_most_40(pchar, Comparator::Leq, ResourceType::Rage, 40);
+    ConditionResource exactly_45(pchar, Comparator::Eq, ResourceType::Rage, 45);
+    ConditionResource at_least_35(pchar, Comparator::Geq, ResourceType::Rage, 35);
+    ConditionResource above_70(pchar, Comparator::Greater, ResourceType::Rage, 70);
+
+    const QVector<QVector<Condition*>> condition_groups = {
+        {&at_least_35, &at_most_40},
+        {&below_30, &above_70},
+        {&exactly_45},
+        {&above_70, &at_least_35},
+    };
+
+    ConditionProgram program;
+    program.compile(condition_groups);
+
+    for (unsigned rage = 0; rage <= 100; ++rage) {
+        given_rage(rage);
+
+        bool any_group_fulfilled = false;
+        for (const auto& group : condition_groups) {
+            bool group_fulfilled = true;
+            for (const auto& condition : group)
+                group_fulfilled = group_fulfilled && condition->condition_fulfilled();
+            any_group_fulfilled = any_group_fulfilled || group_fulfilled;
+        }
+
+        assert(program.is_fulfilled() == any_group_fulfilled);
+    }
+}
+
+void TestConditionProgram::test_empty_group_is_fulfilled() {
+    ConditionResource above_90(pchar, Comparator::Greater, ResourceType::Rage, 90);
+    ConditionResource below_10(pchar, Comparator::Less, ResourceType::Rage, 10);
+    given_rage(50);
+
+    ConditionProgram program;
+    program.compile({{}});
+    assert(program.empty());
+    assert(program.is_fulfilled());
+
+    program.compile({{}, {&above_90}});
+    assert(program.empty());
+    assert(program.is_fulfilled());
+
+    program.compile({{&above_90}, {}, {&below_10}});
+    assert(program.size() == 1);
+    assert(program.is_fulfilled());
+
+    program.compile({{&above_90, &below_10}, {}});
+    assert(program.is_fulfilled());
+}
+
+void TestConditionProgram::given_rage(const unsigned rage) {
+    const unsigned curr_level = pchar->get_resource_level(ResourceType::Rage);
+
+    if (curr_level < rage)
+        pchar->gain_resource(ResourceType::Rage, rage - curr_level);
+    else if (curr_level > rage)
+        pchar->lose_resource(ResourceType::Rage, curr_level - rage);
+
+    assert(pchar->get_resource_level(ResourceType::Rage) == rage);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "TestObject.h"
+
+class Character;
+class Race;
+class RaidControl;
+class SimSettings;
+
+class TestConditionProgram : TestObject {
+public:
+    TestConditionProgram(EquipmentDb* equipment_db);
+
+    void test_all() override;
+
+private:
+    Character* pchar {nullptr};
+    Race* race {nullptr};
+    RaidControl* raid_control {nullptr};
+    SimSettings* sim_settings {nullptr};
+
+    void set_up();
+    void tear_down();
+
+    void test_values_after_initialization() override;
+    void test_conditions_in_group_must_all_hold();
+    void test_any_group_fulfills_program();
+    void test_failing_condition_jumps_to_next_group();
+    void test_missing_condition_never_holds();
+    void test_program_matches_condition_groups();
+    void test_empty_group_is_fulfilled();
+
+    void given_rage(const unsigned rage);
+};
@@ -35,6 +35,8 @@ void TestRotationFileReader::test_all() {
     set_up_paladin();
     test_paladin_seal_of_the_crusader();
     tear_down();
+
+    test_get_rotation_returns_independent_copies();
 }
 
 TestRotationFileReader::~TestRotationFileReader() {
@@ -180,6 +182,40 @@ void TestRotationFileReader::test_paladin_seal_of_the_crusader() {
     verify_executor_names(rotation, rotation->active_executors, expected_active_executor_names);
 }
 
+void TestRotationFileReader::test_get_rotation_returns_independent_copies() {
+    Rotation* first = RotationFileReader::get_rotation("Warrior", "DW Fury High Rage");
+    Rotation* second = RotationFileReader::get_rotation("Warrior", "DW Fury High Rage");
+    Rotation* listed = get_rotation("DW Fury High Rage");
+
+    assert(first != nullptr);
+    assert(second != nullptr);
+    assert(first != second);
+    assert(first != listed);
+    assert(first->get_description() == listed->get_description());
+    assert(first->get_attack_mode() == listed->get_attack_mode());
+    assert(first->all_executors.size() == listed->all_executors.size());
+
+    for (int i = 0; i < first->all_executors.size(); ++i) {
+        RotationExecutor* executor = first->all_executors[i];
+        assert(executor != second->all_executors[i]);
+        assert(executor->get_spell_name() == second->all_executors[i]->get_spell_name());
+        assert(executor->get_spell_rank() == second->all_executors[i]->get_spell_rank());
+        assert(executor->sentences.size() == second->all_executors[i]->sentences.size());
+
+        for (int j = 0; j < executor->sentences.size(); ++j) {
+            assert(executor->sentences[j] != second->all_executors[i]->sentences[j]);
+            assert(executor->sentences[j]->type_value == second->all_executors[i]->sentences[j]->type_value);
+            assert(executor->sentences[j]->compared_value == second->all_executors[i]->sentences[j]->compared_value);
+        }
+    }
+
+    assert(RotationFileReader::get_rotation("Warrior", "No such rotation") == nullptr);
+    assert(RotationFileReader::get_rotation("Mage", "DW Fury High Rage") == nullptr);
+
+    delete first;
+    delete second;
+}
+
 void TestRotationFileReader::verify_resource_condition(ConditionResource* condition,
                                                        const double cmp_value,
                                                        const Comparator comparator,
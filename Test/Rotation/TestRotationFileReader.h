@@ -29,6 +29,7 @@ private:
     void test_warrior_dw_fury();
     void test_hunter_aimed_shot_multi_shot();
     void test_paladin_seal_of_the_crusader();
+    void test_get_rotation_returns_independent_copies();
 
     Race* race {nullptr};
     SimSettings* sim_settings {nullptr};
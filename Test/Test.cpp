@@ -16,6 +16,7 @@
 #include "Engine.h"
 #include "Equipment.h"
 #include "EquipmentDb.h"
+#include "EventPool.h"
 #include "Faction.h"
 #include "Gnome.h"
 #include "Human.h"
@@ -24,35 +25,17 @@
 #include "Mage.h"
 #include "NightElf.h"
 #include "Orc.h"
+#include "PlayerAction.h"
 #include "Paladin.h"
 #include "Priest.h"
+#include "Queue.h"
 #include "RaidControl.h"
 #include "Random.h"
 #include "Rogue.h"
 #include "Shaman.h"
 #include "SimSettings.h"
+#include "Stats.h"
 #include "Tauren.h"
-#include "Test/General/Spells/TestEssenceOfTheRed.h"
-#include "Test/Target/TestTarget.h"
-#include "TestAttackTables.h"
-#include "TestBloodFury.h"
-#include "TestCharacterStats.h"
-#include "TestCombatRoll.h"
-#include "TestConditionResource.h"
-#include "TestConditionVariableBuiltin.h"
-#include "TestDruid.h"
-#include "TestFelstrikerProc.h"
-#include "TestHunter.h"
-#include "TestMage.h"
-#include "TestMana.h"
-#include "TestMechanics.h"
-#include "TestPaladin.h"
-#include "TestRogue.h"
-#include "TestRotationFileReader.h"
-#include "TestShaman.h"
-#include "TestStats.h"
-#include "TestWarlock.h"
-#include "TestWarrior.h"
 #include "Troll.h"
 #include "Undead.h"
 #include "Utils/CompareDouble.h"
@@ -61,11 +44,7 @@
 #include "WarriorSpells.h"
 #include "Weapon.h"
 
-Test::Test() : equipment_db(new EquipmentDb()) {}
-
-Test::~Test() {
-    delete equipment_db;
-}
+Test::Test(EquipmentDb* equipment_db) : equipment_db(equipment_db) {}
 
 void Test::test_all() {
     qDebug() << "test_character_creation";
@@ -76,30 +55,8 @@ void Test::test_all() {
     test_combat_roll_creation();
     qDebug() << "test_queue";
     test_queue();
-
-    TestMechanics().test_all();
-    TestCombatRoll(equipment_db).test_all();
-    TestTarget().test_all();
-    TestAttackTables(equipment_db).test_all();
-    TestStats().test_all();
-    TestCharacterStats(equipment_db).test_all();
-    TestConditionResource(equipment_db).test_all();
-    TestConditionVariableBuiltin(equipment_db).test_all();
-    TestRotationFileReader().test_all();
-    TestMana(equipment_db).test_all();
-    TestBloodFury(equipment_db).test_all();
-
-    TestWarrior(equipment_db).test_all();
-    TestRogue(equipment_db).test_all();
-    TestHunter(equipment_db).test_all();
-    TestPaladin(equipment_db).test_all();
-    TestShaman(equipment_db).test_all();
-    TestMage(equipment_db).test_all();
-    TestDruid(equipment_db).test_all();
-    TestWarlock(equipment_db).test_all();
-
-    TestFelstrikerProc(equipment_db).test_all();
-    TestEssenceOfTheRed(equipment_db).test_all();
+    qDebug() << "test_event_pool";
+    test_event_pool();
 }
 
 void Test::test_queue() {
@@ -126,6 +83,36 @@ void Test::test_queue() {
     delete raid_control;
 }
 
+void Test::test_event_pool() {
+    auto engine = new Engine();
+    EventPool* pool = engine->get_event_pool();
+
+    for (int i = 0; i < 1000; ++i)
+        engine->add_event(new (pool) PlayerAction(nullptr, i));
+    assert(pool->get_num_live_events() == 1000);
+    assert(pool->get_high_water_mark() == 1000);
+    const unsigned num_slabs = pool->get_num_slabs();
+
+    Event* event = engine->get_queue()->get_next();
+    assert(almost_equal(event->priority, 0.0));
+    delete event;
+    assert(pool->get_num_live_events() == 999);
+
+    engine->prepare_iteration(0);
+    assert(pool->get_num_live_events() == 0);
+    assert(pool->get_high_water_mark() == 1000);
+
+    for (int i = 0; i < 1000; ++i)
+        engine->add_event(new (pool) PlayerAction(nullptr, i));
+    assert(pool->get_num_slabs() == num_slabs);
+
+    auto heap_event = new PlayerAction(nullptr, 0);
+    engine->add_event(heap_event);
+    assert(pool->get_num_live_events() == 1000);
+
+    delete engine;
+}
+
 void Test::test_combat_roll_creation() {
     auto race = new Orc();
     auto sim_settings = new SimSettings();
@@ -171,6 +158,26 @@ void Test::test_equipment_creation() {
     assert(ranged->get_max_dmg() == 129);
     assert(almost_equal(2.5, ranged->get_base_weapon_speed()));
 
+    // Items are copied from the parsed template without re-parsing their stats.
+    const Item* lionheart_template = equipment_db->get_item(12640);
+    Item* lionheart = equipment_db->get_head(12640);
+    assert(lionheart != nullptr);
+    assert(lionheart != lionheart_template);
+    assert(lionheart->get_item_slot() == ItemSlots::HEAD);
+    assert(lionheart->get_stats()->get_armor() == 565);
+    assert(lionheart->get_stats()->get_strength() == 18);
+    assert(lionheart->get_stats()->get_melee_hit_chance() == lionheart_template->get_stats()->get_melee_hit_chance());
+    assert(lionheart->get_stats()->get_melee_crit_chance() == lionheart_template->get_stats()->get_melee_crit_chance());
+    assert(lionheart->get_stat_value_via_flag(ItemStats::Strength) == 18);
+    assert(lionheart->get_stat_value_via_flag(ItemStats::CritChance) == 2);
+    assert(lionheart->get_base_stat_tooltip() == lionheart_template->get_base_stat_tooltip());
+    assert(lionheart->get_equip_effect_tooltip() == lionheart_template->get_equip_effect_tooltip());
+    delete lionheart;
+
+    assert(equipment_db->get_chest(12640) == nullptr);
+    assert(equipment_db->get_melee_weapon(12640) == nullptr);
+    assert(equipment_db->get_head(19103) == nullptr);
+
     delete sim_settings;
     delete race;
     delete pchar;
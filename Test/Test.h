@@ -2,10 +2,10 @@
 
 class EquipmentDb;
 
+// Smoke tests of character, equipment, queue and combat roll creation. The other suites are run by TestRunner.
 class Test {
 public:
-    Test();
-    ~Test();
+    Test(EquipmentDb* equipment_db);
 
     void test_all();
 
@@ -15,5 +15,6 @@ private:
     void test_character_creation();
     void test_equipment_creation();
     void test_queue();
+    void test_event_pool();
     void test_combat_roll_creation();
 };
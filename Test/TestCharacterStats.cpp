@@ -87,6 +87,10 @@ void TestCharacterStats::test_all() {
     set_up();
     test_magic_damage_includes_target_mods();
     tear_down();
+
+    set_up();
+    test_cached_derived_stats_follow_their_inputs();
+    tear_down();
 }
 
 void TestCharacterStats::test_values_after_initialization() {
@@ -412,3 +416,34 @@ void TestCharacterStats::test_magic_damage_includes_target_mods() {
     cstats->decrease_magic_damage_mod_vs_type(Target::CreatureType::Undead, 20);
     assert(almost_equal(cstats->get_magic_school_damage_mod(MagicSchool::Holy), 1.0));
 }
+
+void TestCharacterStats::test_cached_derived_stats_follow_their_inputs() {
+    const unsigned agility = cstats->get_agility();
+    const unsigned mh_crit = cstats->get_mh_crit_chance();
+    const unsigned melee_ap = cstats->get_melee_ap();
+
+    // Warriors gain 1% crit per 20 agility.
+    cstats->increase_agility(20);
+    assert(cstats->get_agility() == agility + 20);
+    assert(cstats->get_mh_crit_chance() == mh_crit + 100);
+    cstats->decrease_agility(20);
+    assert(cstats->get_mh_crit_chance() == mh_crit);
+
+    cstats->add_strength_mod(100);
+    assert(cstats->get_melee_ap() > melee_ap);
+    cstats->remove_strength_mod(100);
+    assert(cstats->get_melee_ap() == melee_ap);
+
+    pchar->get_equipment()->set_mainhand(19362);
+    assert(pchar->get_equipment()->get_mainhand()->get_weapon_type() == WeaponTypes::AXE);
+    const unsigned mh_crit_with_axe = cstats->get_mh_crit_chance();
+    cstats->increase_crit_for_weapon_type(WeaponTypes::AXE, 100);
+    assert(cstats->get_mh_crit_chance() == mh_crit_with_axe + 100);
+
+    // Aura crit is suppressed by 0.6% per level the target is above the character.
+    cstats->increase_melee_aura_crit(300);
+    pchar->get_target()->set_lvl(60);
+    const unsigned mh_crit_vs_same_level = cstats->get_mh_crit_chance();
+    pchar->get_target()->set_lvl(63);
+    assert(cstats->get_mh_crit_chance() == mh_crit_vs_same_level - 180);
+}
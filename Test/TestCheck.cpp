@@ -0,0 +1,113 @@
+#include "TestCheck.h"
+
+#include <cassert>
+#include <string>
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include "Engine.h"
+#include "EventPool.h"
+#include "PlayerAction.h"
+#include "Queue.h"
+#include "Utils/Check.h"
+#include "xoroshiro128plus.h"
+
+void TestCheck::test_all() {
+    qDebug() << "TestCheck";
+    test_failed_check_throws_with_message();
+    test_message_is_only_evaluated_on_failure();
+    test_check_is_a_single_statement();
+    test_hot_check_follows_build_configuration();
+}
+
+void TestCheck::benchmark_all() {
+    benchmark_event_dispatch();
+}
+
+void TestCheck::test_failed_check_throws_with_message() {
+    bool thrown = false;
+    try {
+        check((1 + 1 == 3), "arithmetic is broken");
+    } catch (const std::logic_error& error) {
+        thrown = true;
+        assert(std::string(error.what()) == "arithmetic is broken");
+    }
+
+    assert(thrown);
+}
+
+void TestCheck::test_message_is_only_evaluated_on_failure() {
+    int num_formatted = 0;
+    auto format = [&num_formatted]() {
+        ++num_formatted;
+        return std::string("formatted");
+    };
+
+    check(true, format());
+    hot_check(true, format());
+    assert(num_formatted == 0);
+
+    try {
+        check(false, format());
+    } catch (const std::logic_error&) {
+    }
+    assert(num_formatted == 1);
+}
+
+void TestCheck::test_check_is_a_single_statement() {
+    // Without the do/while wrapper the else would bind to the if inside the macro.
+    bool took_else = false;
+    const bool condition = false;
+    if (condition)
+        check(false, "unreachable");
+    else
+        took_else = true;
+
+    assert(took_else);
+}
+
+void TestCheck::test_hot_check_follows_build_configuration() {
+    int num_evaluated = 0;
+    bool thrown = false;
+    try {
+        hot_check((++num_evaluated == 0), "hot check failed");
+    } catch (const std::logic_error&) {
+        thrown = true;
+    }
+
+    assert(thrown == HOT_CHECKS_ENABLED);
+    assert(num_evaluated == (HOT_CHECKS_ENABLED ? 1 : 0));
+}
+
+void TestCheck::benchmark_event_dispatch() {
+    // Mirrors Engine::run() without acting on the events, so the cost of the per-event
+    // Engine::set_current_priority invariant is not hidden behind spell logic.
+    const int num_actors = 40;
+    const int num_events = 1000000;
+
+    Engine engine;
+    Queue* queue = engine.get_queue();
+    EventPool* pool = engine.get_event_pool();
+    xoroshiro128plus random;
+    random.set_state(54321);
+
+    for (int i = 0; i < num_actors; ++i)
+        queue->push(new (pool) PlayerAction(nullptr, static_cast<double>(random.next() % 3000) / 1000));
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < num_events; ++i) {
+        Event* event = queue->get_next();
+        engine.set_current_priority(event);
+        queue->push(new (pool) PlayerAction(nullptr, event->priority + static_cast<double>(random.next() % 3000) / 1000));
+        delete event;
+    }
+
+    const double elapsed_s = static_cast<double>(timer.nsecsElapsed()) / 1000000000;
+    queue->clear();
+
+    qDebug() << "Event dispatch with hot checks" << (HOT_CHECKS_ENABLED ? "enabled:" : "disabled:")
+             << static_cast<qint64>(num_events / elapsed_s) << "events/s";
+}
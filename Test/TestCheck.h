@@ -0,0 +1,17 @@
+#pragma once
+
+#include "TestUtils.h"
+
+class TestCheck : public TestUtils {
+public:
+    void test_all();
+    void benchmark_all();
+
+private:
+    void test_failed_check_throws_with_message();
+    void test_message_is_only_evaluated_on_failure();
+    void test_check_is_a_single_statement();
+    void test_hot_check_follows_build_configuration();
+
+    void benchmark_event_dispatch();
+};
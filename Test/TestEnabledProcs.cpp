@@ -0,0 +1,147 @@
+#include "TestEnabledProcs.h"
+
+#include "EnabledProcs.h"
+#include "Orc.h"
+#include "Proc.h"
+#include "RaidControl.h"
+#include "SimSettings.h"
+#include "Warrior.h"
+
+namespace {
+class CountingProc : public Proc {
+public:
+    CountingProc(Character* pchar, const QString& name, const QVector<ProcInfo::Source>& proc_sources) :
+        Proc(name, "", 1.0, 0, QVector<Proc*>(), proc_sources, pchar) {}
+
+    int num_performed {0};
+    bool recheck_on_proc {false};
+
+private:
+    void proc_effect() override {
+        ++num_performed;
+
+        if (recheck_on_proc)
+            procs->run_proc_check(curr_proc_source);
+    }
+};
+} // namespace
+
+TestEnabledProcs::TestEnabledProcs(EquipmentDb* equipment_db) : TestObject(equipment_db) {}
+
+void TestEnabledProcs::set_up() {
+    race = new Orc();
+    sim_settings = new SimSettings();
+    raid_control = new RaidControl(sim_settings);
+    pchar = new Warrior(race, equipment_db, sim_settings, raid_control);
+}
+
+void TestEnabledProcs::tear_down() {
+    delete pchar;
+    delete race;
+    delete sim_settings;
+    delete raid_control;
+}
+
+void TestEnabledProcs::test_all() {
+    qDebug() << "TestEnabledProcs";
+    set_up();
+    test_values_after_initialization();
+    tear_down();
+
+    set_up();
+    test_procs_are_only_checked_for_their_sources();
+    tear_down();
+
+    set_up();
+    test_proc_does_not_trigger_itself_recursively();
+    tear_down();
+
+    set_up();
+    test_ignored_proc_is_skipped_in_next_check();
+    tear_down();
+
+    set_up();
+    test_disabled_proc_is_removed_from_all_sources();
+    tear_down();
+}
+
+void TestEnabledProcs::test_values_after_initialization() {
+    CountingProc proc(pchar, "Counting Proc", {ProcInfo::Source::MainhandSwing});
+    assert(!pchar->get_enabled_procs()->proc_enabled(&proc));
+}
+
+void TestEnabledProcs::test_procs_are_only_checked_for_their_sources() {
+    CountingProc mh_proc(pchar, "Mainhand Proc", {ProcInfo::Source::MainhandSwing});
+    CountingProc spell_proc(pchar, "Spell Proc", {ProcInfo::Source::MainhandSpell, ProcInfo::Source::MagicSpell});
+    mh_proc.prepare_set_of_combat_iterations();
+    spell_proc.prepare_set_of_combat_iterations();
+    mh_proc.enable_proc();
+    spell_proc.enable_proc();
+
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::OffhandSwing);
+    assert(mh_proc.num_performed == 0);
+    assert(spell_proc.num_performed == 0);
+
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MainhandSwing);
+    assert(mh_proc.num_performed == 1);
+    assert(spell_proc.num_performed == 0);
+
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MagicSpell);
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MainhandSpell);
+    assert(mh_proc.num_performed == 1);
+    assert(spell_proc.num_performed == 2);
+
+    mh_proc.disable_proc();
+    spell_proc.disable_proc();
+}
+
+void TestEnabledProcs::test_proc_does_not_trigger_itself_recursively() {
+    CountingProc proc(pchar, "Recursive Proc", {ProcInfo::Source::MainhandSwing});
+    proc.recheck_on_proc = true;
+    proc.prepare_set_of_combat_iterations();
+    proc.enable_proc();
+
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MainhandSwing);
+    assert(proc.num_performed == 1);
+
+    // The guard only lasts for the outermost check.
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MainhandSwing);
+    assert(proc.num_performed == 2);
+
+    proc.disable_proc();
+}
+
+void TestEnabledProcs::test_ignored_proc_is_skipped_in_next_check() {
+    CountingProc proc(pchar, "Ignored Proc", {ProcInfo::Source::MainhandSwing});
+    proc.prepare_set_of_combat_iterations();
+    proc.enable_proc();
+
+    pchar->get_enabled_procs()->ignore_proc_in_next_proc_check(proc.get_instance_id());
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MainhandSwing);
+    assert(proc.num_performed == 0);
+
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MainhandSwing);
+    assert(proc.num_performed == 1);
+
+    proc.disable_proc();
+}
+
+void TestEnabledProcs::test_disabled_proc_is_removed_from_all_sources() {
+    CountingProc first(pchar, "First Proc", {ProcInfo::Source::MainhandSwing, ProcInfo::Source::OffhandSwing});
+    CountingProc second(pchar, "Second Proc", {ProcInfo::Source::MainhandSwing, ProcInfo::Source::OffhandSwing});
+    first.prepare_set_of_combat_iterations();
+    second.prepare_set_of_combat_iterations();
+    first.enable_proc();
+    second.enable_proc();
+
+    first.disable_proc();
+    assert(!pchar->get_enabled_procs()->proc_enabled(&first));
+    assert(pchar->get_enabled_procs()->proc_enabled(&second));
+
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::MainhandSwing);
+    pchar->get_enabled_procs()->run_proc_check(ProcInfo::Source::OffhandSwing);
+    assert(first.num_performed == 0);
+    assert(second.num_performed == 2);
+
+    second.disable_proc();
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "TestObject.h"
+
+class Character;
+class Race;
+class RaidControl;
+class SimSettings;
+
+class TestEnabledProcs : TestObject {
+public:
+    TestEnabledProcs(EquipmentDb* equipment_db);
+
+    void test_all() override;
+
+private:
+    Character* pchar {nullptr};
+    Race* race {nullptr};
+    RaidControl* raid_control {nullptr};
+    SimSettings* sim_settings {nullptr};
+
+    void set_up();
+    void tear_down();
+
+    void test_values_after_initialization() override;
+    void test_procs_are_only_checked_for_their_sources();
+    void test_proc_does_not_trigger_itself_recursively();
+    void test_ignored_proc_is_skipped_in_next_check();
+    void test_disabled_proc_is_removed_from_all_sources();
+};
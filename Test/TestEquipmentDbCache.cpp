@@ -0,0 +1,141 @@
+#include "TestEquipmentDbCache.h"
+
+#include <cassert>
+
+#include <QDebug>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "EquipmentDb.h"
+#include "EquipmentDbCache.h"
+#include "ItemStatsEnum.h"
+#include "Projectile.h"
+#include "Stats.h"
+#include "Weapon.h"
+
+TestEquipmentDbCache::TestEquipmentDbCache(EquipmentDb* equipment_db) : TestObject(equipment_db) {}
+
+void TestEquipmentDbCache::test_all() {
+    qDebug() << "TestEquipmentDbCache";
+    test_values_after_initialization();
+    test_round_trip_preserves_items_and_set_bonuses();
+    test_stale_checksum_is_rejected();
+    test_corrupt_cache_is_rejected();
+    test_checksum_depends_on_source_contents();
+}
+
+void TestEquipmentDbCache::test_values_after_initialization() {
+    QTemporaryDir dir;
+    EquipmentDbCache cache(dir.filePath("equipment_db.bin"), nullptr);
+
+    QVector<Item*> items;
+    QMap<int, QString> possible_set_items;
+    QMap<QString, QVector<QPair<int, QString>>> set_bonus_tooltips;
+    QMap<QString, QMap<int, QPair<ItemStats, unsigned>>> set_bonus_effects;
+
+    assert(!cache.read(QByteArray("checksum"), items, possible_set_items, set_bonus_tooltips, set_bonus_effects));
+    assert(items.empty());
+}
+
+void TestEquipmentDbCache::test_round_trip_preserves_items_and_set_bonuses() {
+    QTemporaryDir dir;
+    EquipmentDbCache cache(dir.filePath("equipment_db.bin"), equipment_db->enchant_info);
+
+    // Lionheart Helm, Frostbite and Accurate Slugs.
+    const QVector<Item*> templates {equipment_db->get_item(12640), equipment_db->get_item(19103), equipment_db->get_item(11284)};
+    assert(cache.write(QByteArray("checksum"), templates, equipment_db->get_possible_set_items(), equipment_db->get_set_bonus_tooltips(),
+                       equipment_db->get_set_bonus_effects()));
+
+    QVector<Item*> items;
+    QMap<int, QString> possible_set_items;
+    QMap<QString, QVector<QPair<int, QString>>> set_bonus_tooltips;
+    QMap<QString, QMap<int, QPair<ItemStats, unsigned>>> set_bonus_effects;
+    assert(cache.read(QByteArray("checksum"), items, possible_set_items, set_bonus_tooltips, set_bonus_effects));
+    assert(items.size() == templates.size());
+
+    for (int i = 0; i < items.size(); ++i) {
+        assert(items[i]->name == templates[i]->name);
+        assert(items[i]->item_id == templates[i]->item_id);
+        assert(items[i]->phase == templates[i]->phase);
+        assert(items[i]->get_item_slot() == templates[i]->get_item_slot());
+        assert(items[i]->get_item_type() == templates[i]->get_item_type());
+        assert(items[i]->get_value("icon") == templates[i]->get_value("icon"));
+        assert(items[i]->get_base_stat_tooltip() == templates[i]->get_base_stat_tooltip());
+        assert(items[i]->get_equip_effect_tooltip() == templates[i]->get_equip_effect_tooltip());
+        assert(items[i]->get_stats()->get_strength() == templates[i]->get_stats()->get_strength());
+        assert(items[i]->get_stats()->get_armor() == templates[i]->get_stats()->get_armor());
+        assert(items[i]->get_stats()->get_melee_crit_chance() == templates[i]->get_stats()->get_melee_crit_chance());
+    }
+
+    auto weapon = dynamic_cast<Weapon*>(items[1]);
+    auto weapon_template = static_cast<Weapon*>(templates[1]);
+    assert(weapon != nullptr);
+    assert(weapon->get_weapon_type() == weapon_template->get_weapon_type());
+    assert(weapon->get_weapon_slot() == weapon_template->get_weapon_slot());
+    assert(weapon->get_min_dmg() == weapon_template->get_min_dmg());
+    assert(weapon->get_max_dmg() == weapon_template->get_max_dmg());
+    assert(almost_equal(weapon->get_base_weapon_speed(), weapon_template->get_base_weapon_speed()));
+
+    auto projectile = dynamic_cast<Projectile*>(items[2]);
+    assert(projectile != nullptr);
+    assert(projectile->get_projectile_type() == static_cast<Projectile*>(templates[2])->get_projectile_type());
+    assert(almost_equal(projectile->get_projectile_dps(), 13.0));
+
+    assert(!possible_set_items.empty());
+    assert(possible_set_items == equipment_db->get_possible_set_items());
+    assert(set_bonus_tooltips == equipment_db->get_set_bonus_tooltips());
+    assert(set_bonus_effects == equipment_db->get_set_bonus_effects());
+
+    qDeleteAll(items);
+}
+
+void TestEquipmentDbCache::test_stale_checksum_is_rejected() {
+    QTemporaryDir dir;
+    EquipmentDbCache cache(dir.filePath("equipment_db.bin"), equipment_db->enchant_info);
+    assert(cache.write(QByteArray("checksum"), {equipment_db->get_item(12640)}, {}, {}, {}));
+
+    QVector<Item*> items;
+    QMap<int, QString> possible_set_items;
+    QMap<QString, QVector<QPair<int, QString>>> set_bonus_tooltips;
+    QMap<QString, QMap<int, QPair<ItemStats, unsigned>>> set_bonus_effects;
+    assert(!cache.read(QByteArray("other checksum"), items, possible_set_items, set_bonus_tooltips, set_bonus_effects));
+    assert(items.empty());
+}
+
+void TestEquipmentDbCache::test_corrupt_cache_is_rejected() {
+    QTemporaryDir dir;
+    const QString path = dir.filePath("equipment_db.bin");
+    EquipmentDbCache cache(path, equipment_db->enchant_info);
+    assert(cache.write(QByteArray("checksum"), {equipment_db->get_item(12640), equipment_db->get_item(19103)}, {}, {}, {}));
+
+    QFile file(path);
+    assert(file.open(QFile::ReadWrite));
+    assert(file.resize(file.size() / 2));
+    file.close();
+
+    QVector<Item*> items;
+    QMap<int, QString> possible_set_items;
+    QMap<QString, QVector<QPair<int, QString>>> set_bonus_tooltips;
+    QMap<QString, QMap<int, QPair<ItemStats, unsigned>>> set_bonus_effects;
+    assert(!cache.read(QByteArray("checksum"), items, possible_set_items, set_bonus_tooltips, set_bonus_effects));
+    assert(items.empty());
+}
+
+void TestEquipmentDbCache::test_checksum_depends_on_source_contents() {
+    QTemporaryDir dir;
+    const QString path = dir.filePath("items.xml");
+
+    QFile file(path);
+    assert(file.open(QFile::WriteOnly));
+    file.write("<items/>");
+    file.close();
+
+    const QByteArray checksum = EquipmentDbCache::get_checksum({path});
+    assert(checksum == EquipmentDbCache::get_checksum({path}));
+
+    assert(file.open(QFile::WriteOnly));
+    file.write("<items></items>");
+    file.close();
+
+    assert(checksum != EquipmentDbCache::get_checksum({path}));
+}
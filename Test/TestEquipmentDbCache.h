@@ -0,0 +1,17 @@
+#pragma once
+
+#include "TestObject.h"
+
+class TestEquipmentDbCache : TestObject {
+public:
+    TestEquipmentDbCache(EquipmentDb* equipment_db);
+
+    void test_all() override;
+
+private:
+    void test_values_after_initialization() override;
+    void test_round_trip_preserves_items_and_set_bonuses();
+    void test_stale_checksum_is_rejected();
+    void test_corrupt_cache_is_rejected();
+    void test_checksum_depends_on_source_contents();
+};
@@ -0,0 +1,223 @@
+#include "TestGearOptimizer.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "CharacterEncoder.h"
+#include "CharacterSpells.h"
+#include "Equipment.h"
+#include "EquipmentDb.h"
+#include "EvaluatorPool.h"
+#include "GearOptimizer.h"
+#include "Item.h"
+#include "Orc.h"
+#include "RaidControl.h"
+#include "RotationFileReader.h"
+#include "SetupEvaluator.h"
+#include "SimSettings.h"
+#include "Utils/Check.h"
+#include "Warrior.h"
+#include "Weapon.h"
+
+TestGearOptimizer::TestGearOptimizer(EquipmentDb* equipment_db) : TestObject(equipment_db) {}
+
+void TestGearOptimizer::set_up() {
+    create_test_items();
+
+    race = new Orc();
+    sim_settings = new SimSettings();
+    sim_settings->set_combat_length(60);
+    raid_control = new RaidControl(sim_settings);
+    pchar = new Warrior(race, equipment_db, sim_settings, raid_control);
+}
+
+void TestGearOptimizer::tear_down() {
+    delete pchar;
+    delete race;
+    delete sim_settings;
+    delete raid_control;
+}
+
+void TestGearOptimizer::create_test_items() {
+    // Suites run in processes of their own, so the test items exist only if this suite adds them.
+    if (equipment_db->get_melee_weapon(TestUtils::Test100Dmg2h) == nullptr)
+        equipment_db->add_melee_weapon(new Weapon("Test 100 dmg 2h", TestUtils::Test100Dmg2h, Content::Phase::MoltenCore, WeaponTypes::TWOHAND_SWORD,
+                                                  WeaponSlots::TWOHAND, 100, 100, 3.5, equipment_db->enchant_info));
+
+    const QVector<QPair<int, QString>> sword_skill_rings = {
+        {TestUtils::Test5SwordSkill, "5"}, {TestUtils::Test10SwordSkill, "10"}, {TestUtils::Test15SwordSkill, "15"}};
+    for (const auto& ring : sword_skill_rings) {
+        if (equipment_db->get_ring(ring.first) != nullptr)
+            continue;
+
+        QMap<QString, QString> info = {{"slot", "RING"}};
+        QVector<QPair<QString, QString>> stats = {{"SWORD_SKILL", ring.second}};
+        equipment_db->add_ring(
+            new Item(QString("Test +%1 Sword Skill").arg(ring.second), ring.first, Content::Phase::MoltenCore, equipment_db->enchant_info, info, stats));
+    }
+}
+
+QString TestGearOptimizer::get_setup_string() {
+    pchar->get_spells()->set_rotation(RotationFileReader::get_rotation("Warrior", "2h Fury"));
+    return CharacterEncoder(pchar).get_current_setup_string();
+}
+
+void TestGearOptimizer::test_all() {
+    qDebug() << "TestGearOptimizer";
+    set_up();
+    test_values_after_initialization();
+    tear_down();
+
+    set_up();
+    test_equip_gear_equips_difference_to_gear_set();
+    tear_down();
+
+    set_up();
+    test_equip_gear_restores_offhand_cleared_by_two_hander();
+    tear_down();
+
+    set_up();
+    test_weighted_score_counts_option_increments();
+    tear_down();
+
+    set_up();
+    test_run_keeps_swap_that_beats_current_gear();
+    tear_down();
+
+    set_up();
+    test_run_keeps_current_gear_when_no_swap_beats_it();
+    tear_down();
+
+    set_up();
+    test_run_fails_when_setup_does_not_load();
+    tear_down();
+
+    set_up();
+    test_pool_returns_error_of_failing_task();
+    tear_down();
+}
+
+void TestGearOptimizer::test_values_after_initialization() {
+    GearSet gear = GearOptimizer::get_gear(pchar->get_equipment());
+
+    assert(gear.size() == GearOptimizer::NUM_SLOTS);
+    for (const auto& item : gear)
+        assert(item.item_id == -1);
+}
+
+void TestGearOptimizer::test_equip_gear_equips_difference_to_gear_set() {
+    Equipment* equipment = pchar->get_equipment();
+    equipment->set_mainhand(19103);
+    equipment->set_ring1(TestUtils::Test5SwordSkill);
+    equipment->set_ring2(TestUtils::Test10SwordSkill);
+    Weapon* mainhand = equipment->get_mainhand();
+
+    GearSet gear = GearOptimizer::get_gear(equipment);
+    gear[EquipmentSlot::RING2].item_id = TestUtils::Test15SwordSkill;
+    gear[EquipmentSlot::OFFHAND].item_id = 17075;
+    GearOptimizer::equip_gear(equipment, gear);
+
+    assert(GearOptimizer::get_gear(equipment) == gear);
+    // Slots that already hold the right item are left alone.
+    assert(equipment->get_mainhand() == mainhand);
+    assert(equipment->get_ring1()->item_id == TestUtils::Test5SwordSkill);
+    assert(equipment->get_ring2()->item_id == TestUtils::Test15SwordSkill);
+}
+
+void TestGearOptimizer::test_equip_gear_restores_offhand_cleared_by_two_hander() {
+    Equipment* equipment = pchar->get_equipment();
+    equipment->set_mainhand(19103);
+    equipment->set_offhand(17075);
+    const GearSet dual_wield_gear = GearOptimizer::get_gear(equipment);
+
+    GearSet two_hand_gear = dual_wield_gear;
+    two_hand_gear[EquipmentSlot::MAINHAND].item_id = TestUtils::Test100Dmg2h;
+    two_hand_gear[EquipmentSlot::OFFHAND].item_id = -1;
+    GearOptimizer::equip_gear(equipment, two_hand_gear);
+
+    assert(GearOptimizer::get_gear(equipment) == two_hand_gear);
+    assert(equipment->get_offhand() == nullptr);
+
+    GearOptimizer::equip_gear(equipment, dual_wield_gear);
+
+    assert(GearOptimizer::get_gear(equipment) == dual_wield_gear);
+    assert(equipment->get_offhand()->item_id == 17075);
+}
+
+void TestGearOptimizer::test_weighted_score_counts_option_increments() {
+    Equipment* equipment = pchar->get_equipment();
+    equipment->set_ring1(TestUtils::Test10SwordSkill);
+
+    GearOptimizer optimizer(equipment_db, nullptr);
+    assert(almost_equal(0.0, optimizer.get_weighted_score(equipment->get_ring1())));
+
+    optimizer.set_stat_weights({{SimOption::Name::ScaleSwordSkill, 3.0}, {SimOption::Name::ScaleAxeSkill, 5.0}});
+    assert(almost_equal(30.0, optimizer.get_weighted_score(equipment->get_ring1())));
+}
+
+void TestGearOptimizer::test_run_keeps_swap_that_beats_current_gear() {
+    EvaluatorPool pool(equipment_db, nullptr, sim_settings, get_setup_string(), 1);
+    assert(pool.successful());
+
+    GearOptimizer optimizer(equipment_db, &pool);
+    optimizer.set_candidates(EquipmentSlot::MAINHAND, {TestUtils::Test100Dmg2h});
+    optimizer.set_iterations(20);
+    optimizer.set_verify_iterations(100);
+
+    GearOptimizerResult result = optimizer.run();
+
+    assert(result.success);
+    assert(result.error.isEmpty());
+    assert(result.swaps.size() == 1);
+    assert(result.swaps[0].equipment_slot == EquipmentSlot::MAINHAND);
+    assert(result.swaps[0].item_id == TestUtils::Test100Dmg2h);
+    assert(result.best_dps > result.base_dps);
+    // The second round has no swap left to try.
+    assert(result.rounds == 1);
+    assert(QJsonDocument::fromJson(result.best_setup_string.toUtf8()).object()["MAINHAND"].toString() == QString::number(TestUtils::Test100Dmg2h));
+}
+
+void TestGearOptimizer::test_run_keeps_current_gear_when_no_swap_beats_it() {
+    pchar->get_equipment()->set_mainhand(TestUtils::Test100Dmg2h);
+    pchar->get_equipment()->set_ring1(TestUtils::Test15SwordSkill);
+    EvaluatorPool pool(equipment_db, nullptr, sim_settings, get_setup_string(), 1);
+    assert(pool.successful());
+
+    GearOptimizer optimizer(equipment_db, &pool);
+    optimizer.set_candidates(EquipmentSlot::RING1, {TestUtils::Test5SwordSkill, TestUtils::Test15SwordSkill});
+    optimizer.set_iterations(20);
+    optimizer.set_verify_iterations(100);
+
+    GearOptimizerResult result = optimizer.run();
+
+    assert(result.success);
+    assert(result.swaps.empty());
+    assert(result.rounds == 1);
+    assert(almost_equal(result.base_dps, result.best_dps));
+}
+
+void TestGearOptimizer::test_run_fails_when_setup_does_not_load() {
+    QJsonObject setup = QJsonDocument::fromJson(get_setup_string().toUtf8()).object();
+    setup["ROTATION"] = "No such rotation";
+    EvaluatorPool pool(equipment_db, nullptr, sim_settings, QJsonDocument(setup).toJson(), 1);
+    assert(!pool.successful());
+
+    GearOptimizer optimizer(equipment_db, &pool);
+    GearOptimizerResult result = optimizer.run();
+
+    assert(!result.success);
+    assert(!result.error.isEmpty());
+    assert(result.swaps.empty());
+}
+
+void TestGearOptimizer::test_pool_returns_error_of_failing_task() {
+    EvaluatorPool pool(equipment_db, nullptr, sim_settings, get_setup_string(), 2);
+    assert(pool.successful());
+
+    auto fail_second_task = [](SetupEvaluator&, const int index) { check((index != 1), "Second task failed"); };
+    assert(!pool.run(3, fail_second_task));
+    assert(pool.get_error() == "Second task failed");
+
+    // Later work is refused rather than run on evaluators left in an unknown state.
+    assert(!pool.run(1, [](SetupEvaluator&, const int) {}));
+}
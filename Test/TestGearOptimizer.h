@@ -0,0 +1,38 @@
+#pragma once
+
+#include <QString>
+
+#include "TestObject.h"
+
+class Character;
+class Race;
+class RaidControl;
+class SimSettings;
+
+class TestGearOptimizer : TestObject {
+public:
+    TestGearOptimizer(EquipmentDb* equipment_db);
+
+    void test_all() override;
+
+private:
+    Character* pchar {nullptr};
+    Race* race {nullptr};
+    RaidControl* raid_control {nullptr};
+    SimSettings* sim_settings {nullptr};
+
+    void set_up();
+    void tear_down();
+
+    void create_test_items();
+    QString get_setup_string();
+
+    void test_values_after_initialization() override;
+    void test_equip_gear_equips_difference_to_gear_set();
+    void test_equip_gear_restores_offhand_cleared_by_two_hander();
+    void test_weighted_score_counts_option_increments();
+    void test_run_keeps_swap_that_beats_current_gear();
+    void test_run_keeps_current_gear_when_no_swap_beats_it();
+    void test_run_fails_when_setup_does_not_load();
+    void test_pool_returns_error_of_failing_task();
+};
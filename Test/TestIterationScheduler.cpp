@@ -0,0 +1,165 @@
+#include "TestIterationScheduler.h"
+
+#include <cassert>
+
+#include <QAtomicInt>
+#include <QDebug>
+#include <QThread>
+
+#include "IterationScheduler.h"
+
+void TestIterationScheduler::test_all() {
+    qDebug() << "TestIterationScheduler";
+    test_exact_number_of_iterations_is_handed_out_per_option();
+    test_batches_cover_every_iteration_number_once();
+    test_batch_size_scales_with_iterations_and_threads();
+    test_unknown_option_has_no_iterations();
+    test_runners_start_on_different_options();
+    test_converged_option_stops_handing_out_batches();
+    test_concurrent_claims_hand_out_exact_number_of_iterations();
+}
+
+void TestIterationScheduler::test_exact_number_of_iterations_is_handed_out_per_option() {
+    IterationScheduler scheduler;
+    const QList<SimOption::Name> options {SimOption::Name::NoScale, SimOption::Name::ScaleAgility, SimOption::Name::ScaleStrength};
+
+    // 1001 iterations over 3 threads does not divide evenly; the remainder must still be handed out.
+    scheduler.prepare(options, 1001, 3);
+
+    for (const auto& option : options) {
+        int claimed = 0;
+        int batch = scheduler.claim_batch(option);
+        while (batch > 0) {
+            assert(batch <= scheduler.get_batch_size());
+            claimed += batch;
+            batch = scheduler.claim_batch(option);
+        }
+
+        assert(claimed == 1001);
+        assert(scheduler.get_remaining_iterations(option) == 0);
+        assert(scheduler.claim_batch(option) == 0);
+    }
+}
+
+void TestIterationScheduler::test_batches_cover_every_iteration_number_once() {
+    IterationScheduler scheduler;
+    scheduler.prepare({SimOption::Name::NoScale}, 333, 2);
+
+    QVector<bool> seen(333, false);
+    int first_iteration = -1;
+    int batch = scheduler.claim_batch(SimOption::Name::NoScale, first_iteration);
+    while (batch > 0) {
+        for (int i = first_iteration; i < first_iteration + batch; ++i) {
+            assert(!seen[i]);
+            seen[i] = true;
+        }
+        batch = scheduler.claim_batch(SimOption::Name::NoScale, first_iteration);
+    }
+
+    assert(!seen.contains(false));
+}
+
+void TestIterationScheduler::test_batch_size_scales_with_iterations_and_threads() {
+    IterationScheduler scheduler;
+
+    scheduler.prepare({SimOption::Name::NoScale}, 10000, 4);
+    assert(scheduler.get_batch_size() == 10000 / (4 * IterationScheduler::BATCHES_PER_THREAD));
+
+    scheduler.prepare({SimOption::Name::NoScale}, 5, 4);
+    assert(scheduler.get_batch_size() == 1);
+    assert(scheduler.get_remaining_iterations(SimOption::Name::NoScale) == 5);
+}
+
+void TestIterationScheduler::test_unknown_option_has_no_iterations() {
+    IterationScheduler scheduler;
+    scheduler.prepare({SimOption::Name::NoScale}, 100, 1);
+
+    assert(scheduler.claim_batch(SimOption::Name::ScaleAgility) == 0);
+    assert(scheduler.get_remaining_iterations(SimOption::Name::ScaleAgility) == 0);
+}
+
+void TestIterationScheduler::test_runners_start_on_different_options() {
+    IterationScheduler scheduler;
+    const QList<SimOption::Name> options {SimOption::Name::NoScale, SimOption::Name::ScaleAgility, SimOption::Name::ScaleStrength};
+    scheduler.prepare(options, 100, 4);
+
+    assert(scheduler.get_options_for_next_runner() == options);
+    assert(scheduler.get_options_for_next_runner()
+           == QList<SimOption::Name>({SimOption::Name::ScaleAgility, SimOption::Name::ScaleStrength, SimOption::Name::NoScale}));
+    assert(scheduler.get_options_for_next_runner()
+           == QList<SimOption::Name>({SimOption::Name::ScaleStrength, SimOption::Name::NoScale, SimOption::Name::ScaleAgility}));
+    assert(scheduler.get_options_for_next_runner() == options);
+
+    scheduler.prepare(options, 100, 4);
+    assert(scheduler.get_options_for_next_runner() == options);
+}
+
+void TestIterationScheduler::test_converged_option_stops_handing_out_batches() {
+    IterationScheduler scheduler;
+    scheduler.prepare({SimOption::Name::NoScale, SimOption::Name::ScaleAgility}, 10000, 1);
+    scheduler.set_target_confidence_interval(1.0);
+
+    // Samples alternating between 990 and 1010 DPS have a standard deviation of 10, so the 95% CI
+    // drops below 1 DPS after 385 iterations.
+    int iterations_run = 0;
+    int batch = scheduler.claim_batch(SimOption::Name::NoScale);
+    bool converged = false;
+    while (batch > 0) {
+        RunningStatistics batch_dps;
+        for (int i = 0; i < batch; ++i, ++iterations_run)
+            batch_dps.add(iterations_run % 2 == 0 ? 990.0 : 1010.0);
+
+        converged = scheduler.add_batch_result(SimOption::Name::NoScale, batch_dps);
+        if (converged)
+            break;
+        batch = scheduler.claim_batch(SimOption::Name::NoScale);
+    }
+
+    assert(converged);
+    assert(iterations_run >= 385);
+    assert(iterations_run < 385 + scheduler.get_batch_size());
+    assert(scheduler.claim_batch(SimOption::Name::NoScale) == 0);
+    assert(scheduler.get_dps_statistics(SimOption::Name::NoScale).get_count() == iterations_run);
+
+    assert(scheduler.get_remaining_iterations(SimOption::Name::ScaleAgility) == 10000);
+
+    IterationScheduler fixed_count;
+    fixed_count.prepare({SimOption::Name::NoScale}, 1000, 1);
+    RunningStatistics constant_dps;
+    for (int i = 0; i < 500; ++i)
+        constant_dps.add(1000.0);
+    assert(!fixed_count.add_batch_result(SimOption::Name::NoScale, constant_dps));
+    assert(fixed_count.get_remaining_iterations(SimOption::Name::NoScale) == 1000);
+}
+
+void TestIterationScheduler::test_concurrent_claims_hand_out_exact_number_of_iterations() {
+    IterationScheduler scheduler;
+    const QList<SimOption::Name> options {SimOption::Name::NoScale, SimOption::Name::ScaleCritChance};
+    const int num_threads = 4;
+    const int iterations = 12347;
+    scheduler.prepare(options, iterations, num_threads);
+
+    QAtomicInt claimed_no_scale(0);
+    QAtomicInt claimed_crit(0);
+
+    QVector<QThread*> threads;
+    for (int i = 0; i < num_threads; ++i) {
+        threads.append(QThread::create([&scheduler, &claimed_no_scale, &claimed_crit]() {
+            int batch = 0;
+            while ((batch = scheduler.claim_batch(SimOption::Name::NoScale)) > 0)
+                claimed_no_scale.fetchAndAddOrdered(batch);
+            while ((batch = scheduler.claim_batch(SimOption::Name::ScaleCritChance)) > 0)
+                claimed_crit.fetchAndAddOrdered(batch);
+        }));
+    }
+
+    for (const auto& thread : threads)
+        thread->start();
+    for (const auto& thread : threads) {
+        thread->wait();
+        delete thread;
+    }
+
+    assert(claimed_no_scale.loadAcquire() == iterations);
+    assert(claimed_crit.loadAcquire() == iterations);
+}
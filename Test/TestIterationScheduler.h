@@ -0,0 +1,17 @@
+#pragma once
+
+#include "TestUtils.h"
+
+class TestIterationScheduler : public TestUtils {
+public:
+    void test_all();
+
+private:
+    void test_exact_number_of_iterations_is_handed_out_per_option();
+    void test_batches_cover_every_iteration_number_once();
+    void test_batch_size_scales_with_iterations_and_threads();
+    void test_unknown_option_has_no_iterations();
+    void test_runners_start_on_different_options();
+    void test_converged_option_stops_handing_out_batches();
+    void test_concurrent_claims_hand_out_exact_number_of_iterations();
+};
@@ -0,0 +1,95 @@
+#include "TestModifierStack.h"
+
+#include <cassert>
+#include <stdexcept>
+
+#include <QDebug>
+#include <QVector>
+
+#include "Utils/CompareDouble.h"
+#include "Utils/ModifierStack.h"
+#include "xoroshiro128plus.h"
+
+namespace {
+// The recalculation ModifierStack replaced: multiply every active modifier, in insertion order, from scratch.
+double recalculate(const QVector<int>& percentages) {
+    double modifier = 1.0;
+    for (const auto& percentage : percentages)
+        modifier = modifier * (1.0 + double(percentage) / 100);
+
+    return modifier;
+}
+}
+
+void TestModifierStack::test_all() {
+    qDebug() << "TestModifierStack";
+    test_empty_stack_has_no_effect();
+    test_add_and_remove();
+    test_removing_missing_modifier_throws();
+    test_matches_full_recalculation();
+}
+
+void TestModifierStack::test_empty_stack_has_no_effect() {
+    ModifierStack stack;
+    assert(stack.size() == 0);
+    assert(almost_equal(stack.get_modifier(), 1.0));
+
+    stack.add(10);
+    stack.clear();
+    assert(stack.size() == 0);
+    assert(almost_equal(stack.get_modifier(), 1.0));
+}
+
+void TestModifierStack::test_add_and_remove() {
+    ModifierStack stack;
+    stack.add(10);
+    stack.add(-20);
+    assert(almost_equal(stack.get_modifier(), 1.1 * 0.8));
+
+    stack.remove(10);
+    assert(stack.size() == 1);
+    assert(almost_equal(stack.get_modifier(), 0.8));
+
+    stack.remove(-20);
+    assert(stack.size() == 0);
+    assert(almost_equal(stack.get_modifier(), 1.0));
+}
+
+void TestModifierStack::test_removing_missing_modifier_throws() {
+    ModifierStack stack;
+    stack.add(5);
+
+    bool thrown = false;
+    try {
+        stack.remove(10);
+    } catch (const std::logic_error&) {
+        thrown = true;
+    }
+
+    assert(thrown);
+    assert(stack.size() == 1);
+}
+
+void TestModifierStack::test_matches_full_recalculation() {
+    xoroshiro128plus random;
+    random.set_state(1437);
+
+    ModifierStack stack;
+    QVector<int> percentages;
+
+    for (int i = 0; i < 10000; ++i) {
+        if (percentages.empty() || random.next() % 3 != 0) {
+            const int percentage = static_cast<int>(random.next() % 60) - 25;
+            stack.add(percentage);
+            percentages.append(percentage);
+        } else {
+            const int percentage = percentages[static_cast<int>(random.next() % static_cast<unsigned>(percentages.size()))];
+            stack.remove(percentage);
+            percentages.removeOne(percentage);
+        }
+
+        // Bit-identical, not merely close: cached prefix products must not drift from a full recalculation.
+        assert(stack.get_modifier() == recalculate(percentages));
+        assert(stack.size() == percentages.size());
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "TestUtils.h"
+
+class TestModifierStack : public TestUtils {
+public:
+    void test_all();
+
+private:
+    void test_empty_stack_has_no_effect();
+    void test_add_and_remove();
+    void test_removing_missing_modifier_throws();
+    void test_matches_full_recalculation();
+};
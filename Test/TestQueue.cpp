@@ -0,0 +1,264 @@
+#include "TestQueue.h"
+
+#include <cassert>
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include "CalendarQueue.h"
+#include "EventHandle.h"
+#include "EventPool.h"
+#include "HeapQueue.h"
+#include "PlayerAction.h"
+#include "xoroshiro128plus.h"
+
+void TestQueue::test_all() {
+    qDebug() << "TestQueue";
+    test_events_are_returned_in_priority_order(QueueType::Heap);
+    test_events_are_returned_in_priority_order(QueueType::Calendar);
+    test_event_earlier_than_next_event_is_returned_first(QueueType::Heap);
+    test_event_earlier_than_next_event_is_returned_first(QueueType::Calendar);
+    test_events_beyond_calendar_wheel_are_returned_in_order();
+    test_calendar_queue_matches_heap_queue_for_random_schedule();
+    test_simultaneous_events_in_calendar_queue_are_returned_in_insertion_order();
+    test_cancelled_events_are_compacted(QueueType::Heap);
+    test_cancelled_events_are_compacted(QueueType::Calendar);
+    test_event_handle_is_released_when_event_is_popped_or_deleted();
+}
+
+void TestQueue::benchmark_all() {
+    benchmark_queues();
+}
+
+Queue* TestQueue::new_queue(const QueueType queue_type) const {
+    if (queue_type == QueueType::Calendar)
+        return new CalendarQueue();
+
+    return new HeapQueue();
+}
+
+void TestQueue::test_events_are_returned_in_priority_order(const QueueType queue_type) {
+    Queue* queue = new_queue(queue_type);
+    assert(queue->empty());
+
+    queue->push(new PlayerAction(nullptr, 3.0));
+    queue->push(new PlayerAction(nullptr, -1.5));
+    queue->push(new PlayerAction(nullptr, 2.0));
+    queue->push(new PlayerAction(nullptr, 0.1));
+
+    const QVector<double> expected {-1.5, 0.1, 2.0, 3.0};
+    for (const auto& priority : expected) {
+        assert(!queue->empty());
+        assert(almost_equal(queue->peek()->priority, priority));
+        Event* event = queue->get_next();
+        assert(almost_equal(event->priority, priority));
+        delete event;
+    }
+
+    assert(queue->empty());
+    delete queue;
+}
+
+void TestQueue::test_event_earlier_than_next_event_is_returned_first(const QueueType queue_type) {
+    Queue* queue = new_queue(queue_type);
+
+    queue->push(new PlayerAction(nullptr, 100.0));
+    queue->push(new PlayerAction(nullptr, 500.0));
+    delete queue->get_next();
+
+    queue->push(new PlayerAction(nullptr, 5.0));
+    queue->push(new PlayerAction(nullptr, 300.0));
+
+    const QVector<double> expected {5.0, 300.0, 500.0};
+    for (const auto& priority : expected) {
+        Event* event = queue->get_next();
+        assert(almost_equal(event->priority, priority));
+        delete event;
+    }
+
+    assert(queue->empty());
+    delete queue;
+}
+
+void TestQueue::test_events_beyond_calendar_wheel_are_returned_in_order() {
+    Queue* queue = new_queue(QueueType::Calendar);
+    const double wheel_span = CalendarQueue::BUCKET_WIDTH * CalendarQueue::NUM_BUCKETS;
+
+    queue->push(new PlayerAction(nullptr, 3 * wheel_span));
+    queue->push(new PlayerAction(nullptr, 0.5));
+    queue->push(new PlayerAction(nullptr, wheel_span + 0.5));
+    queue->push(new PlayerAction(nullptr, wheel_span - 0.5));
+
+    Event* event = queue->get_next();
+    assert(almost_equal(event->priority, 0.5));
+    delete event;
+
+    queue->push(new PlayerAction(nullptr, wheel_span + 0.25));
+
+    const QVector<double> expected {wheel_span - 0.5, wheel_span + 0.25, wheel_span + 0.5, 3 * wheel_span};
+    for (const auto& priority : expected) {
+        event = queue->get_next();
+        assert(almost_equal(event->priority, priority));
+        delete event;
+    }
+
+    assert(queue->empty());
+    delete queue;
+}
+
+void TestQueue::test_calendar_queue_matches_heap_queue_for_random_schedule() {
+    Queue* heap = new_queue(QueueType::Heap);
+    Queue* calendar = new_queue(QueueType::Calendar);
+    xoroshiro128plus random;
+    random.set_state(12345);
+
+    double now = 0.0;
+    for (int i = 0; i < 20000; ++i) {
+        const uint64_t roll = random.next();
+        if (roll % 3 != 0 || heap->empty()) {
+            const double delay = static_cast<double>((roll >> 8) % 60000) / 1000;
+            heap->push(new PlayerAction(nullptr, now + delay));
+            calendar->push(new PlayerAction(nullptr, now + delay));
+            continue;
+        }
+
+        Event* from_heap = heap->get_next();
+        Event* from_calendar = calendar->get_next();
+        assert(almost_equal(from_heap->priority, from_calendar->priority));
+        now = from_heap->priority;
+        delete from_heap;
+        delete from_calendar;
+    }
+
+    while (!heap->empty()) {
+        Event* from_heap = heap->get_next();
+        Event* from_calendar = calendar->get_next();
+        assert(almost_equal(from_heap->priority, from_calendar->priority));
+        delete from_heap;
+        delete from_calendar;
+    }
+
+    assert(calendar->empty());
+    delete heap;
+    delete calendar;
+}
+
+void TestQueue::test_simultaneous_events_in_calendar_queue_are_returned_in_insertion_order() {
+    Queue* queue = new_queue(QueueType::Calendar);
+
+    QVector<Event*> events;
+    for (int i = 0; i < 10; ++i) {
+        events.append(new PlayerAction(nullptr, 1.0));
+        queue->push(events.last());
+    }
+
+    for (const auto& event : events) {
+        assert(queue->get_next() == event);
+        delete event;
+    }
+
+    delete queue;
+}
+
+void TestQueue::test_cancelled_events_are_compacted(const QueueType queue_type) {
+    Queue* queue = new_queue(queue_type);
+    const unsigned num_events = 4 * Queue::COMPACTION_THRESHOLD;
+
+    QVector<Event*> events;
+    for (unsigned i = 0; i < num_events; ++i) {
+        events.append(new PlayerAction(nullptr, static_cast<double>(i) / 10));
+        queue->push(events.last());
+    }
+
+    Event* tombstone = queue->get_next();
+    tombstone->cancel();
+    assert(tombstone->is_cancelled());
+    delete tombstone;
+
+    for (unsigned i = 1; i < num_events / 2; ++i)
+        queue->cancel(events[static_cast<int>(i)]);
+
+    assert(queue->get_num_cancelled() == num_events / 2 - 1);
+    assert(queue->size() == num_events - 1);
+
+    queue->cancel(events[static_cast<int>(num_events / 2)]);
+    assert(queue->get_num_cancelled() == 0);
+    assert(queue->size() == num_events / 2 - 1);
+
+    Event* event = queue->get_next();
+    assert(!event->is_cancelled());
+    assert(almost_equal(event->priority, static_cast<double>(num_events / 2 + 1) / 10));
+    delete event;
+
+    delete queue;
+}
+
+void TestQueue::test_event_handle_is_released_when_event_is_popped_or_deleted() {
+    Queue* queue = new_queue(QueueType::Heap);
+    EventHandle handle;
+
+    Event* first = new PlayerAction(nullptr, 1.0);
+    handle.bind(first);
+    queue->push(first);
+    assert(handle.is_pending());
+
+    assert(queue->get_next() == first);
+    assert(!handle.is_pending());
+    delete first;
+
+    Event* second = new PlayerAction(nullptr, 2.0);
+    handle.bind(second);
+    delete second;
+    assert(!handle.is_pending());
+
+    auto scoped_handle = new EventHandle();
+    Event* third = new PlayerAction(nullptr, 3.0);
+    scoped_handle->bind(third);
+    delete scoped_handle;
+    delete third;
+
+    delete queue;
+}
+
+void TestQueue::benchmark_queues() {
+    const int num_actors = 40;
+    const int num_events = 200000;
+
+    Queue* heap = new_queue(QueueType::Heap);
+    Queue* calendar = new_queue(QueueType::Calendar);
+
+    const double heap_ms = benchmark_queue(heap, num_actors, num_events);
+    const double calendar_ms = benchmark_queue(calendar, num_actors, num_events);
+
+    qDebug() << "HeapQueue:" << num_events << "events in" << heap_ms << "ms";
+    qDebug() << "CalendarQueue:" << num_events << "events in" << calendar_ms << "ms";
+
+    delete heap;
+    delete calendar;
+}
+
+double TestQueue::benchmark_queue(Queue* queue, const int num_actors, const int num_events) {
+    // Each actor reschedules itself 0-3 seconds ahead when its event is
+    // handled, roughly like swing timers, GCDs and dot ticks in a raid.
+    EventPool pool;
+    xoroshiro128plus random;
+    random.set_state(54321);
+
+    for (int i = 0; i < num_actors; ++i)
+        queue->push(new (&pool) PlayerAction(nullptr, static_cast<double>(random.next() % 3000) / 1000));
+    queue->push(new (&pool) PlayerAction(nullptr, 1000000.0));
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < num_events; ++i) {
+        Event* event = queue->get_next();
+        queue->push(new (&pool) PlayerAction(nullptr, event->priority + static_cast<double>(random.next() % 3000) / 1000));
+        delete event;
+    }
+
+    const double elapsed = static_cast<double>(timer.nsecsElapsed()) / 1000000;
+    queue->clear();
+
+    return elapsed;
+}
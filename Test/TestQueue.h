@@ -0,0 +1,26 @@
+#pragma once
+
+#include "TestUtils.h"
+
+class Queue;
+enum class QueueType : int;
+
+class TestQueue : public TestUtils {
+public:
+    void test_all();
+    void benchmark_all();
+
+private:
+    void test_events_are_returned_in_priority_order(const QueueType queue_type);
+    void test_events_beyond_calendar_wheel_are_returned_in_order();
+    void test_event_earlier_than_next_event_is_returned_first(const QueueType queue_type);
+    void test_calendar_queue_matches_heap_queue_for_random_schedule();
+    void test_simultaneous_events_in_calendar_queue_are_returned_in_insertion_order();
+    void test_cancelled_events_are_compacted(const QueueType queue_type);
+    void test_event_handle_is_released_when_event_is_popped_or_deleted();
+
+    void benchmark_queues();
+    double benchmark_queue(Queue* queue, const int num_actors, const int num_events);
+
+    Queue* new_queue(const QueueType queue_type) const;
+};
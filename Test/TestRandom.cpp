@@ -0,0 +1,178 @@
+#include "TestRandom.h"
+
+#include <cassert>
+#include <limits>
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QSet>
+
+#include "Random.h"
+
+void TestRandom::test_all() {
+    qDebug() << "TestRandom";
+    test_same_seed_gives_same_rolls();
+    test_rolls_are_within_range();
+    test_reseeding_replays_generators_in_creation_order();
+    test_rolls_are_uniform();
+    test_reseeding_discards_buffered_rolls();
+    test_reseeded_neighbours_do_not_share_lane_states();
+}
+
+void TestRandom::benchmark_all() {
+    benchmark_rolls();
+}
+
+void TestRandom::test_same_seed_gives_same_rolls() {
+    Random first(0, 9999);
+    Random second(0, 9999);
+
+    first.set_gen_from_seed(1234);
+    second.set_gen_from_seed(1234);
+
+    for (int i = 0; i < 1000; ++i)
+        assert(first.get_roll() == second.get_roll());
+}
+
+void TestRandom::test_rolls_are_within_range() {
+    Random random(50, 60);
+
+    for (int i = 0; i < 1000; ++i) {
+        const unsigned roll = random.get_roll();
+        assert(roll >= 50);
+        assert(roll < 60);
+    }
+
+    random.set_new_range(7, 7);
+    assert(random.get_roll() == 7);
+}
+
+void TestRandom::test_reseeding_replays_generators_in_creation_order() {
+    QVector<unsigned> first_rolls;
+    QVector<unsigned> second_rolls;
+
+    {
+        auto damage_roll = new Random(100, 200);
+        auto attack_roll = new Random(0, 9999);
+
+        Random::reseed_generators_on_current_thread(42);
+        for (int i = 0; i < 100; ++i) {
+            first_rolls.append(damage_roll->get_roll());
+            first_rolls.append(attack_roll->get_roll());
+        }
+
+        delete damage_roll;
+        delete attack_roll;
+    }
+
+    {
+        // A raid set up again from scratch creates its generators in the same order and replays the same streams.
+        auto damage_roll = new Random(100, 200);
+        auto attack_roll = new Random(0, 9999);
+
+        Random::reseed_generators_on_current_thread(42);
+        for (int i = 0; i < 100; ++i) {
+            second_rolls.append(damage_roll->get_roll());
+            second_rolls.append(attack_roll->get_roll());
+        }
+
+        delete damage_roll;
+        delete attack_roll;
+    }
+
+    assert(first_rolls == second_rolls);
+
+    Random other_seed(100, 200);
+    Random::reseed_generators_on_current_thread(43);
+    bool any_different = false;
+    for (int i = 0; i < 100; ++i)
+        any_different |= other_seed.get_roll() != first_rolls[2 * i];
+    assert(any_different);
+}
+
+void TestRandom::test_rolls_are_uniform() {
+    const int num_outcomes = 6;
+    const int num_rolls = 600000;
+
+    Random random(0, num_outcomes);
+    random.set_gen_from_seed(2019);
+
+    QVector<int> counts(num_outcomes, 0);
+    for (int i = 0; i < num_rolls; ++i)
+        ++counts[static_cast<int>(random.get_roll())];
+
+    // Each outcome is expected 100000 times with a standard deviation of about 290.
+    for (const auto& count : counts)
+        assert(count > 99000 && count < 101000);
+}
+
+void TestRandom::test_reseeding_discards_buffered_rolls() {
+    Random fresh(0, 9999);
+    fresh.set_gen_from_seed(77);
+
+    Random used(0, 9999);
+    used.set_gen_from_seed(5);
+    for (int i = 0; i < Random::BATCH_SIZE / 2; ++i)
+        used.get_roll();
+    used.set_gen_from_seed(77);
+
+    for (int i = 0; i < 3 * Random::BATCH_SIZE; ++i)
+        assert(fresh.get_roll() == used.get_roll());
+}
+
+void TestRandom::test_reseeded_neighbours_do_not_share_lane_states() {
+    // Full range rolls are the upper 32 bits of the raw numbers. A lane state shared between generators, or
+    // shifted by a lane, shows up as the same rolls in both generators.
+    const int num_generators = 6;
+    QVector<Random*> generators;
+    for (int i = 0; i < num_generators; ++i)
+        generators.append(new Random(0, std::numeric_limits<unsigned>::max()));
+
+    Random::reseed_generators_on_current_thread(42);
+
+    QVector<QSet<unsigned>> rolls(num_generators);
+    for (int i = 0; i < num_generators; ++i) {
+        for (int roll = 0; roll < 2 * Random::BATCH_SIZE; ++roll)
+            rolls[i].insert(generators[i]->get_roll());
+    }
+
+    for (int i = 0; i < num_generators; ++i) {
+        for (int j = i + 1; j < num_generators; ++j)
+            assert(!rolls[i].intersects(rolls[j]));
+    }
+
+    // Seeds one splitmix64 increment apart must not overlap either.
+    Random first(0, std::numeric_limits<unsigned>::max());
+    Random second(0, std::numeric_limits<unsigned>::max());
+    first.set_gen_from_seed(1);
+    second.set_gen_from_seed(1 + 0x9e3779b97f4a7c15ULL);
+
+    QSet<unsigned> first_rolls;
+    QSet<unsigned> second_rolls;
+    for (int roll = 0; roll < 2 * Random::BATCH_SIZE; ++roll) {
+        first_rolls.insert(first.get_roll());
+        second_rolls.insert(second.get_roll());
+    }
+    assert(!first_rolls.intersects(second_rolls));
+
+    qDeleteAll(generators);
+}
+
+void TestRandom::benchmark_rolls() {
+    const int num_rolls = 10000000;
+
+    Random random(0, 9999);
+    random.set_gen_from_seed(1);
+
+    unsigned long long sum = 0;
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < num_rolls; ++i)
+        sum += random.get_roll();
+
+    const double elapsed_s = static_cast<double>(timer.nsecsElapsed()) / 1000000000;
+    assert(sum > 0);
+
+    qDebug() << "Random::get_roll:" << static_cast<qint64>(num_rolls / elapsed_s) << "rolls/s";
+}
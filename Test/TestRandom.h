@@ -0,0 +1,19 @@
+#pragma once
+
+#include "TestUtils.h"
+
+class TestRandom : public TestUtils {
+public:
+    void test_all();
+    void benchmark_all();
+
+private:
+    void test_same_seed_gives_same_rolls();
+    void test_rolls_are_within_range();
+    void test_reseeding_replays_generators_in_creation_order();
+    void test_rolls_are_uniform();
+    void test_reseeding_discards_buffered_rolls();
+    void test_reseeded_neighbours_do_not_share_lane_states();
+
+    void benchmark_rolls();
+};
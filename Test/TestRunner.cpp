@@ -0,0 +1,201 @@
+#include "TestRunner.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QProcess>
+#include <QStringList>
+
+#include "EquipmentDb.h"
+#include "Test.h"
+#include "Test/General/Spells/TestEssenceOfTheRed.h"
+#include "Test/Target/TestTarget.h"
+#include "TestAttackTables.h"
+#include "TestBloodFury.h"
+#include "TestCharacterStats.h"
+#include "TestCheck.h"
+#include "TestCombatRoll.h"
+#include "TestConditionProgram.h"
+#include "TestConditionResource.h"
+#include "TestConditionVariableBuiltin.h"
+#include "TestDruid.h"
+#include "TestEnabledProcs.h"
+#include "TestEquipmentDbCache.h"
+#include "TestFelstrikerProc.h"
+#include "TestGearOptimizer.h"
+#include "TestHunter.h"
+#include "TestIterationScheduler.h"
+#include "TestMage.h"
+#include "TestMana.h"
+#include "TestMechanics.h"
+#include "TestModifierStack.h"
+#include "TestPaladin.h"
+#include "TestQueue.h"
+#include "TestRandom.h"
+#include "TestRogue.h"
+#include "TestRotationFileReader.h"
+#include "TestRunningStatistics.h"
+#include "TestShaman.h"
+#include "TestStatistics.h"
+#include "TestStats.h"
+#include "TestTalentOptimizer.h"
+#include "TestWarlock.h"
+#include "TestWarrior.h"
+
+// The class suites take the longest, so they are listed first to keep them from finishing last on a single thread.
+TestRunner::TestRunner() :
+    suites({
+        {"TestWarrior", [](EquipmentDb* equipment_db) { TestWarrior(equipment_db).test_all(); }},
+        {"TestRogue", [](EquipmentDb* equipment_db) { TestRogue(equipment_db).test_all(); }},
+        {"TestHunter", [](EquipmentDb* equipment_db) { TestHunter(equipment_db).test_all(); }},
+        {"TestPaladin", [](EquipmentDb* equipment_db) { TestPaladin(equipment_db).test_all(); }},
+        {"TestShaman", [](EquipmentDb* equipment_db) { TestShaman(equipment_db).test_all(); }},
+        {"TestMage", [](EquipmentDb* equipment_db) { TestMage(equipment_db).test_all(); }},
+        {"TestDruid", [](EquipmentDb* equipment_db) { TestDruid(equipment_db).test_all(); }},
+        {"TestWarlock", [](EquipmentDb* equipment_db) { TestWarlock(equipment_db).test_all(); }},
+        {"Test", [](EquipmentDb* equipment_db) { Test(equipment_db).test_all(); }},
+        {"TestCheck", [](EquipmentDb*) { TestCheck().test_all(); }},
+        {"TestMechanics", [](EquipmentDb*) { TestMechanics().test_all(); }},
+        {"TestQueue", [](EquipmentDb*) { TestQueue().test_all(); }},
+        {"TestIterationScheduler", [](EquipmentDb*) { TestIterationScheduler().test_all(); }},
+        {"TestRandom", [](EquipmentDb*) { TestRandom().test_all(); }},
+        {"TestRunningStatistics", [](EquipmentDb*) { TestRunningStatistics().test_all(); }},
+        {"TestCombatRoll", [](EquipmentDb* equipment_db) { TestCombatRoll(equipment_db).test_all(); }},
+        {"TestTarget", [](EquipmentDb*) { TestTarget().test_all(); }},
+        {"TestAttackTables", [](EquipmentDb* equipment_db) { TestAttackTables(equipment_db).test_all(); }},
+        {"TestStats", [](EquipmentDb*) { TestStats().test_all(); }},
+        {"TestModifierStack", [](EquipmentDb*) { TestModifierStack().test_all(); }},
+        {"TestStatistics", [](EquipmentDb*) { TestStatistics().test_all(); }},
+        {"TestEquipmentDbCache", [](EquipmentDb* equipment_db) { TestEquipmentDbCache(equipment_db).test_all(); }},
+        {"TestCharacterStats", [](EquipmentDb* equipment_db) { TestCharacterStats(equipment_db).test_all(); }},
+        {"TestEnabledProcs", [](EquipmentDb* equipment_db) { TestEnabledProcs(equipment_db).test_all(); }},
+        {"TestGearOptimizer", [](EquipmentDb* equipment_db) { TestGearOptimizer(equipment_db).test_all(); }},
+        {"TestTalentOptimizer", [](EquipmentDb* equipment_db) { TestTalentOptimizer(equipment_db).test_all(); }},
+        {"TestConditionResource", [](EquipmentDb* equipment_db) { TestConditionResource(equipment_db).test_all(); }},
+        {"TestConditionProgram", [](EquipmentDb* equipment_db) { TestConditionProgram(equipment_db).test_all(); }},
+        {"TestConditionVariableBuiltin", [](EquipmentDb* equipment_db) { TestConditionVariableBuiltin(equipment_db).test_all(); }},
+        {"TestRotationFileReader", [](EquipmentDb*) { TestRotationFileReader().test_all(); }},
+        {"TestMana", [](EquipmentDb* equipment_db) { TestMana(equipment_db).test_all(); }},
+        {"TestBloodFury", [](EquipmentDb* equipment_db) { TestBloodFury(equipment_db).test_all(); }},
+        {"TestFelstrikerProc", [](EquipmentDb* equipment_db) { TestFelstrikerProc(equipment_db).test_all(); }},
+        {"TestEssenceOfTheRed", [](EquipmentDb* equipment_db) { TestEssenceOfTheRed(equipment_db).test_all(); }},
+    }),
+    benchmarks({
+        {"TestQueue", [](EquipmentDb*) { TestQueue().benchmark_all(); }},
+        {"TestCheck", [](EquipmentDb*) { TestCheck().benchmark_all(); }},
+        {"TestRandom", [](EquipmentDb*) { TestRandom().benchmark_all(); }},
+        {"TestAttackTables", [](EquipmentDb* equipment_db) { TestAttackTables(equipment_db).benchmark_all(); }},
+    }) {}
+
+int TestRunner::run(const int num_threads, const QString& filter, const bool run_benchmarks) {
+    const QVector<TestSuite>& selected = run_benchmarks ? benchmarks : suites;
+
+    QVector<int> suite_indices;
+    for (int i = 0; i < selected.size(); ++i) {
+        if (selected[i].name.contains(filter))
+            suite_indices.append(i);
+    }
+
+    if (suite_indices.empty()) {
+        qWarning() << "No test suite matches" << filter;
+        return 1;
+    }
+
+    QVector<TestSuiteResult> results(selected.size());
+    std::atomic<int> next_suite {0};
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QVector<std::thread*> threads;
+    for (int i = 0; i < std::min(num_threads, suite_indices.size()); ++i)
+        threads.append(
+            new std::thread(&TestRunner::run_suites, this, std::cref(selected), std::cref(suite_indices), std::ref(next_suite), std::ref(results),
+                            run_benchmarks));
+
+    for (const auto& thread : threads) {
+        thread->join();
+        delete thread;
+    }
+
+    qint64 total_suite_ms = 0;
+    int num_failed = 0;
+    for (const auto index : suite_indices) {
+        total_suite_ms += results[index].elapsed_ms;
+        if (!results[index].passed) {
+            ++num_failed;
+            qWarning().noquote() << QString("FAILED %1: %2\n%3").arg(selected[index].name, results[index].error, results[index].output);
+        }
+    }
+
+    qInfo().noquote() << QString("%1 of %2 suites passed in %3 ms on %4 threads (%5 ms in suites)")
+                             .arg(suite_indices.size() - num_failed)
+                             .arg(suite_indices.size())
+                             .arg(timer.elapsed())
+                             .arg(threads.size())
+                             .arg(total_suite_ms);
+
+    return num_failed;
+}
+
+int TestRunner::run_suite(const QString& name, const bool run_benchmark) const {
+    const QVector<TestSuite>& selected = run_benchmark ? benchmarks : suites;
+
+    for (const auto& suite : selected) {
+        if (suite.name != name)
+            continue;
+
+        EquipmentDb equipment_db;
+        try {
+            suite.test_all(&equipment_db);
+        } catch (const std::exception& e) {
+            qWarning().noquote() << QString("%1 threw: %2").arg(name, e.what());
+            return 1;
+        }
+
+        return 0;
+    }
+
+    qWarning() << "No test suite named" << name;
+    return 1;
+}
+
+void TestRunner::run_suites(const QVector<TestSuite>& selected,
+                            const QVector<int>& suite_indices,
+                            std::atomic<int>& next_suite,
+                            QVector<TestSuiteResult>& results,
+                            const bool run_benchmarks) const {
+    for (int i = next_suite++; i < suite_indices.size(); i = next_suite++) {
+        const TestSuite& suite = selected[suite_indices[i]];
+        TestSuiteResult& result = results[suite_indices[i]];
+
+        QElapsedTimer timer;
+        timer.start();
+
+        // A failed assert aborts the process it runs in, so every suite runs in a process of its own.
+        QStringList arguments = {"--suite", suite.name};
+        if (run_benchmarks)
+            arguments.append("--benchmarks");
+
+        QProcess process;
+        process.setProcessChannelMode(QProcess::MergedChannels);
+        process.start(QCoreApplication::applicationFilePath(), arguments);
+
+        if (!process.waitForFinished(-1))
+            result.error = QString("could not run suite: %1").arg(process.errorString());
+        else if (process.exitStatus() != QProcess::NormalExit)
+            result.error = "crashed";
+        else if (process.exitCode() != 0)
+            result.error = QString("exited with code %1").arg(process.exitCode());
+        else
+            result.passed = true;
+
+        result.output = QString::fromLocal8Bit(process.readAll());
+        result.elapsed_ms = timer.elapsed();
+        qInfo().noquote() << QString("%1 %2 in %3 ms").arg(suite.name).arg(result.passed ? "passed" : "failed").arg(result.elapsed_ms);
+    }
+}
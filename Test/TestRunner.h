@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include <QString>
+#include <QVector>
+
+class EquipmentDb;
+
+// Runs the test suites on several threads. Threads claim one suite at a time and run it in a child process of
+// the test binary (see run_suite), so a suite that fails an assert or crashes is reported without taking the other
+// suites down with it. Each suite gets its own EquipmentDb since some suites add test items to it.
+class TestRunner {
+public:
+    TestRunner();
+
+    // Runs every suite whose name contains the filter and returns the number of suites that failed. With
+    // run_benchmarks, the benchmarks are run instead of the test suites.
+    int run(const int num_threads, const QString& filter, const bool run_benchmarks);
+    // Runs the suite (or benchmark) with exactly this name in the calling process. Returns 0 if it passed.
+    int run_suite(const QString& name, const bool run_benchmark) const;
+
+private:
+    struct TestSuite {
+        QString name;
+        std::function<void(EquipmentDb*)> test_all;
+    };
+
+    struct TestSuiteResult {
+        bool passed {false};
+        QString error;
+        QString output;
+        qint64 elapsed_ms {0};
+    };
+
+    QVector<TestSuite> suites;
+    // Timings printed with qDebug. They assert nothing and take a while, so they only run when asked for.
+    QVector<TestSuite> benchmarks;
+
+    void run_suites(const QVector<TestSuite>& selected,
+                    const QVector<int>& suite_indices,
+                    std::atomic<int>& next_suite,
+                    QVector<TestSuiteResult>& results,
+                    const bool run_benchmarks) const;
+};
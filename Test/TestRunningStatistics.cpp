@@ -0,0 +1,75 @@
+#include "TestRunningStatistics.h"
+
+#include <cassert>
+#include <cmath>
+
+#include <QDebug>
+#include <QVector>
+
+#include "RunningStatistics.h"
+
+void TestRunningStatistics::test_all() {
+    qDebug() << "TestRunningStatistics";
+    test_mean_and_variance_match_two_pass_calculation();
+    test_merged_batches_match_single_pass();
+    test_empty_statistics();
+}
+
+void TestRunningStatistics::test_mean_and_variance_match_two_pass_calculation() {
+    const QVector<double> samples {812.5, 790.1, 845.3, 801.0, 799.9, 830.2, 770.4, 815.8};
+
+    RunningStatistics running;
+    double sum = 0.0;
+    for (const auto& sample : samples) {
+        running.add(sample);
+        sum += sample;
+    }
+
+    const double mean = sum / samples.size();
+    double variance = 0.0;
+    for (const auto& sample : samples)
+        variance += (sample - mean) * (sample - mean);
+    variance /= samples.size();
+
+    assert(running.get_count() == samples.size());
+    assert(almost_equal(running.get_mean(), mean));
+    assert(almost_equal(running.get_variance(), variance));
+    assert(almost_equal(running.get_confidence_interval(), 1.960 * std::sqrt(variance) / std::sqrt(samples.size())));
+}
+
+void TestRunningStatistics::test_merged_batches_match_single_pass() {
+    RunningStatistics single_pass;
+    RunningStatistics first_batch;
+    RunningStatistics second_batch;
+    RunningStatistics third_batch;
+
+    for (int i = 0; i < 100; ++i) {
+        const double sample = 500.0 + (i * 37 % 101) - (i % 7) * 3.5;
+        single_pass.add(sample);
+
+        if (i < 17)
+            first_batch.add(sample);
+        else if (i < 60)
+            second_batch.add(sample);
+        else
+            third_batch.add(sample);
+    }
+
+    RunningStatistics merged;
+    merged.merge(first_batch);
+    merged.merge(RunningStatistics());
+    merged.merge(second_batch);
+    merged.merge(third_batch);
+
+    assert(merged.get_count() == single_pass.get_count());
+    assert(almost_equal(merged.get_mean(), single_pass.get_mean()));
+    assert(almost_equal(merged.get_variance(), single_pass.get_variance()));
+}
+
+void TestRunningStatistics::test_empty_statistics() {
+    RunningStatistics empty;
+
+    assert(empty.get_count() == 0);
+    assert(almost_equal(empty.get_variance(), 0.0));
+    assert(almost_equal(empty.get_confidence_interval(), 0.0));
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "TestUtils.h"
+
+class TestRunningStatistics : public TestUtils {
+public:
+    void test_all();
+
+private:
+    void test_mean_and_variance_match_two_pass_calculation();
+    void test_merged_batches_match_single_pass();
+    void test_empty_statistics();
+};
@@ -0,0 +1,106 @@
+#include "TestStatistics.h"
+
+#include <cassert>
+
+#include <QDebug>
+
+#include "StatisticsBuff.h"
+#include "StatisticsEngine.h"
+#include "StatisticsSpell.h"
+
+void TestStatistics::test_all() {
+    qDebug() << "TestStatistics";
+    test_spell_outcomes_without_damage_report_zero();
+    test_add_merges_spell_statistics();
+    test_add_merges_engine_statistics();
+    test_encounters_without_uptime_match_zero_uptime_encounters();
+}
+
+void TestStatistics::test_spell_outcomes_without_damage_report_zero() {
+    StatisticsSpell statistics("Test", "");
+    statistics.increment_miss();
+
+    assert(statistics.get_misses() == 1);
+    assert(statistics.get_total_attempts_made() == 1);
+    assert(statistics.get_total_dmg_dealt() == 0);
+    assert(statistics.get_min_hit_dmg() == 0);
+    assert(statistics.get_max_hit_dmg() == 0);
+    assert(statistics.get_min_crit_thrt() == 0);
+    assert(statistics.get_num_dmg_columns() == 0);
+}
+
+void TestStatistics::test_add_merges_spell_statistics() {
+    StatisticsSpell first("Test", "");
+    first.add_hit_dmg(100, 0, 1.0);
+    first.add_hit_dmg(50, 0, 1.0);
+    first.add_hit_thrt(120, 0, 1.0);
+
+    StatisticsSpell second("Test", "");
+    second.add_hit_dmg(200, 0, 1.0);
+    second.add_crit_dmg(300, 0, 1.0);
+    second.add_hit_thrt(80, 0, 1.0);
+    second.increment_dodge();
+
+    first.add(&second);
+
+    assert(first.get_hits() == 3);
+    assert(first.get_crits() == 1);
+    assert(first.get_dodges() == 1);
+    assert(first.get_total_attempts_made() == 5);
+    assert(first.get_num_attempt_columns() == 3);
+
+    assert(first.get_hit_dmg() == 350);
+    assert(first.get_min_hit_dmg() == 50);
+    assert(first.get_max_hit_dmg() == 200);
+    assert(first.get_min_crit_dmg() == 300);
+    assert(first.get_max_crit_dmg() == 300);
+    assert(first.get_total_dmg_dealt() == 650);
+    assert(first.get_num_dmg_columns() == 2);
+
+    assert(first.get_hit_thrt() == 200);
+    assert(first.get_min_hit_thrt() == 80);
+    assert(first.get_max_hit_thrt() == 120);
+    assert(first.get_num_thrt_columns() == 1);
+}
+
+void TestStatistics::test_add_merges_engine_statistics() {
+    StatisticsEngine first;
+    first.increment_event(EventType::DotTick);
+
+    StatisticsEngine second;
+    second.increment_event(EventType::DotTick);
+    second.increment_event(EventType::BuffRemoval);
+    second.increment_cancelled_event(EventType::RangedHit);
+
+    first.add(&second);
+
+    const QList<QPair<EventType, unsigned>> event_pairs = first.get_list_of_event_pairs();
+    assert(event_pairs.size() == 2);
+    assert(event_pairs[0].first == EventType::BuffRemoval);
+    assert(event_pairs[0].second == 1);
+    assert(event_pairs[1].first == EventType::DotTick);
+    assert(event_pairs[1].second == 2);
+    assert(first.get_cancelled_events(EventType::RangedHit) == 1);
+    assert(first.get_cancelled_events(EventType::DotTick) == 0);
+
+    assert(Event::get_name_for_event_type(EventType::IncomingDamage) == "IncomingDamage");
+}
+
+void TestStatistics::test_encounters_without_uptime_match_zero_uptime_encounters() {
+    StatisticsBuff one_by_one("Test", "", false);
+    StatisticsBuff batched("Test", "", false);
+
+    one_by_one.add_uptime_for_encounter(0.8);
+    batched.add_uptime_for_encounter(0.8);
+
+    for (int i = 0; i < 3; ++i)
+        one_by_one.add_uptime_for_encounter(0.0);
+    batched.add_encounters_without_uptime(3);
+    batched.add_encounters_without_uptime(0);
+
+    one_by_one.add_uptime_for_encounter(0.4);
+    batched.add_uptime_for_encounter(0.4);
+
+    assert(almost_equal(one_by_one.get_avg_uptime(), batched.get_avg_uptime()));
+    assert(almost_equal(batched.get_avg_uptime(), 0.24));
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "TestUtils.h"
+
+class TestStatistics : public TestUtils {
+public:
+    void test_all();
+
+private:
+    void test_spell_outcomes_without_damage_report_zero();
+    void test_add_merges_spell_statistics();
+    void test_add_merges_engine_statistics();
+    void test_encounters_without_uptime_match_zero_uptime_encounters();
+};
@@ -0,0 +1,287 @@
+#include "TestTalentOptimizer.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "CharacterEncoder.h"
+#include "CharacterSpells.h"
+#include "CharacterTalents.h"
+#include "EvaluatorPool.h"
+#include "Orc.h"
+#include "RaidControl.h"
+#include "RotationFileReader.h"
+#include "SimSettings.h"
+#include "TalentOptimizer.h"
+#include "Warrior.h"
+
+TestTalentOptimizer::TestTalentOptimizer(EquipmentDb* equipment_db) : TestObject(equipment_db) {}
+
+void TestTalentOptimizer::set_up() {
+    race = new Orc();
+    sim_settings = new SimSettings();
+    sim_settings->set_combat_length(60);
+    raid_control = new RaidControl(sim_settings);
+    pchar = new Warrior(race, equipment_db, sim_settings, raid_control);
+}
+
+void TestTalentOptimizer::tear_down() {
+    delete pchar;
+    delete race;
+    delete sim_settings;
+    delete raid_control;
+}
+
+QString TestTalentOptimizer::get_setup_string() {
+    pchar->get_spells()->set_rotation(RotationFileReader::get_rotation("Warrior", "2h Fury"));
+    return CharacterEncoder(pchar).get_current_setup_string();
+}
+
+void TestTalentOptimizer::test_all() {
+    qDebug() << "TestTalentOptimizer";
+    set_up();
+    test_values_after_initialization();
+    tear_down();
+
+    set_up();
+    test_apply_build_replaces_talents();
+    tear_down();
+
+    set_up();
+    test_apply_build_rejects_build_that_breaks_tree_rules();
+    tear_down();
+
+    set_up();
+    test_neighbours_move_one_point_within_tree_rules();
+    tear_down();
+
+    set_up();
+    test_successive_halving_keeps_true_best_build();
+    tear_down();
+
+    set_up();
+    test_successive_halving_stops_when_evaluation_fails();
+    tear_down();
+
+    set_up();
+    test_next_build_rejects_winner_of_noisy_stages();
+    tear_down();
+
+    set_up();
+    test_next_build_keeps_confirmed_winner();
+    tear_down();
+
+    set_up();
+    test_run_moves_one_point_per_round();
+    tear_down();
+
+    set_up();
+    test_run_fails_when_setup_does_not_load();
+    tear_down();
+}
+
+void TestTalentOptimizer::test_values_after_initialization() {
+    assert(TalentOptimizer::get_build(pchar->get_talents()).empty());
+
+    // Without points spent, only a point in a first tier talent can be added.
+    const QVector<TalentBuild> neighbours = TalentOptimizer::get_neighbours(pchar->get_talents());
+    assert(!neighbours.empty());
+    for (const auto& neighbour : neighbours) {
+        assert(neighbour.size() == 1);
+        assert(neighbour.constBegin().key().second.startsWith("1"));
+        assert(neighbour.constBegin().value() == 1);
+    }
+
+    assert(TalentOptimizer::get_build(pchar->get_talents()).empty());
+}
+
+void TestTalentOptimizer::test_apply_build_replaces_talents() {
+    pchar->get_talents()->increase_to_max_rank("LEFT", "1ML");
+
+    TalentBuild build;
+    build[{"MID", "1MR"}] = 5;
+    build[{"MID", "2MR"}] = 3;
+    build[{"LEFT", "1LL"}] = 2;
+
+    assert(TalentOptimizer::apply_build(pchar, build));
+    assert(TalentOptimizer::get_build(pchar->get_talents()) == build);
+    assert(pchar->get_talents()->get_talent_points_remaining() == 41);
+
+    assert(TalentOptimizer::apply_build(pchar, TalentBuild()));
+    assert(TalentOptimizer::get_build(pchar->get_talents()).empty());
+    assert(pchar->get_talents()->get_talent_points_remaining() == 51);
+}
+
+void TestTalentOptimizer::test_apply_build_rejects_build_that_breaks_tree_rules() {
+    TalentBuild build;
+    build[{"MID", "1MR"}] = 4;
+    build[{"MID", "2MR"}] = 1;
+
+    assert(!TalentOptimizer::apply_build(pchar, build));
+    assert(pchar->get_talents()->get_rank("MID", "2MR") == "0");
+}
+
+void TestTalentOptimizer::test_neighbours_move_one_point_within_tree_rules() {
+    TalentBuild build;
+    build[{"MID", "1MR"}] = 5;
+    build[{"MID", "2MR"}] = 1;
+    assert(TalentOptimizer::apply_build(pchar, build));
+
+    const QVector<TalentBuild> neighbours = TalentOptimizer::get_neighbours(pchar->get_talents());
+    assert(TalentOptimizer::get_build(pchar->get_talents()) == build);
+
+    bool moved_point_between_trees = false;
+    for (const auto& neighbour : neighbours) {
+        // Cruelty holds the points that unlock the second tier, so none of its points can be moved elsewhere.
+        assert(neighbour.value({"MID", "1MR"}) == 5);
+        if (neighbour.value({"MID", "2MR"}) == 0 && neighbour.size() == 2)
+            moved_point_between_trees = true;
+
+        assert(TalentOptimizer::apply_build(pchar, neighbour));
+    }
+
+    assert(moved_point_between_trees);
+}
+
+void TestTalentOptimizer::test_successive_halving_keeps_true_best_build() {
+    const QVector<double> true_dps = {100, 130, 90, 125, 110, 105, 95, 120};
+    QVector<int> stage_iterations;
+
+    // The error shrinks with the iterations and flips sign between neighbouring builds. With 10 iterations
+    // build 4 looks best and build 1 barely makes the better half.
+    auto evaluate = [&](const QVector<int>& indices, const int iterations, QVector<double>& dps) {
+        stage_iterations.append(iterations);
+        for (const auto index : indices)
+            dps[index] = true_dps[index] + (index % 2 == 0 ? 200.0 : -200.0) / iterations;
+        return true;
+    };
+
+    TalentOptimizer optimizer(nullptr);
+    optimizer.set_iterations(10);
+    optimizer.set_max_iterations(1000);
+
+    int evaluations = 0;
+    assert(optimizer.select_by_successive_halving(true_dps.size(), evaluate, evaluations) == 1);
+    assert(stage_iterations == QVector<int>({10, 20, 40}));
+    assert(evaluations == 8 + 4 + 2);
+}
+
+void TestTalentOptimizer::test_successive_halving_stops_when_evaluation_fails() {
+    int calls = 0;
+    auto evaluate = [&calls](const QVector<int>&, const int, QVector<double>&) {
+        ++calls;
+        return false;
+    };
+
+    TalentOptimizer optimizer(nullptr);
+    int evaluations = 0;
+
+    assert(optimizer.select_by_successive_halving(4, evaluate, evaluations) == -1);
+    assert(calls == 1);
+    assert(evaluations == 0);
+}
+
+void TestTalentOptimizer::test_next_build_rejects_winner_of_noisy_stages() {
+    const QVector<double> true_dps = {100, 90, 95};
+
+    // With few iterations build 1 looks best, although it is the worst build.
+    auto evaluate = [&](const QVector<int>& indices, const int iterations, QVector<double>& dps) {
+        for (const auto index : indices)
+            dps[index] = true_dps[index] + (index == 1 ? 400.0 : 0.0) / iterations;
+        return true;
+    };
+
+    QVector<int> confirmed_indices;
+    int confirm_iterations = 0;
+    auto evaluate_per_iteration = [&](const QVector<int>& indices, const int iterations, QVector<QMap<int, double>>& dps) {
+        confirmed_indices = indices;
+        confirm_iterations = iterations;
+        for (const auto index : indices) {
+            for (int i = 0; i < 50; ++i)
+                dps[index][i] = true_dps[index] + i % 5;
+        }
+        return true;
+    };
+
+    TalentOptimizer optimizer(nullptr);
+    optimizer.set_iterations(10);
+    optimizer.set_max_iterations(1000);
+
+    QMap<int, double> next_dps;
+    int evaluations = 0;
+    assert(optimizer.select_next_build(true_dps.size(), evaluate, evaluate_per_iteration, next_dps, evaluations) == 0);
+    assert(confirmed_indices == QVector<int>({0, 1}));
+    assert(confirm_iterations == 1000);
+    assert(evaluations == 3 + 2 + 2);
+    assert(next_dps.empty());
+}
+
+void TestTalentOptimizer::test_next_build_keeps_confirmed_winner() {
+    const QVector<double> true_dps = {100, 110, 95};
+
+    auto evaluate = [&](const QVector<int>& indices, const int, QVector<double>& dps) {
+        for (const auto index : indices)
+            dps[index] = true_dps[index];
+        return true;
+    };
+
+    auto evaluate_per_iteration = [&](const QVector<int>& indices, const int, QVector<QMap<int, double>>& dps) {
+        for (const auto index : indices) {
+            for (int i = 0; i < 50; ++i)
+                dps[index][i] = true_dps[index] + (index == 1 ? i % 3 : 0);
+        }
+        return true;
+    };
+
+    TalentOptimizer optimizer(nullptr);
+    optimizer.set_iterations(10);
+    optimizer.set_max_iterations(1000);
+
+    QMap<int, double> next_dps;
+    int evaluations = 0;
+    assert(optimizer.select_next_build(true_dps.size(), evaluate, evaluate_per_iteration, next_dps, evaluations) == 1);
+    assert(next_dps.size() == 50);
+    assert(almost_equal(110.0, next_dps[0]));
+    assert(almost_equal(112.0, next_dps[2]));
+}
+
+void TestTalentOptimizer::test_run_moves_one_point_per_round() {
+    EvaluatorPool pool(equipment_db, nullptr, sim_settings, get_setup_string(), 2);
+    assert(pool.successful());
+
+    TalentOptimizer optimizer(&pool);
+    optimizer.set_iterations(10);
+    optimizer.set_max_iterations(40);
+    optimizer.set_max_rounds(1);
+
+    TalentOptimizerResult result = optimizer.run();
+
+    assert(result.success);
+    assert(result.error.isEmpty());
+    assert(result.rounds == 1);
+    assert(result.evaluations > 2);
+    // A kept move must have been confirmed to beat the starting build.
+    assert(result.best_build.empty() ? almost_equal(result.base_dps, result.best_dps) : result.best_dps > result.base_dps);
+    // Starting without talents, a single round can at most invest one point in a first tier talent.
+    assert(result.best_build.size() <= 1);
+    for (auto it = result.best_build.constBegin(); it != result.best_build.constEnd(); ++it) {
+        assert(it.key().second.startsWith("1"));
+        assert(it.value() == 1);
+    }
+
+    assert(TalentOptimizer::apply_build(pchar, result.best_build));
+    assert(QJsonDocument::fromJson(result.best_setup_string.toUtf8()).object()["CLASS"].toString() == "Warrior");
+}
+
+void TestTalentOptimizer::test_run_fails_when_setup_does_not_load() {
+    QJsonObject setup = QJsonDocument::fromJson(get_setup_string().toUtf8()).object();
+    setup["ROTATION"] = "No such rotation";
+    EvaluatorPool pool(equipment_db, nullptr, sim_settings, QJsonDocument(setup).toJson(), 1);
+    assert(!pool.successful());
+
+    TalentOptimizer optimizer(&pool);
+    TalentOptimizerResult result = optimizer.run();
+
+    assert(!result.success);
+    assert(!result.error.isEmpty());
+    assert(result.best_build.empty());
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QString>
+
+#include "TestObject.h"
+
+class Character;
+class Race;
+class RaidControl;
+class SimSettings;
+
+class TestTalentOptimizer : TestObject {
+public:
+    TestTalentOptimizer(EquipmentDb* equipment_db);
+
+    void test_all() override;
+
+private:
+    Character* pchar {nullptr};
+    Race* race {nullptr};
+    RaidControl* raid_control {nullptr};
+    SimSettings* sim_settings {nullptr};
+
+    void set_up();
+    void tear_down();
+
+    QString get_setup_string();
+
+    void test_values_after_initialization() override;
+    void test_apply_build_replaces_talents();
+    void test_apply_build_rejects_build_that_breaks_tree_rules();
+    void test_neighbours_move_one_point_within_tree_rules();
+    void test_successive_halving_keeps_true_best_build();
+    void test_successive_halving_stops_when_evaluation_fails();
+    void test_next_build_rejects_winner_of_noisy_stages();
+    void test_next_build_keeps_confirmed_winner();
+    void test_run_moves_one_point_per_round();
+    void test_run_fails_when_setup_does_not_load();
+};
@@ -2,6 +2,10 @@
 
 #include "Utils/CompareDouble.h"
 
+#ifdef NDEBUG
+#error "The test suites check their results with assert, which NDEBUG compiles out."
+#endif
+
 class TestUtils {
 public:
     enum Weapons
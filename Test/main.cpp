@@ -0,0 +1,34 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QThread>
+
+#include "TestRunner.h"
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("ClassicSimTest");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs the ClassicSim test suites in parallel.");
+    parser.addHelpOption();
+
+    QCommandLineOption threads_option("threads", "Number of threads running test suites. Defaults to the number of cores.", "n");
+    QCommandLineOption filter_option("filter", "Only run the suites whose name contains this text.", "name");
+    QCommandLineOption benchmarks_option("benchmarks", "Run the benchmarks instead of the test suites. Use with --threads 1 for stable timings.");
+    QCommandLineOption suite_option("suite", "Run only the suite with this exact name, in this process.", "name");
+    parser.addOptions({threads_option, filter_option, benchmarks_option, suite_option});
+
+    parser.process(app);
+
+    if (parser.isSet(suite_option))
+        return TestRunner().run_suite(parser.value(suite_option), parser.isSet(benchmarks_option));
+
+    const int num_threads = parser.isSet(threads_option) ? parser.value(threads_option).toInt() : QThread::idealThreadCount();
+    if (num_threads < 1) {
+        qWarning() << "--threads must be at least 1";
+        return 1;
+    }
+
+    return TestRunner().run(num_threads, parser.value(filter_option), parser.isSet(benchmarks_option)) == 0 ? 0 : 1;
+}
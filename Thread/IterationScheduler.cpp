@@ -0,0 +1,116 @@
+#include "IterationScheduler.h"
+
+#include "Utils/Check.h"
+
+IterationScheduler::~IterationScheduler() {
+    clear();
+}
+
+void IterationScheduler::prepare(const QList<SimOption::Name>& options, const int iterations, const int num_threads) {
+    check((num_threads > 0), "IterationScheduler requires at least one thread");
+    check((iterations >= 0), "IterationScheduler requires a non-negative number of iterations");
+
+    clear();
+
+    for (const auto& option : options) {
+        check(!remaining_iterations.contains(option), "IterationScheduler received duplicate option");
+        remaining_iterations.insert(option, new QAtomicInt(iterations));
+        dps_per_option.insert(option, RunningStatistics());
+    }
+
+    this->options = options;
+    this->iterations = iterations;
+    next_runner.storeRelease(0);
+
+    batch_size = qMax(1, iterations / (num_threads * BATCHES_PER_THREAD));
+}
+
+void IterationScheduler::clear() {
+    for (const auto& remaining : remaining_iterations)
+        delete remaining;
+
+    remaining_iterations.clear();
+    options.clear();
+    dps_per_option.clear();
+}
+
+int IterationScheduler::claim_batch(const SimOption::Name option) {
+    int first_iteration = 0;
+    return claim_batch(option, first_iteration);
+}
+
+int IterationScheduler::claim_batch(const SimOption::Name option, int& first_iteration) {
+    // The map itself is only read here; it is populated in prepare() before any thread starts claiming.
+    QAtomicInt* remaining = remaining_iterations.value(option, nullptr);
+    if (remaining == nullptr)
+        return 0;
+
+    int available = remaining->loadAcquire();
+    while (available > 0) {
+        const int batch = qMin(batch_size, available);
+        if (remaining->testAndSetOrdered(available, available - batch, available)) {
+            first_iteration = iterations - available;
+            return batch;
+        }
+    }
+
+    return 0;
+}
+
+int IterationScheduler::get_batch_size() const {
+    return batch_size;
+}
+
+int IterationScheduler::get_remaining_iterations(const SimOption::Name option) const {
+    QAtomicInt* remaining = remaining_iterations.value(option, nullptr);
+    return remaining != nullptr ? remaining->loadAcquire() : 0;
+}
+
+QList<SimOption::Name> IterationScheduler::get_options() const {
+    return options;
+}
+
+QList<SimOption::Name> IterationScheduler::get_options_for_next_runner() {
+    if (options.empty())
+        return options;
+
+    // Each runner starts on a different option so that all options are simulated concurrently,
+    // and then moves on to help with the options other runners started on.
+    const int offset = next_runner.fetchAndAddOrdered(1) % options.size();
+    return options.mid(offset) + options.mid(0, offset);
+}
+
+void IterationScheduler::set_seed(const unsigned long long seed) {
+    this->seed = seed;
+}
+
+unsigned long long IterationScheduler::get_seed() const {
+    return seed;
+}
+
+void IterationScheduler::set_target_confidence_interval(const double target_confidence_interval) {
+    this->target_confidence_interval = target_confidence_interval;
+}
+
+bool IterationScheduler::add_batch_result(const SimOption::Name option, const RunningStatistics& batch_dps) {
+    if (target_confidence_interval <= 0.0)
+        return false;
+
+    QMutexLocker lock(&mutex);
+    if (!dps_per_option.contains(option))
+        return false;
+
+    RunningStatistics& dps = dps_per_option[option];
+    dps.merge(batch_dps);
+
+    if (dps.get_count() < MIN_ITERATIONS_BEFORE_CONVERGENCE || dps.get_confidence_interval() >= target_confidence_interval)
+        return false;
+
+    // Converged: hand out no further batches for this option. Batches already claimed still finish.
+    return remaining_iterations[option]->fetchAndStoreOrdered(0) > 0;
+}
+
+RunningStatistics IterationScheduler::get_dps_statistics(const SimOption::Name option) {
+    QMutexLocker lock(&mutex);
+    return dps_per_option.value(option);
+}
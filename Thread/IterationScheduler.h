@@ -0,0 +1,47 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <QMap>
+#include <QMutex>
+
+#include "RunningStatistics.h"
+#include "SimOption.h"
+
+class IterationScheduler {
+public:
+    IterationScheduler() = default;
+    ~IterationScheduler();
+
+    void prepare(const QList<SimOption::Name>& options, const int iterations, const int num_threads);
+    void clear();
+
+    int claim_batch(const SimOption::Name option);
+    int claim_batch(const SimOption::Name option, int& first_iteration);
+    int get_batch_size() const;
+    int get_remaining_iterations(const SimOption::Name option) const;
+
+    QList<SimOption::Name> get_options() const;
+    QList<SimOption::Name> get_options_for_next_runner();
+
+    void set_seed(const unsigned long long seed);
+    unsigned long long get_seed() const;
+
+    void set_target_confidence_interval(const double target_confidence_interval);
+    bool add_batch_result(const SimOption::Name option, const RunningStatistics& batch_dps);
+    RunningStatistics get_dps_statistics(const SimOption::Name option);
+
+    static const int BATCHES_PER_THREAD = 16;
+    static const int MIN_ITERATIONS_BEFORE_CONVERGENCE = 100;
+
+private:
+    QList<SimOption::Name> options;
+    QMap<SimOption::Name, QAtomicInt*> remaining_iterations;
+    QAtomicInt next_runner {0};
+    int iterations {0};
+    int batch_size {1};
+    unsigned long long seed {0};
+
+    QMutex mutex;
+    QMap<SimOption::Name, RunningStatistics> dps_per_option;
+    double target_confidence_interval {0.0};
+};
@@ -16,13 +16,20 @@
 #include "SimSettings.h"
 
 SimulationRunner::SimulationRunner(
-    unsigned thread_id, EquipmentDb* equipment_db, RandomAffixes* random_affixes, SimSettings* sim_settings, NumberCruncher* scaler, QObject* parent) :
+    unsigned thread_id,
+    EquipmentDb* equipment_db,
+    RandomAffixes* random_affixes,
+    SimSettings* sim_settings,
+    NumberCruncher* scaler,
+    IterationScheduler* scheduler,
+    QObject* parent) :
     QObject(parent),
     equipment_db(equipment_db),
     random_affixes(random_affixes),
     global_sim_settings(sim_settings),
     local_sim_settings(nullptr),
     scaler(scaler),
+    scheduler(scheduler),
     full_sim(false),
     thread_id(thread_id) {}
 
@@ -43,36 +50,72 @@ void SimulationRunner::sim_runner_run(unsigned thread_id, QVector<QString> setup
     local_sim_settings->set_combat_iterations_quick_sim(iterations);
     local_sim_settings->set_sim_options(global_sim_settings->get_active_options());
     local_sim_settings->set_combat_length(global_sim_settings->get_combat_length());
-
-    raid_control = new RaidControl(local_sim_settings);
+    local_sim_settings->set_common_random_numbers(global_sim_settings->get_common_random_numbers());
+    local_sim_settings->set_fast_forward_pet_swings(global_sim_settings->get_fast_forward_pet_swings());
 
     Random pchar_seeds(0, std::numeric_limits<unsigned>::max());
 
+    SimControl sim_control(local_sim_settings, scaler, scheduler);
+    QObject::connect(&sim_control, &SimControl::update_progress, this, &SimulationRunner::receive_progress);
+
+    if (full_sim) {
+        // Every option is simulated on its own raid loaded from the setup strings. Options thereby share no state
+        // and runners can work on different options at the same time, each handing its statistics to the
+        // NumberCruncher as soon as the option is done.
+        for (const auto& option : scheduler->get_options_for_next_runner()) {
+            if (scheduler->get_remaining_iterations(option) == 0)
+                continue;
+
+            if (!setup_raid(pchar_seeds))
+                return;
+
+            sim_control.run_option(raid, raid_control, option);
+            tear_down_raid();
+        }
+    } else {
+        if (!setup_raid(pchar_seeds))
+            return;
+
+        sim_control.run_quick_sim(raid, raid_control);
+        tear_down_raid();
+    }
+
+    delete local_sim_settings;
+    local_sim_settings = nullptr;
+
+    emit simulation_runner_has_result();
+    emit finished();
+}
+
+bool SimulationRunner::setup_raid(Random& pchar_seeds) {
+    raid_control = new RaidControl(local_sim_settings);
+
     for (const auto& setup_string : this->setup_strings) {
         CharacterDecoder decoder_pchar(setup_string);
         CharacterLoader loader(equipment_db, random_affixes, local_sim_settings, raid_control, decoder_pchar);
-        raid.append(loader.initialize_new());
+        Character* pchar = loader.initialize_new();
 
-        if (!loader.successful())
+        if (!loader.successful()) {
             exit_thread(loader.get_error());
+            return false;
+        }
 
+        raid.append(pchar);
         races.append(loader.relinquish_ownership_of_race());
 
         CharacterEncoder encoder(raid.last());
-        if (encoder.get_current_setup_string() != setup_string)
-            return exit_thread("Mismatch between setup strings after setup: dumped setup string: " + encoder.get_current_setup_string());
+        if (encoder.get_current_setup_string() != setup_string) {
+            exit_thread("Mismatch between setup strings after setup: dumped setup string: " + encoder.get_current_setup_string());
+            return false;
+        }
 
         raid.last()->get_combat_roll()->set_new_seed(pchar_seeds.get_roll());
     }
 
-    SimControl sim_control(local_sim_settings, scaler);
-    QObject::connect(&sim_control, &SimControl::update_progress, this, &SimulationRunner::receive_progress);
-
-    if (full_sim)
-        sim_control.run_full_sim(raid, raid_control);
-    else
-        sim_control.run_quick_sim(raid, raid_control);
+    return true;
+}
 
+void SimulationRunner::tear_down_raid() {
     for (const auto& pchar : raid)
         delete pchar;
     for (const auto& race : races)
@@ -81,11 +124,8 @@ void SimulationRunner::sim_runner_run(unsigned thread_id, QVector<QString> setup
     raid.clear();
     races.clear();
 
-    delete local_sim_settings;
     delete raid_control;
-
-    emit simulation_runner_has_result();
-    emit finished();
+    raid_control = nullptr;
 }
 
 void SimulationRunner::receive_progress(const int iterations_completed) {
@@ -93,13 +133,10 @@ void SimulationRunner::receive_progress(const int iterations_completed) {
 }
 
 void SimulationRunner::exit_thread(QString err) {
-    for (const auto& pchar : raid)
-        delete pchar;
-    for (const auto& race : races)
-        delete race;
+    tear_down_raid();
 
     delete local_sim_settings;
-    delete raid_control;
+    local_sim_settings = nullptr;
     emit error(QString::number(thread_id), std::move(err));
     emit finished();
 }
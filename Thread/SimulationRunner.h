@@ -11,8 +11,10 @@ class Engine;
 class Equipment;
 class EquipmentDb;
 class Faction;
+class IterationScheduler;
 class NumberCruncher;
 class Race;
+class Random;
 class RandomAffixes;
 class RaidControl;
 class Rotation;
@@ -26,6 +28,7 @@ public:
                      RandomAffixes* random_affixes,
                      SimSettings* sim_settings,
                      NumberCruncher* scaler,
+                     IterationScheduler* scheduler,
                      QObject* parent = nullptr);
     ~SimulationRunner() = default;
 
@@ -48,10 +51,13 @@ private:
     SimSettings* local_sim_settings;
     RaidControl* raid_control {nullptr};
     NumberCruncher* scaler;
+    IterationScheduler* scheduler;
     bool full_sim;
     unsigned thread_id;
 
     QVector<QString> setup_strings;
 
+    bool setup_raid(Random& pchar_seeds);
+    void tear_down_raid();
     void exit_thread(QString err);
 };
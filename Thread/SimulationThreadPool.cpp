@@ -2,9 +2,9 @@
 
 #include <climits>
 
-#include <QDebug>
 #include <QThread>
 
+#include "IterationScheduler.h"
 #include "Random.h"
 #include "SimSettings.h"
 #include "SimulationRunner.h"
@@ -16,6 +16,7 @@ SimulationThreadPool::SimulationThreadPool(
     equipment_db(equipment_db),
     random_affixes(random_affixes),
     random(new Random(0, std::numeric_limits<unsigned>::max())),
+    scheduler(new IterationScheduler()),
     sim_settings(sim_settings),
     scaler(scaler),
     running_threads(0) {
@@ -26,6 +27,7 @@ SimulationThreadPool::SimulationThreadPool(
 
 SimulationThreadPool::~SimulationThreadPool() {
     delete random;
+    delete scheduler;
     for (const auto& thread_entry : thread_pool)
         delete thread_entry.second;
 }
@@ -35,13 +37,22 @@ void SimulationThreadPool::run_sim(const QVector<QString>& setup_string, bool fu
     max_iterations = iterations * num_options;
     iterations_completed = 0;
 
-    auto iterations_per_thread = static_cast<int>(static_cast<double>(iterations) / active_thread_ids.size());
+    QList<SimOption::Name> options = {SimOption::Name::NoScale};
+    if (full_sim)
+        options.append(sim_settings->get_active_options().toList());
+    check((options.size() == num_options), "Mismatch between number of options and options to schedule");
+
+    // Threads claim batches of iterations per option from the scheduler until every option is exhausted,
+    // so faster threads pick up the slack of slower ones and the exact number of iterations is run.
+    scheduler->prepare(options, iterations, active_thread_ids.size());
+    scheduler->set_target_confidence_interval(sim_settings->get_target_confidence_interval());
+    scheduler->set_seed((static_cast<unsigned long long>(random->get_roll()) << 32) | random->get_roll());
 
     for (const auto& thread : thread_pool) {
         if (!active_thread_ids.contains(thread.first))
             continue;
 
-        emit start_simulation(thread.first, setup_string, full_sim, iterations_per_thread);
+        emit start_simulation(thread.first, setup_string, full_sim, iterations);
         ++running_threads;
     }
 
@@ -90,7 +101,7 @@ void SimulationThreadPool::remove_threads(const int num_to_remove) {
 }
 
 void SimulationThreadPool::setup_thread(const unsigned thread_id) {
-    auto runner = new SimulationRunner(thread_id, equipment_db, random_affixes, sim_settings, scaler);
+    auto runner = new SimulationRunner(thread_id, equipment_db, random_affixes, sim_settings, scaler, scheduler);
     auto thread = new QThread(runner);
 
     connect(this, &SimulationThreadPool::start_simulation, runner, &SimulationRunner::sim_runner_run);
@@ -106,8 +117,8 @@ void SimulationThreadPool::setup_thread(const unsigned thread_id) {
     thread->start();
 }
 
-void SimulationThreadPool::error_string(const QString& seed, const QString& error) {
-    qDebug() << "thread error" << seed << ": " << error;
+void SimulationThreadPool::error_string(const QString&, const QString& error) {
+    emit simulation_error(error);
     thread_finished();
 }
 
@@ -117,6 +128,9 @@ void SimulationThreadPool::thread_finished() {
     if (running_threads > 0)
         return;
 
+    // Options that reached the target confidence interval skip the rest of their iterations, so the iterations
+    // completed may not add up to max_iterations.
+    emit update_progress(1.0);
     emit threads_finished();
 }
 
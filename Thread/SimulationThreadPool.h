@@ -4,6 +4,7 @@
 #include <QVector>
 
 class EquipmentDb;
+class IterationScheduler;
 class Random;
 class RandomAffixes;
 class SimSettings;
@@ -31,11 +32,14 @@ signals:
     void threads_finished();
     void start_simulation(const unsigned thread_id, QVector<QString> setup_string, bool full_sim, int iterations);
     void update_progress(const double progress);
+    // A runner failed, e.g. because a setup did not load. Its thread still counts as finished.
+    void simulation_error(const QString& error);
 
 private:
     EquipmentDb* equipment_db;
     RandomAffixes* random_affixes;
     Random* random;
+    IterationScheduler* scheduler;
     SimSettings* sim_settings;
     NumberCruncher* scaler;
     int running_threads;
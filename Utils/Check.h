@@ -2,6 +2,30 @@
 
 #include <stdexcept>
 
+#if defined(__GNUC__) || defined(__clang__)
+#define CHECK_UNLIKELY(p) __builtin_expect(!!(p), 0)
+#else
+#define CHECK_UNLIKELY(p) (p)
+#endif
+
+// Always-on invariant. The message expression is only evaluated once the condition has failed, so it is fine
+// to build it with QString::arg().
 #define check(p, msg) \
-    if (p == false) \
-    throw std::logic_error(msg)
+    do { \
+        if (CHECK_UNLIKELY(!(p))) \
+            throw std::logic_error(msg); \
+    } while (false)
+
+// Invariant on the simulation hot path (per event, per roll). Compiled in for debug builds and whenever
+// HOT_CHECKS is defined; in release builds neither the condition nor the message is evaluated.
+#if !defined(QT_NO_DEBUG) || defined(HOT_CHECKS)
+#define HOT_CHECKS_ENABLED true
+#define hot_check(p, msg) check(p, msg)
+#else
+#define HOT_CHECKS_ENABLED false
+#define hot_check(p, msg) \
+    do { \
+        static_cast<void>(sizeof(!(p))); \
+        static_cast<void>(sizeof(msg)); \
+    } while (false)
+#endif
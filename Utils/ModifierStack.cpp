@@ -0,0 +1,45 @@
+#include "ModifierStack.h"
+
+#include "Utils/Check.h"
+
+void ModifierStack::add(const int percentage) {
+    modifier *= get_coefficient(percentage);
+    percentages.append(percentage);
+    products.append(modifier);
+
+    check((modifier > 0), "Modifier negative");
+}
+
+void ModifierStack::remove(const int percentage) {
+    const int index = percentages.indexOf(percentage);
+    check((index != -1), "Failed to remove multiplicative effect");
+
+    percentages.remove(index);
+    products.resize(index);
+
+    modifier = index == 0 ? 1.0 : products.last();
+    for (int i = index; i < percentages.size(); ++i) {
+        modifier *= get_coefficient(percentages[i]);
+        products.append(modifier);
+    }
+
+    check((modifier > 0), "Modifier negative");
+}
+
+void ModifierStack::clear() {
+    percentages.clear();
+    products.clear();
+    modifier = 1.0;
+}
+
+double ModifierStack::get_modifier() const {
+    return modifier;
+}
+
+int ModifierStack::size() const {
+    return percentages.size();
+}
+
+double ModifierStack::get_coefficient(const int percentage) {
+    return 1.0 + double(percentage) / 100;
+}
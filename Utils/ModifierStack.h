@@ -0,0 +1,25 @@
+#pragma once
+
+#include <QVector>
+
+// Product of percentage modifiers, e.g. +10% and -20% give 1.1 * 0.8.
+//
+// The product of every prefix of the active modifiers is kept, so adding a modifier is a single multiplication and
+// removing one only re-multiplies the modifiers added after it. The result is bit-identical to multiplying all
+// active modifiers in the order they were added.
+class ModifierStack {
+public:
+    void add(const int percentage);
+    void remove(const int percentage);
+    void clear();
+
+    double get_modifier() const;
+    int size() const;
+
+private:
+    QVector<int> percentages;
+    QVector<double> products;
+    double modifier {1.0};
+
+    static double get_coefficient(const int percentage);
+};
@@ -29,15 +29,12 @@
 #include "ScaleResultModel.h"
 #include "SimOption.h"
 #include "SimScaleModel.h"
-#include "Test.h"
 #include "ThreatBreakdownModel.h"
 #include "WeaponModel.h"
 
 int main(int argc, char* argv[]) {
     QCoreApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
 
-    Test().test_all();
-
     QApplication app(argc, argv);
     auto gui_control = new GUIControl();
 